@@ -318,6 +318,145 @@
     #define configUSE_TIMERS    0
 #endif
 
+#ifndef configUSE_TIMER_HEAP
+    #define configUSE_TIMER_HEAP    0
+#endif
+
+#ifndef configUSE_TIMER_COMMAND_BATCH
+    #define configUSE_TIMER_COMMAND_BATCH    0
+#endif
+
+#ifndef configUSE_TICK_TIMERS
+    #define configUSE_TICK_TIMERS    0
+#endif
+
+#if ( ( configUSE_TICK_TIMERS == 1 ) && ( configUSE_TIMERS == 0 ) )
+    #error configUSE_TICK_TIMERS requires configUSE_TIMERS to be set to 1.
+#endif
+
+#ifndef configUSE_DELAYED_TASK_WHEEL
+    #define configUSE_DELAYED_TASK_WHEEL    0
+#endif
+
+#ifndef configDELAYED_TASK_WHEEL_LEVELS
+    #define configDELAYED_TASK_WHEEL_LEVELS    2
+#endif
+
+#if ( ( configUSE_DELAYED_TASK_WHEEL == 1 ) && ( configDELAYED_TASK_WHEEL_LEVELS < 1 ) )
+    #error configDELAYED_TASK_WHEEL_LEVELS must be at least 1 when configUSE_DELAYED_TASK_WHEEL is 1.
+#endif
+
+#ifndef configUSE_TASK_BUDGETS
+    #define configUSE_TASK_BUDGETS    0
+#endif
+
+#ifndef configTASK_BUDGET_BACKGROUND_PRIORITY
+    #define configTASK_BUDGET_BACKGROUND_PRIORITY    tskIDLE_PRIORITY
+#endif
+
+#if ( ( configUSE_TASK_BUDGETS == 1 ) && ( configGENERATE_RUN_TIME_STATS != 1 ) )
+    #error configUSE_TASK_BUDGETS requires configGENERATE_RUN_TIME_STATS to be set to 1.
+#endif
+
+#if ( ( configUSE_TASK_BUDGETS == 1 ) && ( INCLUDE_vTaskSuspend != 1 ) )
+    #error configUSE_TASK_BUDGETS requires INCLUDE_vTaskSuspend to be set to 1.
+#endif
+
+#ifndef configUSE_TASK_JOB_STATS
+    #define configUSE_TASK_JOB_STATS    0
+#endif
+
+#ifndef configTASK_JOB_STATS_HISTOGRAM_BINS
+    #define configTASK_JOB_STATS_HISTOGRAM_BINS    16
+#endif
+
+#ifndef configTASK_JOB_STATS_HISTOGRAM_SHIFT
+    #define configTASK_JOB_STATS_HISTOGRAM_SHIFT    8
+#endif
+
+#if ( ( configUSE_TASK_JOB_STATS == 1 ) && ( configGENERATE_RUN_TIME_STATS != 1 ) )
+    #error configUSE_TASK_JOB_STATS requires configGENERATE_RUN_TIME_STATS to be set to 1.
+#endif
+
+#if ( ( configUSE_TASK_JOB_STATS == 1 ) && ( configTASK_JOB_STATS_HISTOGRAM_BINS < 1 ) )
+    #error configTASK_JOB_STATS_HISTOGRAM_BINS must be at least 1.
+#endif
+
+#ifndef configUSE_TASK_OVERRUN_STATS
+    #define configUSE_TASK_OVERRUN_STATS    0
+#endif
+
+#ifndef configUSE_TASK_OVERRUN_HOOK
+    #define configUSE_TASK_OVERRUN_HOOK    0
+#endif
+
+#if ( ( configUSE_TASK_OVERRUN_HOOK == 1 ) && ( configUSE_TASK_OVERRUN_STATS != 1 ) )
+    #error configUSE_TASK_OVERRUN_HOOK requires configUSE_TASK_OVERRUN_STATS to be set to 1.
+#endif
+
+#ifndef configUSE_PARTIAL_STACK_PAINTING
+    #define configUSE_PARTIAL_STACK_PAINTING    0
+#endif
+
+#ifndef configSTACK_PAINT_DEPTH
+    #define configSTACK_PAINT_DEPTH    64
+#endif
+
+#if ( ( configUSE_PARTIAL_STACK_PAINTING == 1 ) && ( configSTACK_PAINT_DEPTH < 8 ) )
+    #error configSTACK_PAINT_DEPTH must be at least 8 words so the stack overflow check has a painted band to look at.
+#endif
+
+#ifndef configUSE_IDLE_STACK_SCAN
+    #define configUSE_IDLE_STACK_SCAN    0
+#endif
+
+#ifndef configIDLE_STACK_SCAN_WORDS
+    #define configIDLE_STACK_SCAN_WORDS    64
+#endif
+
+#if ( ( configUSE_IDLE_STACK_SCAN == 1 ) && ( configIDLE_STACK_SCAN_WORDS < 1 ) )
+    #error configIDLE_STACK_SCAN_WORDS must be at least 1.
+#endif
+
+#ifndef configUSE_EDF_SCHEDULING
+    #define configUSE_EDF_SCHEDULING    0
+#endif
+
+#ifndef configEDF_PRIORITY
+    #define configEDF_PRIORITY    ( configMAX_PRIORITIES / 2 )
+#endif
+
+#if ( ( configUSE_EDF_SCHEDULING == 1 ) && ( ( configEDF_PRIORITY ) >= configMAX_PRIORITIES ) )
+    #error configEDF_PRIORITY must be less than configMAX_PRIORITIES.
+#endif
+
+#ifndef configUSE_DEFERRED_WORK
+    #define configUSE_DEFERRED_WORK    0
+#endif
+
+#ifndef configUSE_TASK_POOL
+    #define configUSE_TASK_POOL    0
+#endif
+
+#ifndef configUSE_BOOT_PROFILER
+    #define configUSE_BOOT_PROFILER    0
+#endif
+
+/* Records a named time stamp of the scheduler start.  Defined by the ports that
+ * implement configUSE_BOOT_PROFILER. */
+#ifndef portBOOT_PROFILER_MARK
+    #define portBOOT_PROFILER_MARK( pcName )
+#endif
+
+/* Bracket the painting of a new task stack for the boot profiler. */
+#ifndef portBOOT_PROFILER_STACK_PAINT_BEGIN
+    #define portBOOT_PROFILER_STACK_PAINT_BEGIN()
+#endif
+
+#ifndef portBOOT_PROFILER_STACK_PAINT_END
+    #define portBOOT_PROFILER_STACK_PAINT_END()
+#endif
+
 #ifndef configUSE_COUNTING_SEMAPHORES
     #define configUSE_COUNTING_SEMAPHORES    0
 #endif
@@ -480,6 +619,15 @@
 
 #endif
 
+#ifndef portENTER_CRITICAL_INLINE
+
+/* Ports that do not provide an inlined critical section use the nesting one.
+ * The returned mask is then a dummy value. */
+    #define portENTER_CRITICAL_INLINE()    ( portENTER_CRITICAL(), ( UBaseType_t ) 0U )
+    #define portEXIT_CRITICAL_INLINE( x )  do { ( void ) ( x ); portEXIT_CRITICAL(); } while( 0 )
+
+#endif
+
 #ifndef configUSE_CORE_AFFINITY
     #define configUSE_CORE_AFFINITY    0
 #endif /* configUSE_CORE_AFFINITY */
@@ -597,6 +745,33 @@
     #define traceTASK_SWITCHED_OUT()
 #endif
 
+#ifndef traceTASK_BUDGET_THROTTLED
+
+/* Called when a task that used up its budget is suspended or demoted. */
+    #define traceTASK_BUDGET_THROTTLED( pxTCB )
+#endif
+
+#ifndef traceTASK_BUDGET_REPLENISHED
+
+/* Called when the budget of a task is replenished at the start of its period. */
+    #define traceTASK_BUDGET_REPLENISHED( pxTCB )
+#endif
+
+#ifndef traceTASK_JOB_COMPLETED
+
+/* Called when a job of a task is closed, with its execution time in run time
+ * counter units.  The job ends when the task blocks or calls xTaskDelayUntil(),
+ * it is closed when the task is next switched out, from vTaskSwitchContext(). */
+    #define traceTASK_JOB_COMPLETED( pxTCB, ulExecutionTime )
+#endif
+
+#ifndef traceTASK_OVERRUN
+
+/* Called when xTaskDelayUntil() finds that the running task missed its next
+ * release, xLateness ticks ago. */
+    #define traceTASK_OVERRUN( pxTCB, xLateness )
+#endif
+
 #ifndef traceTASK_PRIORITY_INHERIT
 
 /* Called when a task attempts to take a mutex that is already held by a
@@ -829,6 +1004,26 @@
     #define traceTIMER_COMMAND_RECEIVED( pxTimer, xMessageID, xMessageValue )
 #endif
 
+#ifndef traceDEFERRED_WORK_POST_FROM_ISR
+    #define traceDEFERRED_WORK_POST_FROM_ISR( uxLane, xFunctionToPost, xReturn )
+#endif
+
+#ifndef traceDEFERRED_WORK_EXECUTE
+    #define traceDEFERRED_WORK_EXECUTE( pxFunction )
+#endif
+
+#ifndef traceTASK_POOL_SPAWN
+    #define traceTASK_POOL_SPAWN( xTask, pxTaskCode )
+#endif
+
+#ifndef traceTASK_POOL_EXECUTE
+    #define traceTASK_POOL_EXECUTE( pxTaskCode )
+#endif
+
+#ifndef traceTASK_POOL_RETURN
+    #define traceTASK_POOL_RETURN( xTask )
+#endif
+
 #ifndef traceMALLOC
     #define traceMALLOC( pvAddress, uiSize )
 #endif
@@ -1481,6 +1676,38 @@
     #define traceRETURN_xTimerCreateStatic( pxNewTimer )
 #endif
 
+#ifndef traceENTER_xTimerCommandBatch
+    #define traceENTER_xTimerCommandBatch( pxCommands, uxCommandCount, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xTimerCommandBatch
+    #define traceRETURN_xTimerCommandBatch( xReturn )
+#endif
+
+#ifndef traceENTER_xTimerCommandBatchIsComplete
+    #define traceENTER_xTimerCommandBatchIsComplete( pxCommands, uxCommandCount )
+#endif
+
+#ifndef traceRETURN_xTimerCommandBatchIsComplete
+    #define traceRETURN_xTimerCommandBatchIsComplete( xReturn )
+#endif
+
+#ifndef traceENTER_xTimerCreateTickContext
+    #define traceENTER_xTimerCreateTickContext( pcTimerName, xTimerPeriodInTicks, xAutoReload, pvTimerID, pxCallbackFunction )
+#endif
+
+#ifndef traceRETURN_xTimerCreateTickContext
+    #define traceRETURN_xTimerCreateTickContext( xTimer )
+#endif
+
+#ifndef traceENTER_xTimerCreateTickContextStatic
+    #define traceENTER_xTimerCreateTickContextStatic( pcTimerName, xTimerPeriodInTicks, xAutoReload, pvTimerID, pxCallbackFunction, pxTimerBuffer )
+#endif
+
+#ifndef traceRETURN_xTimerCreateTickContextStatic
+    #define traceRETURN_xTimerCreateTickContextStatic( xTimer )
+#endif
+
 #ifndef traceENTER_xTimerGenericCommandFromTask
     #define traceENTER_xTimerGenericCommandFromTask( xTimer, xCommandID, xOptionalValue, pxHigherPriorityTaskWoken, xTicksToWait )
 #endif
@@ -1617,6 +1844,54 @@
     #define traceRETURN_vTimerSetTimerNumber()
 #endif
 
+#ifndef traceENTER_xDeferredWorkCreateTasks
+    #define traceENTER_xDeferredWorkCreateTasks()
+#endif
+
+#ifndef traceRETURN_xDeferredWorkCreateTasks
+    #define traceRETURN_xDeferredWorkCreateTasks( xReturn )
+#endif
+
+#ifndef traceENTER_xDeferredWorkPostFromISR
+    #define traceENTER_xDeferredWorkPostFromISR( uxLane, xFunctionToPost, pvParameter1, ulParameter2, pxHigherPriorityTaskWoken )
+#endif
+
+#ifndef traceRETURN_xDeferredWorkPostFromISR
+    #define traceRETURN_xDeferredWorkPostFromISR( xReturn )
+#endif
+
+#ifndef traceENTER_xDeferredWorkGetTaskHandle
+    #define traceENTER_xDeferredWorkGetTaskHandle( uxLane )
+#endif
+
+#ifndef traceRETURN_xDeferredWorkGetTaskHandle
+    #define traceRETURN_xDeferredWorkGetTaskHandle( xTaskHandle )
+#endif
+
+#ifndef traceENTER_xTaskPoolCreateTasks
+    #define traceENTER_xTaskPoolCreateTasks()
+#endif
+
+#ifndef traceRETURN_xTaskPoolCreateTasks
+    #define traceRETURN_xTaskPoolCreateTasks( xReturn )
+#endif
+
+#ifndef traceENTER_xTaskPoolSpawn
+    #define traceENTER_xTaskPoolSpawn( pxTaskCode, pvParameters, uxPriority, pxSpawnedTask )
+#endif
+
+#ifndef traceRETURN_xTaskPoolSpawn
+    #define traceRETURN_xTaskPoolSpawn( xReturn )
+#endif
+
+#ifndef traceENTER_uxTaskPoolGetFreeTaskCount
+    #define traceENTER_uxTaskPoolGetFreeTaskCount()
+#endif
+
+#ifndef traceRETURN_uxTaskPoolGetFreeTaskCount
+    #define traceRETURN_uxTaskPoolGetFreeTaskCount( uxFreeTasks )
+#endif
+
 #ifndef traceENTER_xTaskCreateStatic
     #define traceENTER_xTaskCreateStatic( pxTaskCode, pcName, ulStackDepth, pvParameters, uxPriority, puxStackBuffer, pxTaskBuffer )
 #endif
@@ -1697,6 +1972,46 @@
     #define traceRETURN_xTaskDelayUntil( xShouldDelay )
 #endif
 
+#ifndef traceENTER_vTaskSetDeadline
+    #define traceENTER_vTaskSetDeadline( xTask, xRelativeDeadline )
+#endif
+
+#ifndef traceRETURN_vTaskSetDeadline
+    #define traceRETURN_vTaskSetDeadline()
+#endif
+
+#ifndef traceENTER_vTaskSetBudget
+    #define traceENTER_vTaskSetBudget( xTask, ulBudget, xPeriod, eAction )
+#endif
+
+#ifndef traceRETURN_vTaskSetBudget
+    #define traceRETURN_vTaskSetBudget()
+#endif
+
+#ifndef traceENTER_vTaskGetJobStats
+    #define traceENTER_vTaskGetJobStats( xTask, pxJobStats )
+#endif
+
+#ifndef traceRETURN_vTaskGetJobStats
+    #define traceRETURN_vTaskGetJobStats()
+#endif
+
+#ifndef traceENTER_vTaskResetJobStats
+    #define traceENTER_vTaskResetJobStats( xTask )
+#endif
+
+#ifndef traceRETURN_vTaskResetJobStats
+    #define traceRETURN_vTaskResetJobStats()
+#endif
+
+#ifndef traceENTER_uxTaskGetStackHighWaterMarks
+    #define traceENTER_uxTaskGetStackHighWaterMarks( pxStackHighWaterMarkArray, uxArraySize )
+#endif
+
+#ifndef traceRETURN_uxTaskGetStackHighWaterMarks
+    #define traceRETURN_uxTaskGetStackHighWaterMarks( uxTask )
+#endif
+
 #ifndef traceENTER_vTaskDelay
     #define traceENTER_vTaskDelay( xTicksToDelay )
 #endif
@@ -1897,6 +2212,22 @@
     #define traceRETURN_uxTaskGetSystemState( uxTask )
 #endif
 
+#ifndef traceENTER_xTaskGetRunTimeSnapshot
+    #define traceENTER_xTaskGetRunTimeSnapshot( pxSnapshot )
+#endif
+
+#ifndef traceRETURN_xTaskGetRunTimeSnapshot
+    #define traceRETURN_xTaskGetRunTimeSnapshot( xReturn )
+#endif
+
+#ifndef traceENTER_uxTaskGetRunTimeLoad
+    #define traceENTER_uxTaskGetRunTimeLoad( pxOldSnapshot, pxNewSnapshot, pxTaskLoadArray, uxArraySize )
+#endif
+
+#ifndef traceRETURN_uxTaskGetRunTimeLoad
+    #define traceRETURN_uxTaskGetRunTimeLoad( uxTask )
+#endif
+
 #if ( configNUMBER_OF_CORES == 1 )
     #ifndef traceENTER_xTaskGetIdleTaskHandle
         #define traceENTER_xTaskGetIdleTaskHandle()
@@ -2309,6 +2640,30 @@
     #define traceRETURN_ulTaskGenericNotifyValueClear( ulReturn )
 #endif
 
+#ifndef traceENTER_xTaskMailboxSend
+    #define traceENTER_xTaskMailboxSend( xTaskToNotify, pvMessage, xMessageLength )
+#endif
+
+#ifndef traceRETURN_xTaskMailboxSend
+    #define traceRETURN_xTaskMailboxSend( xReturn )
+#endif
+
+#ifndef traceENTER_xTaskMailboxSendFromISR
+    #define traceENTER_xTaskMailboxSendFromISR( xTaskToNotify, pvMessage, xMessageLength, pxHigherPriorityTaskWoken )
+#endif
+
+#ifndef traceRETURN_xTaskMailboxSendFromISR
+    #define traceRETURN_xTaskMailboxSendFromISR( xReturn )
+#endif
+
+#ifndef traceENTER_xTaskMailboxReceive
+    #define traceENTER_xTaskMailboxReceive( pvBuffer, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xTaskMailboxReceive
+    #define traceRETURN_xTaskMailboxReceive( xReceivedLength )
+#endif
+
 #ifndef traceENTER_ulTaskGetRunTimeCounter
     #define traceENTER_ulTaskGetRunTimeCounter( xTask )
 #endif
@@ -2715,6 +3070,30 @@
     #error configTASK_NOTIFICATION_ARRAY_ENTRIES must be at least 1
 #endif
 
+#ifndef configUSE_TASK_MAILBOX
+    #define configUSE_TASK_MAILBOX    0
+#endif
+
+#ifndef configTASK_MAILBOX_SIZE
+    #define configTASK_MAILBOX_SIZE    16
+#endif
+
+#ifndef configTASK_MAILBOX_NOTIFICATION_INDEX
+    #define configTASK_MAILBOX_NOTIFICATION_INDEX    ( configTASK_NOTIFICATION_ARRAY_ENTRIES - 1 )
+#endif
+
+#if ( ( configUSE_TASK_MAILBOX == 1 ) && ( configUSE_TASK_NOTIFICATIONS != 1 ) )
+    #error configUSE_TASK_NOTIFICATIONS must be set to 1 to use the task mailbox.
+#endif
+
+#if ( ( configUSE_TASK_MAILBOX == 1 ) && ( ( ( configTASK_MAILBOX_SIZE ) < 4 ) || ( ( configTASK_MAILBOX_SIZE ) > 252 ) || ( ( ( configTASK_MAILBOX_SIZE ) % 4 ) != 0 ) ) )
+    #error configTASK_MAILBOX_SIZE must be a multiple of 4 from 4 to 252.
+#endif
+
+#if ( ( configUSE_TASK_MAILBOX == 1 ) && ( ( configTASK_MAILBOX_NOTIFICATION_INDEX ) >= configTASK_NOTIFICATION_ARRAY_ENTRIES ) )
+    #error configTASK_MAILBOX_NOTIFICATION_INDEX must be less than configTASK_NOTIFICATION_ARRAY_ENTRIES.
+#endif
+
 #ifndef configUSE_POSIX_ERRNO
     #define configUSE_POSIX_ERRNO    0
 #endif
@@ -2809,6 +3188,22 @@
     #error configUSE_PORT_OPTIMISED_TASK_SELECTION is not supported in SMP FreeRTOS
 #endif
 
+#if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_EDF_SCHEDULING != 0 ) )
+    #error configUSE_EDF_SCHEDULING is not supported in SMP FreeRTOS
+#endif
+
+#if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_TASK_BUDGETS != 0 ) )
+    #error configUSE_TASK_BUDGETS is not supported in SMP FreeRTOS
+#endif
+
+#if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_TASK_JOB_STATS != 0 ) )
+    #error configUSE_TASK_JOB_STATS is not supported in SMP FreeRTOS
+#endif
+
+#if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_IDLE_STACK_SCAN != 0 ) )
+    #error configUSE_IDLE_STACK_SCAN is not supported in SMP FreeRTOS
+#endif
+
 #ifndef configINITIAL_TICK_COUNT
     #define configINITIAL_TICK_COUNT    0
 #endif
@@ -3105,6 +3500,34 @@ typedef struct xSTATIC_TCB
     #if ( configGENERATE_RUN_TIME_STATS == 1 )
         configRUN_TIME_COUNTER_TYPE ulDummy16;
     #endif
+    #if ( configUSE_EDF_SCHEDULING == 1 )
+        TickType_t xDummy27[ 2 ];
+    #endif
+    #if ( configUSE_TASK_BUDGETS == 1 )
+        StaticListItem_t xDummy28;
+        configRUN_TIME_COUNTER_TYPE ulDummy29[ 2 ];
+        TickType_t xDummy30;
+        UBaseType_t uxDummy31;
+        uint8_t ucDummy32[ 2 ];
+    #endif
+    #if ( configUSE_TASK_JOB_STATS == 1 )
+        struct
+        {
+            uint32_t ulDummy1;
+            configRUN_TIME_COUNTER_TYPE ulDummy2[ 3 ];
+            uint32_t ulDummy3[ configTASK_JOB_STATS_HISTOGRAM_BINS ];
+        } xDummy33;
+        configRUN_TIME_COUNTER_TYPE ulDummy34;
+        uint8_t ucDummy41;
+    #endif
+    #if ( configUSE_TASK_OVERRUN_STATS == 1 )
+        uint32_t ulDummy35;
+        TickType_t xDummy36;
+    #endif
+    #if ( configUSE_IDLE_STACK_SCAN == 1 )
+        StaticListItem_t xDummy37;
+        configSTACK_DEPTH_TYPE uxDummy38;
+    #endif
     #if ( configUSE_C_RUNTIME_TLS_SUPPORT == 1 )
         configTLS_BLOCK_TYPE xDummy17;
     #endif
@@ -3112,6 +3535,10 @@ typedef struct xSTATIC_TCB
         uint32_t ulDummy18[ configTASK_NOTIFICATION_ARRAY_ENTRIES ];
         uint8_t ucDummy19[ configTASK_NOTIFICATION_ARRAY_ENTRIES ];
     #endif
+    #if ( configUSE_TASK_MAILBOX == 1 )
+        uint32_t ulDummy39[ configTASK_MAILBOX_SIZE / 4 ];
+        uint8_t ucDummy40;
+    #endif
     #if ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 )
         uint8_t uxDummy20;
     #endif
@@ -3220,6 +3647,9 @@ typedef struct xSTATIC_TIMER
         UBaseType_t uxDummy7;
     #endif
     uint8_t ucDummy8;
+    #if ( configUSE_TIMER_HEAP == 1 )
+        void * pvDummy9[ 4 ];
+    #endif
 } StaticTimer_t;
 
 /*
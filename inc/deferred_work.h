@@ -0,0 +1,125 @@
+/*_____________________________________________________________________________
+ │                                                                            |
+ │ COPYRIGHT (C) 2026 Mihai Baneu                                             |
+ │                                                                            |
+ | Permission is hereby  granted,  free of charge,  to any person obtaining a |
+ | copy of this software and associated documentation files (the "Software"), |
+ | to deal in the Software without restriction,  including without limitation |
+ | the rights to  use, copy, modify, merge, publish, distribute,  sublicense, |
+ | and/or sell copies  of  the Software, and to permit  persons to  whom  the |
+ | Software is furnished to do so, subject to the following conditions:       |
+ |                                                                            |
+ | The above  copyright notice  and this permission notice  shall be included |
+ | in all copies or substantial portions of the Software.                     |
+ |                                                                            |
+ | THE SOFTWARE IS PROVIDED  "AS IS",  WITHOUT WARRANTY OF ANY KIND,  EXPRESS |
+ | OR   IMPLIED,   INCLUDING   BUT   NOT   LIMITED   TO   THE  WARRANTIES  OF |
+ | MERCHANTABILITY,  FITNESS FOR  A  PARTICULAR  PURPOSE AND NONINFRINGEMENT. |
+ | IN NO  EVENT SHALL  THE AUTHORS  OR  COPYRIGHT  HOLDERS  BE LIABLE FOR ANY |
+ | CLAIM, DAMAGES OR OTHER LIABILITY,  WHETHER IN AN ACTION OF CONTRACT, TORT |
+ | OR OTHERWISE, ARISING FROM,  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR  |
+ | THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                 |
+ |____________________________________________________________________________|
+ |                                                                            |
+ |  Author: Mihai Baneu                           Last modified: 17.Oct.2026  |
+ |                                                                            |
+ |___________________________________________________________________________*/
+
+#ifndef DEFERRED_WORK_H
+#define DEFERRED_WORK_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h must appear in source files before include deferred_work.h"
+#endif
+
+#include "task.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/*
+ * The deferred work queue moves processing out of interrupt service routines
+ * into task context without going through the timer service task.  Work is
+ * posted to one of configDEFERRED_WORK_LANES lanes.  Each lane is a fixed size
+ * ring that producers claim slots in with a compare-and-swap, and a worker
+ * task that drains the ring.  Lane 0 is served at
+ * configDEFERRED_WORK_TASK_PRIORITY, every following lane one priority lower.
+ *
+ * A worker is notified only by the first post after it last started draining
+ * its lane, so a burst of interrupts results in a single context switch.
+ *
+ * The worker tasks are created by vTaskStartScheduler() when
+ * configUSE_DEFERRED_WORK is set to 1 in FreeRTOSConfig.h.
+ */
+
+/**
+ * Defines the prototype to which functions posted to the deferred work queue
+ * must conform.
+ */
+typedef void (* DeferredWorkFunction_t)( void * pvParameter1,
+                                         uint32_t ulParameter2 );
+
+/**
+ * deferred_work. h
+ * @code{c}
+ * BaseType_t xDeferredWorkPostFromISR( UBaseType_t uxLane,
+ *                                      DeferredWorkFunction_t xFunctionToPost,
+ *                                      void * pvParameter1,
+ *                                      uint32_t ulParameter2,
+ *                                      BaseType_t * pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * Used from application interrupt service routines to defer the execution of a
+ * function to the worker task of a deferred work lane.  Unlike
+ * xTimerPendFunctionCallFromISR() no queue is involved and the work does not
+ * compete with the timer commands.
+ *
+ * Functions posted to the same lane are executed in the order they were posted.
+ * They run in the context of the worker task, so they must not block on the
+ * worker's own direct to task notification.
+ *
+ * @param uxLane The lane to post to, 0 to configDEFERRED_WORK_LANES - 1.
+ *
+ * @param xFunctionToPost The function to execute from the worker task.
+ *
+ * @param pvParameter1 The value of the function's first parameter.
+ *
+ * @param ulParameter2 The value of the function's second parameter.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if the worker task had to be
+ * woken and has a priority above the interrupted task.  The interrupt should
+ * then request a context switch before it exits, as with any other FromISR
+ * function.
+ *
+ * @return pdPASS if the function was posted, pdFAIL if the ring of the lane was
+ * full.
+ */
+BaseType_t xDeferredWorkPostFromISR( UBaseType_t uxLane,
+                                     DeferredWorkFunction_t xFunctionToPost,
+                                     void * pvParameter1,
+                                     uint32_t ulParameter2,
+                                     BaseType_t * pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * TaskHandle_t xDeferredWorkGetTaskHandle( UBaseType_t uxLane );
+ *
+ * @return The handle of the worker task serving the lane, or NULL if the
+ * scheduler has not been started yet.
+ */
+TaskHandle_t xDeferredWorkGetTaskHandle( UBaseType_t uxLane ) PRIVILEGED_FUNCTION;
+
+/*
+ * Functions beyond this part are not part of the public API and are intended
+ * for use by the kernel only.
+ */
+BaseType_t xDeferredWorkCreateTasks( void ) PRIVILEGED_FUNCTION;
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+#endif /* DEFERRED_WORK_H */
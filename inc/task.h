@@ -119,6 +119,14 @@ typedef enum
     eSetValueWithoutOverwrite /* Set the task's notification value if the previous value has been read by the task. */
 } eNotifyAction;
 
+/* Actions that can be taken when a task uses up the budget set by
+ * vTaskSetBudget(). */
+typedef enum
+{
+    eBudgetSuspend = 0, /* Hold the task in the Suspended state until its budget is replenished. */
+    eBudgetDemote       /* Run the task at configTASK_BUDGET_BACKGROUND_PRIORITY until its budget is replenished. */
+} eBudgetAction;
+
 /*
  * Used internally only.
  */
@@ -175,8 +183,78 @@ typedef struct xTASK_STATUS
     #if ( ( configUSE_CORE_AFFINITY == 1 ) && ( configNUMBER_OF_CORES > 1 ) )
         UBaseType_t uxCoreAffinityMask;           /* The core affinity mask for the task */
     #endif
+    #if ( configUSE_TASK_OVERRUN_STATS == 1 )
+        uint32_t ulOverrunCount;                  /* The number of times xTaskDelayUntil() found the task had missed its next release. */
+        TickType_t xMaxLateness;                  /* The largest number of ticks by which the task missed a release. */
+    #endif
 } TaskStatus_t;
 
+/* Used with the xTaskGetRunTimeSnapshot() function to sample the run time of
+ * each task in the system. */
+typedef struct xTASK_RUN_TIME
+{
+    TaskHandle_t xHandle;                         /* The handle of the task to which the run time relates. */
+    UBaseType_t xTaskNumber;                      /* A number unique to the task - used to tell a deleted task from a new one reusing its handle. */
+    configRUN_TIME_COUNTER_TYPE ulRunTimeCounter; /* The total run time allocated to the task when the snapshot was taken, including the time of the current execution if the task was running. */
+} TaskRunTime_t;
+
+/* A snapshot of the run time of all the tasks, filled in by
+ * xTaskGetRunTimeSnapshot() into a caller supplied array. */
+typedef struct xTASK_RUN_TIME_SNAPSHOT
+{
+    TaskRunTime_t * pxTaskRunTimeArray;         /* Caller supplied array that receives the run time of each task. */
+    UBaseType_t uxArraySize;                    /* The number of TaskRunTime_t structures in pxTaskRunTimeArray. */
+    UBaseType_t uxNumberOfTasks;                /* The number of TaskRunTime_t structures populated by the last snapshot. */
+    configRUN_TIME_COUNTER_TYPE ulTotalRunTime; /* The run time stats clock when the snapshot was taken. */
+} TaskRunTimeSnapshot_t;
+
+/* The CPU load of a task over the interval between two snapshots, as computed
+ * by uxTaskGetRunTimeLoad(). */
+typedef struct xTASK_LOAD
+{
+    TaskHandle_t xHandle;                  /* The handle of the task to which the load relates. */
+    UBaseType_t xTaskNumber;               /* A number unique to the task. */
+    configRUN_TIME_COUNTER_TYPE ulRunTime; /* The run time allocated to the task within the interval. */
+    uint32_t ulLoad;                       /* The share of the interval used by the task in hundredths of a percent (0 to 10000). */
+} TaskLoad_t;
+
+#if ( configUSE_TASK_JOB_STATS == 1 )
+
+/* The execution time statistics of the jobs of a task, as returned by
+ * vTaskGetJobStats().  All times are in run time counter units. */
+    typedef struct xTASK_JOB_STATS
+    {
+        uint32_t ulJobCount;                                            /* The number of jobs measured. */
+        configRUN_TIME_COUNTER_TYPE ulMinExecutionTime;                 /* The shortest job, only valid if ulJobCount is not 0. */
+        configRUN_TIME_COUNTER_TYPE ulMaxExecutionTime;                 /* The longest job. */
+        configRUN_TIME_COUNTER_TYPE ulTotalExecutionTime;               /* The sum of all the jobs, the mean is ulTotalExecutionTime / ulJobCount. */
+        uint32_t ulHistogram[ configTASK_JOB_STATS_HISTOGRAM_BINS ];    /* Bin n counts jobs of 2 ^ ( n + configTASK_JOB_STATS_HISTOGRAM_SHIFT ) to twice that, the first and last bins also count shorter and longer jobs. */
+    } TaskJobStats_t;
+
+#endif /* configUSE_TASK_JOB_STATS */
+
+/* A sliding window over the last snapshots of the run time stats.  All the
+ * memory is supplied by the caller, see vTaskLoadWindowInitialise(). */
+typedef struct xTASK_LOAD_WINDOW
+{
+    TaskRunTimeSnapshot_t * pxSnapshots; /* Caller supplied ring of snapshots. */
+    UBaseType_t uxNumberOfSnapshots;     /* The number of snapshots in the ring. */
+    UBaseType_t uxNextSnapshot;          /* The index of the snapshot taken by the next call to xTaskLoadWindowSample(). */
+    UBaseType_t uxValidSnapshots;        /* The number of snapshots in the ring that have been taken. */
+} TaskLoadWindow_t;
+
+#if ( configUSE_IDLE_STACK_SCAN == 1 )
+
+/* The cached stack high water mark of a task, as returned by
+ * uxTaskGetStackHighWaterMarks(). */
+    typedef struct xTASK_STACK_HIGH_WATER_MARK
+    {
+        TaskHandle_t xHandle;                        /* The handle of the task to which the high water mark relates. */
+        configSTACK_DEPTH_TYPE uxStackHighWaterMark; /* The minimum free stack space, in words, found by the last complete scan of the task's stack. */
+    } TaskStackHighWaterMark_t;
+
+#endif /* configUSE_IDLE_STACK_SCAN */
+
 /* Possible return values for eTaskConfirmSleepModeStatus(). */
 typedef enum
 {
@@ -249,6 +327,24 @@ typedef enum
     #define taskEXIT_CRITICAL_FROM_ISR( x )    portEXIT_CRITICAL_FROM_ISR( x )
 #endif
 
+/**
+ * task. h
+ *
+ * Macros to mark the start and end of a short critical code region that does
+ * not itself call taskENTER_CRITICAL()/taskEXIT_CRITICAL().  Where the port
+ * provides an inlined implementation the interrupt mask is raised in place and
+ * the previous mask is returned, to be passed to taskEXIT_CRITICAL_INLINE(), in
+ * the same way as taskENTER_CRITICAL_FROM_ISR() - no nesting count is kept.
+ * Such regions can nest each other and can be placed inside a
+ * taskENTER_CRITICAL() region, but not the other way round.  Ports without an
+ * inlined implementation fall back to taskENTER_CRITICAL()/taskEXIT_CRITICAL().
+ *
+ * \defgroup taskENTER_CRITICAL_INLINE taskENTER_CRITICAL_INLINE
+ * \ingroup SchedulerControl
+ */
+#define taskENTER_CRITICAL_INLINE()          portENTER_CRITICAL_INLINE()
+#define taskEXIT_CRITICAL_INLINE( x )        portEXIT_CRITICAL_INLINE( x )
+
 /**
  * task. h
  *
@@ -895,6 +991,12 @@ void vTaskDelay( const TickType_t xTicksToDelay ) PRIVILEGED_FUNCTION;
  * Will be pdTRUE if the task way delayed and pdFALSE otherwise.  A task will not
  * be delayed if the next expected wake time is in the past.
  *
+ * If configUSE_TASK_OVERRUN_STATS is set to 1 each call that is not delayed
+ * is also counted as an overrun of the task, and the number of ticks by which
+ * the wake time was missed is tracked, see vTaskGetInfo().  If
+ * configUSE_TASK_OVERRUN_HOOK is set to 1 vApplicationTaskOverrunHook() is
+ * called as well.
+ *
  * Example usage:
  * @code{c}
  * // Perform an action every 10 ticks.
@@ -931,6 +1033,116 @@ BaseType_t xTaskDelayUntil( TickType_t * const pxPreviousWakeTime,
         ( void ) xTaskDelayUntil( ( pxPreviousWakeTime ), ( xTimeIncrement ) ); \
     } while( 0 )
 
+/**
+ * task. h
+ * @code{c}
+ * void vTaskSetDeadline( TaskHandle_t xTask, TickType_t xRelativeDeadline );
+ * @endcode
+ *
+ * configUSE_EDF_SCHEDULING must be defined as 1 for this function to be
+ * available.  See the configuration section for more information.
+ *
+ * Add a task to, or remove a task from, the earliest deadline first scheduling
+ * class.  Ready state tasks of priority configEDF_PRIORITY that have a deadline
+ * run in the order of their absolute deadlines rather than round robin, and a
+ * task released with an earlier deadline preempts the running one.  Tasks of
+ * that priority without a deadline only run when no task with a deadline is
+ * ready.  The deadline has no effect on tasks of any other priority, so the task
+ * should be created at, or moved to, priority configEDF_PRIORITY.
+ *
+ * The first absolute deadline is xRelativeDeadline ticks from the time
+ * vTaskSetDeadline() is called.  After that each call to xTaskDelayUntil()
+ * releases the next job of the task, whose absolute deadline is the wake time
+ * plus xRelativeDeadline.  Selecting the task scans the Ready state tasks of
+ * priority configEDF_PRIORITY, so keep the number of such tasks small.
+ *
+ * @param xTask Handle of the task.  Passing NULL sets the deadline of the
+ * calling task.
+ *
+ * @param xRelativeDeadline The deadline of each job relative to its release,
+ * normally no more than the period passed to xTaskDelayUntil().  Passing 0
+ * removes the task from the earliest deadline first class.
+ *
+ * Example usage:
+ * @code{c}
+ * // Run a control loop every 10 ticks, each iteration to complete within
+ * // 8 ticks of its release.
+ * void vControlTask( void * pvParameters )
+ * {
+ * TickType_t xLastWakeTime;
+ *
+ *     vTaskSetDeadline( NULL, 8 );
+ *     xLastWakeTime = xTaskGetTickCount();
+ *
+ *     for( ;; )
+ *     {
+ *         xTaskDelayUntil( &xLastWakeTime, 10 );
+ *
+ *         // Perform the control loop iteration here.
+ *     }
+ * }
+ * @endcode
+ * \defgroup vTaskSetDeadline vTaskSetDeadline
+ * \ingroup TaskCtrl
+ */
+#if ( configUSE_EDF_SCHEDULING == 1 )
+    void vTaskSetDeadline( TaskHandle_t xTask,
+                           TickType_t xRelativeDeadline ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * void vTaskSetBudget( TaskHandle_t xTask, configRUN_TIME_COUNTER_TYPE ulBudget, TickType_t xPeriod, eBudgetAction eAction );
+ * @endcode
+ *
+ * configUSE_TASK_BUDGETS must be defined as 1 for this function to be
+ * available.  See the configuration section for more information.
+ *
+ * Reserve, and at the same time limit, the processor time of a task.  The task
+ * may run for ulBudget run time counter units (processor cycles on the ports
+ * that use the DWT cycle counter) in every period of xPeriod ticks.  The time a
+ * task runs is charged to its budget each time it is switched out, and the tick
+ * interrupt switches out a task that used up its budget without blocking.  A
+ * task that has used up its budget is throttled as selected by eAction until
+ * its budget is replenished at the start of its next period:
+ *
+ * eBudgetSuspend - The task is held in the Suspended state.
+ *
+ * eBudgetDemote - The task keeps running, but only at priority
+ * configTASK_BUDGET_BACKGROUND_PRIORITY, so it can no longer starve tasks of
+ * a higher priority.
+ *
+ * A demoted task should not hold a mutex, as the demotion is not undone by
+ * priority inheritance.
+ *
+ * @param xTask Handle of the task.  Passing NULL sets the budget of the calling
+ * task.
+ *
+ * @param ulBudget The budget, in run time counter units, of each period.
+ * Passing 0 removes the budget, and ends any throttling of the task.
+ *
+ * @param xPeriod The period in ticks.  The first period starts when
+ * vTaskSetBudget() is called.
+ *
+ * @param eAction How the task is throttled when it uses up its budget.
+ *
+ * Example usage:
+ * @code{c}
+ * // Let the third party task use at most 20% of the processor, in windows of
+ * // 10 ticks, with a 1 kHz tick and a 100 MHz run time counter.
+ * vTaskSetBudget( xThirdPartyTask, 200000UL, 10, eBudgetDemote );
+ * @endcode
+ * \defgroup vTaskSetBudget vTaskSetBudget
+ * \ingroup TaskCtrl
+ */
+#if ( configUSE_TASK_BUDGETS == 1 )
+    void vTaskSetBudget( TaskHandle_t xTask,
+                         configRUN_TIME_COUNTER_TYPE ulBudget,
+                         TickType_t xPeriod,
+                         eBudgetAction eAction ) PRIVILEGED_FUNCTION;
+#endif
+
 
 /**
  * task. h
@@ -1859,6 +2071,43 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery ) PRIVILEGED_FUNCTION;
     configSTACK_DEPTH_TYPE uxTaskGetStackHighWaterMark2( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
 #endif
 
+/**
+ * task.h
+ * @code{c}
+ * UBaseType_t uxTaskGetStackHighWaterMarks( TaskStackHighWaterMark_t * const pxStackHighWaterMarkArray,
+ *                                           const UBaseType_t uxArraySize );
+ * @endcode
+ *
+ * configUSE_IDLE_STACK_SCAN must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.
+ *
+ * With configUSE_IDLE_STACK_SCAN set to 1 the idle task scans the stacks of all
+ * the tasks in turn, configIDLE_STACK_SCAN_WORDS words at a time, and caches the
+ * high water mark of each task in its TCB.  uxTaskGetStackHighWaterMarks()
+ * copies the cached marks of all the tasks into pxStackHighWaterMarkArray
+ * without looking at any stack, so it is cheap enough to call periodically from
+ * a monitor task.
+ *
+ * A cached mark is as recent as the last complete scan of the task's stack.
+ * Until the first scan of a task completes its mark is the size of its stack
+ * (or configSTACK_PAINT_DEPTH if that is smaller and partial stack painting is
+ * used).  Use uxTaskGetStackHighWaterMark() to scan the stack of one task on
+ * demand.
+ *
+ * @param pxStackHighWaterMarkArray Caller supplied array that receives one
+ * TaskStackHighWaterMark_t structure for each task in the system.
+ *
+ * @param uxArraySize The number of TaskStackHighWaterMark_t structures in
+ * pxStackHighWaterMarkArray.
+ *
+ * @return The number of TaskStackHighWaterMark_t structures populated, or 0 if
+ * the array is too small to hold all the tasks in the system.
+ */
+#if ( configUSE_IDLE_STACK_SCAN == 1 )
+    UBaseType_t uxTaskGetStackHighWaterMarks( TaskStackHighWaterMark_t * const pxStackHighWaterMarkArray,
+                                              const UBaseType_t uxArraySize ) PRIVILEGED_FUNCTION;
+#endif
+
 /* When using trace macros it is sometimes necessary to include task.h before
  * FreeRTOS.h.  When this is done TaskHookFunction_t will not yet have been defined,
  * so the following two prototypes will cause a compilation error.  This can be
@@ -1982,6 +2231,29 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery ) PRIVILEGED_FUNCTION;
 
 #endif
 
+#if ( configUSE_TASK_OVERRUN_HOOK == 1 )
+
+/**
+ * task.h
+ * @code{c}
+ * void vApplicationTaskOverrunHook( TaskHandle_t xTask, TickType_t xLateness );
+ * @endcode
+ *
+ * This hook function is called by xTaskDelayUntil(), from the context of the
+ * calling task, when the task missed its next release.
+ *
+ * @param xTask The task that missed its release.
+ * @param xLateness The number of ticks by which the release was missed.  0
+ * means the release was due on the current tick.
+ */
+    /* MISRA Ref 8.6.1 [External linkage] */
+    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-86 */
+    /* coverity[misra_c_2012_rule_8_6_violation] */
+    void vApplicationTaskOverrunHook( TaskHandle_t xTask,
+                                      TickType_t xLateness );
+
+#endif
+
 #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
 
 /**
@@ -2179,6 +2451,140 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery ) PRIVILEGED_FUNCTION;
                                       configRUN_TIME_COUNTER_TYPE * const pulTotalRunTime ) PRIVILEGED_FUNCTION;
 #endif
 
+/**
+ * task. h
+ * @code{c}
+ * BaseType_t xTaskGetRunTimeSnapshot( TaskRunTimeSnapshot_t * const pxSnapshot );
+ * @endcode
+ *
+ * configUSE_TRACE_FACILITY and configGENERATE_RUN_TIME_STATS must be defined as
+ * 1 in FreeRTOSConfig.h for xTaskGetRunTimeSnapshot() to be available.
+ *
+ * Samples the run time counter of every task in the system into the caller
+ * supplied pxSnapshot->pxTaskRunTimeArray.  Unlike uxTaskGetSystemState() it
+ * does not allocate memory and does not check the stack high water marks, so
+ * the scheduler is only suspended for the time it takes to copy three words
+ * per task.  This makes it suitable for periodic monitoring in production.
+ *
+ * The run time counter is read with portGET_RUN_TIME_COUNTER_VALUE(), so it
+ * must be readable from the calling task.  The STM32 ports with a DWT cycle
+ * counter run the tasks unprivileged and read the counter through a service
+ * call, which costs an exception entry and return per snapshot.
+ *
+ * @param pxSnapshot The snapshot to fill in.  pxTaskRunTimeArray and
+ * uxArraySize must be set by the caller.
+ *
+ * @return pdPASS if the snapshot was taken, pdFAIL if the array is too small to
+ * hold all the tasks in the system.
+ */
+#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configGENERATE_RUN_TIME_STATS == 1 ) )
+    BaseType_t xTaskGetRunTimeSnapshot( TaskRunTimeSnapshot_t * const pxSnapshot ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * UBaseType_t uxTaskGetRunTimeLoad( const TaskRunTimeSnapshot_t * const pxOldSnapshot,
+ *                                   const TaskRunTimeSnapshot_t * const pxNewSnapshot,
+ *                                   TaskLoad_t * const pxTaskLoadArray,
+ *                                   const UBaseType_t uxArraySize );
+ * @endcode
+ *
+ * configUSE_TRACE_FACILITY and configGENERATE_RUN_TIME_STATS must be defined as
+ * 1 in FreeRTOSConfig.h for uxTaskGetRunTimeLoad() to be available.
+ *
+ * Computes the CPU load of each task over the interval between two snapshots
+ * taken by xTaskGetRunTimeSnapshot().  Only the snapshots are accessed, the
+ * scheduler is not suspended.  Tasks created within the interval are accounted
+ * from zero, tasks deleted within the interval are not reported.
+ *
+ * @param pxOldSnapshot The snapshot at the start of the interval.
+ *
+ * @param pxNewSnapshot The snapshot at the end of the interval.
+ *
+ * @param pxTaskLoadArray Caller supplied array that receives one TaskLoad_t
+ * structure for each task in pxNewSnapshot.
+ *
+ * @param uxArraySize The number of TaskLoad_t structures in pxTaskLoadArray.
+ *
+ * @return The number of TaskLoad_t structures populated.
+ */
+#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configGENERATE_RUN_TIME_STATS == 1 ) )
+    UBaseType_t uxTaskGetRunTimeLoad( const TaskRunTimeSnapshot_t * const pxOldSnapshot,
+                                      const TaskRunTimeSnapshot_t * const pxNewSnapshot,
+                                      TaskLoad_t * const pxTaskLoadArray,
+                                      const UBaseType_t uxArraySize ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * void vTaskLoadWindowInitialise( TaskLoadWindow_t * const pxWindow,
+ *                                 TaskRunTimeSnapshot_t * const pxSnapshots,
+ *                                 const UBaseType_t uxNumberOfSnapshots );
+ * BaseType_t xTaskLoadWindowSample( TaskLoadWindow_t * const pxWindow );
+ * UBaseType_t uxTaskLoadWindowGet( const TaskLoadWindow_t * const pxWindow,
+ *                                  UBaseType_t uxSamples,
+ *                                  TaskLoad_t * const pxTaskLoadArray,
+ *                                  const UBaseType_t uxArraySize );
+ * @endcode
+ *
+ * configUSE_TRACE_FACILITY and configGENERATE_RUN_TIME_STATS must be defined as
+ * 1 in FreeRTOSConfig.h for these functions to be available.
+ *
+ * Sliding window CPU load.  xTaskLoadWindowSample() is called periodically and
+ * stores a snapshot into the next slot of a caller supplied ring, overwriting
+ * the oldest one.  uxTaskLoadWindowGet() then computes the load of each task
+ * between the latest snapshot and the one taken uxSamples calls earlier.  A
+ * single ring serves several window lengths: polled at 10 Hz, a ring of 101
+ * snapshots gives the load of the last second (uxSamples = 10) and of the last
+ * ten seconds (uxSamples = 100).  Each snapshot must provide room for all the
+ * tasks in the system.  Each sample reads the run time counter, see
+ * xTaskGetRunTimeSnapshot().
+ *
+ * Example usage:
+ * @code{c}
+ *  #define SNAPSHOTS   11
+ *  #define MAX_TASKS   16
+ *
+ *  static TaskRunTime_t xRunTimes[ SNAPSHOTS ][ MAX_TASKS ];
+ *  static TaskRunTimeSnapshot_t xSnapshots[ SNAPSHOTS ];
+ *  static TaskLoadWindow_t xWindow;
+ *  static TaskLoad_t xLoad[ MAX_TASKS ];
+ *
+ *  void vMonitorTask( void * pvParameters )
+ *  {
+ *  UBaseType_t x, uxTasks;
+ *
+ *      for( x = 0; x < SNAPSHOTS; x++ )
+ *      {
+ *          xSnapshots[ x ].pxTaskRunTimeArray = xRunTimes[ x ];
+ *          xSnapshots[ x ].uxArraySize = MAX_TASKS;
+ *      }
+ *      vTaskLoadWindowInitialise( &xWindow, xSnapshots, SNAPSHOTS );
+ *
+ *      for( ;; )
+ *      {
+ *          vTaskDelay( pdMS_TO_TICKS( 100 ) );
+ *          xTaskLoadWindowSample( &xWindow );
+ *
+ *          // Load over the last second.
+ *          uxTasks = uxTaskLoadWindowGet( &xWindow, 10, xLoad, MAX_TASKS );
+ *      }
+ *  }
+ *  @endcode
+ */
+#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configGENERATE_RUN_TIME_STATS == 1 ) )
+    void vTaskLoadWindowInitialise( TaskLoadWindow_t * const pxWindow,
+                                    TaskRunTimeSnapshot_t * const pxSnapshots,
+                                    const UBaseType_t uxNumberOfSnapshots ) PRIVILEGED_FUNCTION;
+    BaseType_t xTaskLoadWindowSample( TaskLoadWindow_t * const pxWindow ) PRIVILEGED_FUNCTION;
+    UBaseType_t uxTaskLoadWindowGet( const TaskLoadWindow_t * const pxWindow,
+                                     UBaseType_t uxSamples,
+                                     TaskLoad_t * const pxTaskLoadArray,
+                                     const UBaseType_t uxArraySize ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * task. h
  * @code{c}
@@ -2494,6 +2900,53 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery ) PRIVILEGED_FUNCTION;
     configRUN_TIME_COUNTER_TYPE ulTaskGetIdleRunTimePercent( void ) PRIVILEGED_FUNCTION;
 #endif
 
+/**
+ * task. h
+ * @code{c}
+ * void vTaskGetJobStats( TaskHandle_t xTask, TaskJobStats_t * pxJobStats );
+ * void vTaskResetJobStats( TaskHandle_t xTask );
+ * @endcode
+ *
+ * configUSE_TASK_JOB_STATS must be defined as 1 for these functions to be
+ * available.
+ *
+ * While ulTaskGetRunTimeCounter() returns the total execution time of a task,
+ * the job statistics break the execution time down into jobs.  A job of a task
+ * starts when the task returns from a call that blocked it, or from
+ * xTaskDelayUntil(), and ends when the task blocks again or calls
+ * xTaskDelayUntil() again.  Only the time the task spends in the Running state
+ * is counted, so time spent preempted by other tasks does not add to a job.
+ * This allows worst case execution time assumptions to be checked on the
+ * target under real load.
+ *
+ * vTaskGetJobStats() copies the statistics of a task into pxJobStats.
+ * vTaskResetJobStats() clears them, for example to start a new measurement
+ * after a change of operating mode.  The job in progress is not affected.
+ *
+ * @param xTask Handle of the task.  Passing NULL uses the calling task.
+ *
+ * @param pxJobStats The structure the statistics are copied into.
+ *
+ * Example usage:
+ * @code{c}
+ * TaskJobStats_t xStats;
+ *
+ * vTaskGetJobStats( xControlTask, &xStats );
+ *
+ * if( xStats.ulMaxExecutionTime > ulWorstCaseBudget )
+ * {
+ *     // The worst case execution time assumption does not hold.
+ * }
+ * @endcode
+ * \defgroup vTaskGetJobStats vTaskGetJobStats
+ * \ingroup TaskUtils
+ */
+#if ( configUSE_TASK_JOB_STATS == 1 )
+    void vTaskGetJobStats( TaskHandle_t xTask,
+                           TaskJobStats_t * pxJobStats ) PRIVILEGED_FUNCTION;
+    void vTaskResetJobStats( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * task. h
  * @code{c}
@@ -3308,6 +3761,91 @@ uint32_t ulTaskGenericNotifyValueClear( TaskHandle_t xTask,
 #define ulTaskNotifyValueClearIndexed( xTask, uxIndexToClear, ulBitsToClear ) \
     ulTaskGenericNotifyValueClear( ( xTask ), ( uxIndexToClear ), ( ulBitsToClear ) )
 
+/**
+ * task. h
+ * @code{c}
+ * BaseType_t xTaskMailboxSend( TaskHandle_t xTaskToNotify, const void * pvMessage, size_t xMessageLength );
+ * @endcode
+ *
+ * configUSE_TASK_MAILBOX must be defined as 1 for this function to be
+ * available.
+ *
+ * Each task has a mailbox that holds a single message of up to
+ * configTASK_MAILBOX_SIZE bytes.  Sending a message copies it into the mailbox
+ * of the receiving task and notifies that task at index
+ * configTASK_MAILBOX_NOTIFICATION_INDEX, so a task blocked in
+ * xTaskMailboxReceive() is unblocked the same way it would be by
+ * xTaskNotifyIndexed().  No queue, queue lock or event list is involved.
+ *
+ * The notification index is reserved for the mailbox.  It must not be used by
+ * any other notification function for a task that receives messages.
+ *
+ * @param xTaskToNotify The handle of the task to send the message to.
+ *
+ * @param pvMessage The message to copy into the mailbox.
+ *
+ * @param xMessageLength The number of bytes to copy, 1 to
+ * configTASK_MAILBOX_SIZE.
+ *
+ * @return pdPASS if the message was copied into the mailbox, pdFAIL if the
+ * mailbox still held a message the task has not received.
+ *
+ * \defgroup xTaskMailboxSend xTaskMailboxSend
+ * \ingroup TaskNotifications
+ */
+BaseType_t xTaskMailboxSend( TaskHandle_t xTaskToNotify,
+                             const void * pvMessage,
+                             size_t xMessageLength ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * @code{c}
+ * BaseType_t xTaskMailboxSendFromISR( TaskHandle_t xTaskToNotify, const void * pvMessage, size_t xMessageLength, BaseType_t * pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * A version of xTaskMailboxSend() that can be used from an interrupt service
+ * routine.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if sending the message
+ * unblocked a task that has a priority above the interrupted task.  The
+ * interrupt should then request a context switch before it exits.
+ *
+ * \defgroup xTaskMailboxSendFromISR xTaskMailboxSendFromISR
+ * \ingroup TaskNotifications
+ */
+BaseType_t xTaskMailboxSendFromISR( TaskHandle_t xTaskToNotify,
+                                    const void * pvMessage,
+                                    size_t xMessageLength,
+                                    BaseType_t * pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * @code{c}
+ * size_t xTaskMailboxReceive( void * pvBuffer, TickType_t xTicksToWait );
+ * @endcode
+ *
+ * configUSE_TASK_MAILBOX must be defined as 1 for this function to be
+ * available.
+ *
+ * Receives the message held in the mailbox of the calling task, waiting for one
+ * to be sent if the mailbox is empty.  Receiving empties the mailbox, so the
+ * next message can be sent.
+ *
+ * @param pvBuffer The buffer the message is copied to.  It must be at least
+ * configTASK_MAILBOX_SIZE bytes long.
+ *
+ * @param xTicksToWait The maximum time to wait in the Blocked state for a
+ * message if the mailbox is empty.
+ *
+ * @return The length of the message copied to pvBuffer, or 0 if no message was
+ * received before xTicksToWait expired.
+ *
+ * \defgroup xTaskMailboxReceive xTaskMailboxReceive
+ * \ingroup TaskNotifications
+ */
+size_t xTaskMailboxReceive( void * pvBuffer,
+                            TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
 /**
  * task.h
  * @code{c}
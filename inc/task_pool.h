@@ -0,0 +1,117 @@
+/*_____________________________________________________________________________
+ │                                                                            |
+ │ COPYRIGHT (C) 2026 Mihai Baneu                                             |
+ │                                                                            |
+ | Permission is hereby  granted,  free of charge,  to any person obtaining a |
+ | copy of this software and associated documentation files (the "Software"), |
+ | to deal in the Software without restriction,  including without limitation |
+ | the rights to  use, copy, modify, merge, publish, distribute,  sublicense, |
+ | and/or sell copies  of  the Software, and to permit  persons to  whom  the |
+ | Software is furnished to do so, subject to the following conditions:       |
+ |                                                                            |
+ | The above  copyright notice  and this permission notice  shall be included |
+ | in all copies or substantial portions of the Software.                     |
+ |                                                                            |
+ | THE SOFTWARE IS PROVIDED  "AS IS",  WITHOUT WARRANTY OF ANY KIND,  EXPRESS |
+ | OR   IMPLIED,   INCLUDING   BUT   NOT   LIMITED   TO   THE  WARRANTIES  OF |
+ | MERCHANTABILITY,  FITNESS FOR  A  PARTICULAR  PURPOSE AND NONINFRINGEMENT. |
+ | IN NO  EVENT SHALL  THE AUTHORS  OR  COPYRIGHT  HOLDERS  BE LIABLE FOR ANY |
+ | CLAIM, DAMAGES OR OTHER LIABILITY,  WHETHER IN AN ACTION OF CONTRACT, TORT |
+ | OR OTHERWISE, ARISING FROM,  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR  |
+ | THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                 |
+ |____________________________________________________________________________|
+ |                                                                            |
+ |  Author: Mihai Baneu                           Last modified: 17.Oct.2026  |
+ |                                                                            |
+ |___________________________________________________________________________*/
+
+#ifndef TASK_POOL_H
+#define TASK_POOL_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h must appear in source files before include task_pool.h"
+#endif
+
+#include "task.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/*
+ * The task pool hands out short lived tasks without creating and deleting them.
+ * configTASK_POOL_SIZE worker tasks, each with a stack of
+ * configTASK_POOL_STACK_DEPTH words, are created once by vTaskStartScheduler()
+ * and then wait on their direct to task notification.  xTaskPoolSpawn() takes
+ * a free worker, gives it the function to run and its priority, and notifies
+ * it.  When the function returns the worker goes back to the pool.
+ *
+ * Spawning a pooled task does not touch the heap and does not initialise a TCB
+ * or a stack, and returning it does not leave any clean up to the idle task.
+ *
+ * The workers are created when configUSE_TASK_POOL is set to 1 in
+ * FreeRTOSConfig.h.
+ */
+
+/**
+ * task_pool. h
+ * @code{c}
+ * BaseType_t xTaskPoolSpawn( TaskFunction_t pxTaskCode,
+ *                            void * pvParameters,
+ *                            UBaseType_t uxPriority,
+ *                            TaskHandle_t * const pxSpawnedTask );
+ * @endcode
+ *
+ * Runs a function in a task taken from the pool.  The function is called with
+ * pvParameters as its only parameter, as the entry function of a task created
+ * with xTaskCreate() is, but unlike a task entry function it must return when
+ * its work is done rather than delete itself.  Returning hands the task back to
+ * the pool.
+ *
+ * The pooled task keeps the name and the stack size of the pool, and goes back
+ * to configTASK_POOL_TASK_PRIORITY when the function returns.  Anything the
+ * function changes about its own task other than the priority, such as the
+ * notification state or the thread local storage pointers, is seen by the next
+ * function that runs in the same task.  The handle must not be used once the
+ * function has returned, as it may already belong to the next spawn.
+ *
+ * Must only be called from a task after the scheduler has been started.
+ *
+ * @param pxTaskCode The function to run.
+ *
+ * @param pvParameters The value passed to the function.
+ *
+ * @param uxPriority The priority at which the pooled task runs the function.
+ *
+ * @param pxSpawnedTask Used to pass back the handle of the pooled task.  This
+ * parameter is optional and can be set to NULL.
+ *
+ * @return pdPASS if a task was taken from the pool, pdFAIL if all the tasks of
+ * the pool are in use.
+ */
+BaseType_t xTaskPoolSpawn( TaskFunction_t pxTaskCode,
+                           void * pvParameters,
+                           UBaseType_t uxPriority,
+                           TaskHandle_t * const pxSpawnedTask ) PRIVILEGED_FUNCTION;
+
+/**
+ * UBaseType_t uxTaskPoolGetFreeTaskCount( void );
+ *
+ * @return The number of tasks of the pool that are not running a function.
+ */
+UBaseType_t uxTaskPoolGetFreeTaskCount( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * Functions beyond this part are not part of the public API and are intended
+ * for use by the kernel only.
+ */
+BaseType_t xTaskPoolCreateTasks( void ) PRIVILEGED_FUNCTION;
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+#endif /* TASK_POOL_H */
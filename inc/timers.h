@@ -89,6 +89,16 @@ typedef void (* TimerCallbackFunction_t)( TimerHandle_t xTimer );
 typedef void (* PendedFunction_t)( void * arg1,
                                    uint32_t arg2 );
 
+/*
+ * One entry of the array of commands passed to xTimerCommandBatch().
+ */
+typedef struct xTIMER_COMMAND
+{
+    TimerHandle_t xTimer;      /**< The timer the command applies to.  Set to NULL by the timer task once the command has been applied. */
+    BaseType_t xCommandID;     /**< tmrCOMMAND_START, tmrCOMMAND_RESET, tmrCOMMAND_STOP, tmrCOMMAND_CHANGE_PERIOD or tmrCOMMAND_DELETE. */
+    TickType_t xOptionalValue; /**< The new period for tmrCOMMAND_CHANGE_PERIOD.  Not used by the other commands. */
+} TimerCommand_t;
+
 /**
  * TimerHandle_t xTimerCreate(  const char * const pcTimerName,
  *                              TickType_t xTimerPeriodInTicks,
@@ -365,6 +375,77 @@ typedef void (* PendedFunction_t)( void * arg1,
                                       StaticTimer_t * pxTimerBuffer ) PRIVILEGED_FUNCTION;
 #endif /* configSUPPORT_STATIC_ALLOCATION */
 
+/**
+ * TimerHandle_t xTimerCreateTickContext(  const char * const pcTimerName,
+ *                                         const TickType_t xTimerPeriodInTicks,
+ *                                         const BaseType_t xAutoReload,
+ *                                         void * const pvTimerID,
+ *                                         TimerCallbackFunction_t pxCallbackFunction );
+ *
+ * TimerHandle_t xTimerCreateTickContextStatic( const char * const pcTimerName,
+ *                                              const TickType_t xTimerPeriodInTicks,
+ *                                              const BaseType_t xAutoReload,
+ *                                              void * const pvTimerID,
+ *                                              TimerCallbackFunction_t pxCallbackFunction,
+ *                                              StaticTimer_t * pxTimerBuffer );
+ *
+ * Create a tick context software timer.  The parameters are the same as for
+ * xTimerCreate() and xTimerCreateStatic().  configUSE_TICK_TIMERS must be set
+ * to 1 in FreeRTOSConfig.h for these functions to be available.
+ *
+ * The callback function of a tick context timer is called directly from the
+ * tick interrupt (from within xTaskIncrementTick()) when the timer expires,
+ * rather than from the timer service task, so it does not have to wait for a
+ * context switch to the timer service task.  In return:
+ *
+ * - the callback normally runs in interrupt context.  It must be short, must
+ *   not block, and may only call API functions that end in "FromISR".  It does
+ *   not need to request a context switch itself, the tick interrupt switches
+ *   to a higher priority task the callback unblocked.
+ *
+ * - the timer is controlled with the usual xTimerStart(), xTimerStop(),
+ *   xTimerReset(), xTimerChangePeriod() and xTimerDelete() functions and their
+ *   FromISR versions.  They are applied immediately within a critical section
+ *   instead of being sent to the timer command queue, so they never block and
+ *   xTicksToWait is ignored.  From within a tick context callback only the
+ *   FromISR versions may be used.
+ *
+ * - the expiry time is only evaluated while the scheduler is running.  Ticks
+ *   that occur while the scheduler is suspended are pended, and xTaskResumeAll()
+ *   processes them when the scheduler is resumed.  A tick context timer that
+ *   expired in the meantime then has its callback called late, in the context
+ *   of the task that called xTaskResumeAll(), within a critical section.  The
+ *   tick count the callback sees is still its expiry tick.  The same rules
+ *   apply - FromISR functions only and no blocking - but the callback must not
+ *   assume it runs in an interrupt, nor that it runs on time: a task that keeps
+ *   the scheduler suspended for n ticks delays it by up to n ticks.
+ *
+ * Checking for expired tick context timers costs the tick interrupt a single
+ * comparison unless a timer is due.  Starting or resetting one is an ordered
+ * list insertion within a critical section, so they are intended for a small
+ * number of short, latency sensitive timers.
+ *
+ * @return If the timer is successfully created then a handle to the newly
+ * created timer is returned.  If the timer cannot be created then NULL is
+ * returned.
+ */
+#if ( ( configUSE_TICK_TIMERS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+    TimerHandle_t xTimerCreateTickContext( const char * const pcTimerName,
+                                           const TickType_t xTimerPeriodInTicks,
+                                           const BaseType_t xAutoReload,
+                                           void * const pvTimerID,
+                                           TimerCallbackFunction_t pxCallbackFunction ) PRIVILEGED_FUNCTION;
+#endif
+
+#if ( ( configUSE_TICK_TIMERS == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+    TimerHandle_t xTimerCreateTickContextStatic( const char * const pcTimerName,
+                                                 const TickType_t xTimerPeriodInTicks,
+                                                 const BaseType_t xAutoReload,
+                                                 void * const pvTimerID,
+                                                 TimerCallbackFunction_t pxCallbackFunction,
+                                                 StaticTimer_t * pxTimerBuffer ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * void *pvTimerGetTimerID( TimerHandle_t xTimer );
  *
@@ -474,6 +555,13 @@ TaskHandle_t xTimerGetTimerDaemonTaskHandle( void ) PRIVILEGED_FUNCTION;
  * associated with the timer will get called 'n' ticks after xTimerStart() was
  * called, where 'n' is the timers defined period.
  *
+ * Timers that expire on the same tick have their callbacks called one after
+ * the other by the timer service task, in the order they were started.  When
+ * configUSE_TIMER_HEAP is set to 1 that order is not kept: the callbacks of
+ * timers due on the same tick are called in an unspecified order, so an
+ * application that relies on it must use a single timer, or chain the work
+ * from one callback to the next.
+ *
  * It is valid to call xTimerStart() before the scheduler has been started, but
  * when this is done the timer will not actually start until the scheduler is
  * started, and the timers expiry time will be relative to when the scheduler is
@@ -1345,6 +1433,61 @@ TickType_t xTimerGetExpiryTime( TimerHandle_t xTimer ) PRIVILEGED_FUNCTION;
                                       StaticTimer_t ** ppxTimerBuffer ) PRIVILEGED_FUNCTION;
 #endif /* configSUPPORT_STATIC_ALLOCATION */
 
+/**
+ * BaseType_t xTimerCommandBatch( TimerCommand_t * const pxCommands,
+ *                                const UBaseType_t uxCommandCount,
+ *                                const TickType_t xTicksToWait );
+ *
+ * Send uxCommandCount timer commands to the timer service task in a single
+ * message on the timer command queue, instead of one message per command as
+ * xTimerStart(), xTimerReset(), xTimerStop(), xTimerChangePeriod() and
+ * xTimerDelete() each send.  configUSE_TIMER_COMMAND_BATCH must be set to 1 in
+ * FreeRTOSConfig.h for this function to be available.
+ *
+ * The commands are not copied: the message only references pxCommands.  The
+ * timer service task applies the commands in array order and sets the xTimer
+ * member of each entry to NULL once the command has been applied, so the array
+ * must stay valid and must not be modified until
+ * xTimerCommandBatchIsComplete() returns pdTRUE.  The start and reset commands
+ * use the tick count at which xTimerCommandBatch() was called as their
+ * reference time, as xTimerStart() and xTimerReset() do.
+ *
+ * When called from the timer service task itself (from a timer callback or a
+ * pended function) the commands are applied before the function returns.
+ *
+ * @param pxCommands The commands to send.
+ *
+ * @param uxCommandCount The number of entries in pxCommands.
+ *
+ * @param xTicksToWait The time the calling task should remain in the Blocked
+ * state to wait for space on the timer command queue.  Ignored if called
+ * before the scheduler is started.
+ *
+ * @return pdPASS if the batch was sent (or applied), pdFAIL if the timer
+ * command queue remained full for xTicksToWait ticks.  On pdFAIL none of the
+ * commands are applied.
+ */
+#if ( configUSE_TIMER_COMMAND_BATCH == 1 )
+    BaseType_t xTimerCommandBatch( TimerCommand_t * const pxCommands,
+                                   const UBaseType_t uxCommandCount,
+                                   const TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * BaseType_t xTimerCommandBatchIsComplete( const TimerCommand_t * const pxCommands,
+ *                                          const UBaseType_t uxCommandCount );
+ *
+ * Query whether the timer service task has applied every command of a batch
+ * sent with xTimerCommandBatch().
+ *
+ * @return pdTRUE if all the commands have been applied and pxCommands can be
+ * reused, otherwise pdFALSE.
+ */
+#if ( configUSE_TIMER_COMMAND_BATCH == 1 )
+    BaseType_t xTimerCommandBatchIsComplete( const TimerCommand_t * const pxCommands,
+                                             const UBaseType_t uxCommandCount ) PRIVILEGED_FUNCTION;
+#endif
+
 /*
  * Functions beyond this part are not part of the public API and are intended
  * for use by the kernel only.
@@ -1373,6 +1516,26 @@ BaseType_t xTimerGenericCommandFromISR( TimerHandle_t xTimer,
     ( ( xCommandID ) < tmrFIRST_FROM_ISR_COMMAND ?                                                                  \
       xTimerGenericCommandFromTask( xTimer, xCommandID, xOptionalValue, pxHigherPriorityTaskWoken, xTicksToWait ) : \
       xTimerGenericCommandFromISR( xTimer, xCommandID, xOptionalValue, pxHigherPriorityTaskWoken, xTicksToWait ) )
+
+#if ( configUSE_TICK_TIMERS == 1 )
+
+/*
+ * Called from xTaskIncrementTick() with the new tick count to call the
+ * callbacks of the tick context timers that expire on this tick.  That is the
+ * tick interrupt, or the task that resumes the scheduler when xTaskResumeAll()
+ * processes the ticks pended while it was suspended.
+ */
+    void vTimerProcessTickTimers( const TickType_t xTickCount ) PRIVILEGED_FUNCTION;
+
+/*
+ * Return the tick count at which the next tick context timer expires, or
+ * portMAX_DELAY if none is due before the tick count overflows.  Used to bound
+ * the tickless idle time.
+ */
+    TickType_t xTimerGetNextTickTimerExpireTime( void ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_TICK_TIMERS */
+
 #if ( configUSE_TRACE_FACILITY == 1 )
     void vTimerSetTimerNumber( TimerHandle_t xTimer,
                                UBaseType_t uxTimerNumber ) PRIVILEGED_FUNCTION;
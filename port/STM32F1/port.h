@@ -58,16 +58,116 @@ extern void vPortServiceHandler(uint32_t *svc_args);
 extern uint32_t uxPortRaisePrivilege(void);
 extern void vPortResetPrivilege(uint32_t priv);
 
+/* tickless idle */
+extern void vPortSuppressTicksAndSleep(uint32_t xExpectedIdleTime);
+extern void vPortTicklessSleep(uint32_t xExpectedIdleTime);
+
 /* critical section handling */
 extern void vPortEnterCritical(void);
 extern void vPortExitCritical(void);
+extern void vPortEnterCriticalPrivileged(void *pvCaller);
+extern void vPortExitCriticalPrivileged(void);
+extern void vPortEnterCriticalFromThread(void *pvCaller);
+extern void vPortExitCriticalFromThread(void);
+
+/* The inlined critical sections save and restore the BASEPRI like the FromISR
+functions so the call and the nesting counter are not needed. The unprivileged
+tasks can not write the BASEPRI, they enter a nested critical section with svc 3
+directly and get back a mask value no BASEPRI can hold. */
+#define portCRITICAL_INLINE_FROM_THREAD 0xFFFFFFFFUL
+
+__attribute__((always_inline)) static inline uint32_t ulPortRaiseBASEPRI(void)
+{
+    uint32_t ulOriginalBASEPRI;
+
+    if( ( __get_IPSR() == 0 ) && ( ( __get_CONTROL() & CONTROL_nPRIV_Msk ) != 0 ) ) {
+        __ASM volatile ("svc 3" : : : "memory");
+        return portCRITICAL_INLINE_FROM_THREAD;
+    }
+
+    ulOriginalBASEPRI = __get_BASEPRI();
+    __set_BASEPRI(configMAX_SYSCALL_INTERRUPT_PRIORITY);
+    __DSB();
+    __ISB();
+    return ulOriginalBASEPRI;
+}
+
+__attribute__((always_inline)) static inline void vPortRestoreBASEPRI(uint32_t ulOriginalBASEPRI)
+{
+    if( ulOriginalBASEPRI == portCRITICAL_INLINE_FROM_THREAD ) {
+        __ASM volatile ("svc 4" : : : "memory");
+    }
+    else {
+        __set_BASEPRI(ulOriginalBASEPRI);
+    }
+}
+
+/* critical section profiling */
+#if configUSE_CRITICAL_SECTION_PROFILER == 1
+#define portCRITICAL_PROFILER_BUCKETS 8
+
+/* masked durations of the critical sections entered from one call site */
+typedef struct {
+    void *pvCaller;                                             /* return address of the vPortEnterCritical() call */
+    uint32_t ulCount;                                           /* number of critical sections entered from here */
+    uint32_t ulMaxCycles;                                       /* longest masked duration in CPU cycles */
+    uint32_t ulHistogram[portCRITICAL_PROFILER_BUCKETS];        /* bucket n counts durations of [4^n, 4^(n+1)) cycles, the last one everything above */
+} PortCriticalSite_t;
+
+/* critical section profile collected by the port */
+typedef struct {
+    void *pvMaxCaller;                                          /* call site of the longest critical section */
+    uint32_t ulMaxCycles;                                       /* longest masked duration in CPU cycles */
+    uint32_t ulDropped;                                         /* critical sections from call sites that did not fit in xSites */
+    uint32_t ulHistogram[portCRITICAL_PROFILER_BUCKETS];        /* masked durations of all the call sites */
+    PortCriticalSite_t xSites[configCRITICAL_SECTION_PROFILER_SITES];
+} PortCriticalProfile_t;
+
+extern void vPortGetCriticalProfile(PortCriticalProfile_t *pxProfile);
+extern void vPortResetCriticalProfile(void);
+#endif
 
 /* validate the priotity of interupts calling FromISR functions */
 extern void vPortValidateInterruptPriority(void);
 
 /* stats gathering function */
 extern void vPortConfigureStatsTimer(void);
+#if configRUN_TIME_COUNTER_WIDTH_IN_BITS == 64
+extern uint64_t vPortGetStatsTimerValue(void);
+extern uint64_t vPortGetStatsTimerValueFromThread(void);
+extern void vPortUpdateStatsTimer(void);
+#else
 extern uint32_t vPortGetStatsTimerValue(void);
+extern uint32_t vPortGetStatsTimerValueFromThread(void);
+#endif
+
+/* boot profiler */
+#if configUSE_BOOT_PROFILER == 1
+/* named time stamp of the boot profile */
+typedef struct {
+    const char *pcName;                                         /* name of the mark */
+    uint32_t ulCycles;                                          /* CPU cycles since the profiler was started */
+} PortBootMark_t;
+
+/* boot profile collected by the port */
+typedef struct {
+    PortBootMark_t xMarks[configBOOT_PROFILER_MARKS];
+    uint32_t ulNumberOfMarks;                                   /* valid entries in xMarks */
+    uint32_t ulDroppedMarks;                                    /* marks that did not fit in xMarks */
+    uint32_t ulStackPaintCycles;                                /* time spent painting the stacks of the tasks created before the first task started */
+    uint32_t ulStackPaintCount;                                 /* number of stacks painted before the first task started */
+} PortBootProfile_t;
+
+extern void vPortBootProfilerStart(void);
+extern void vPortBootProfilerMark(const char *pcName);
+extern void vPortBootProfilerPaintBegin(void);
+extern void vPortBootProfilerPaintEnd(void);
+extern void vPortBootProfilerFirstTask(void);
+extern void vPortBootProfilerRebase(void);
+extern uint32_t ulPortBootProfilerCycles(void);
+extern uint32_t ulPortBootProfilerCyclesFromThread(void);
+extern const PortBootProfile_t *pxPortGetBootProfile(void);
+#endif
 
 /* service calls */
 extern void vPortSendChar(char c);
@@ -21,10 +21,11 @@
  | THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                 |
  |____________________________________________________________________________|
  |                                                                            |
- |  Author: Mihai Baneu                           Last modified: 08.Feb.2023  |
+ |  Author: Mihai Baneu                           Last modified: 17.Oct.2026  |
  |  Based on original M4 port from http://www.FreeRTOS.org                    |
  |___________________________________________________________________________*/
 
+#include <string.h>
 #include "port.h"
 #include "task.h"
 
@@ -35,6 +36,15 @@ UBaseType_t uxCriticalNesting = 0XAAAAAAAA;
 /* store th maxsyscall interupt priority into a variable for global access */
 const uint32_t uxMaxSyscallPriority = configMAX_SYSCALL_INTERRUPT_PRIORITY;
 
+#if configUSE_CRITICAL_SECTION_PROFILER == 1
+/* profile of the critical sections */
+static PortCriticalProfile_t xCriticalProfile;
+
+/* start of the current outermost critical section */
+static void *pvCriticalCaller;
+static uint32_t ulCriticalStart;
+#endif
+
 /**
  * @brief This is the startup of the scheduler. All necessary HW for the RTOS is
  * prepared and configured.
@@ -56,12 +66,22 @@ BaseType_t xPortStartScheduler(void)
     /* make SVC higher in priority than the syscall */
     NVIC_SetPriority(SVCall_IRQn, NVIC_EncodePriority(NVIC_GetPriorityGrouping(), ((configMAX_SYSCALL_INTERRUPT_PRIORITY - 1) >> (8U - __NVIC_PRIO_BITS)), 0U));
 
+#if configUSE_CRITICAL_SECTION_PROFILER == 1
+    /* the critical sections are timed with the cycle counter */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
     /* Initialise the critical nesting count ready for the first task. */
     uxCriticalNesting = 0;
 
     /* start the timer that generates the tick ISR - interupts are disabled */
     vPortConfigureSysTick();
 
+#if configUSE_BOOT_PROFILER == 1
+    vPortBootProfilerFirstTask();
+#endif
+
     /* start the first task */
     vPortStartFirstTask();
 
@@ -91,26 +111,145 @@ void vPortEndScheduler(void)
 /**
  * @brief Enter a critical section.
  *
- * Interupts are disabled.
+ * Interupts are disabled. The tasks run unprivileged and their writes to the
+ * BASEPRI are ignored, so their critical sections are entered from the
+ * Supervisor Call handler (svc 3).
  *
  */
 void __attribute__((section(".time_critical.vPortEnterCritical"))) vPortEnterCritical(void)
 {
-    portDISABLE_INTERRUPTS();
-    uxCriticalNesting++;
+    if( ( __get_IPSR() == 0 ) && ( ( __get_CONTROL() & CONTROL_nPRIV_Msk ) != 0 ) ) {
+        vPortEnterCriticalFromThread(__builtin_return_address(0));
+    }
+    else {
+        vPortEnterCriticalPrivileged(__builtin_return_address(0));
+    }
 }
 
 /**
  * @brief Exit a critical section.
  *
- * If the nexting is 0 then the interupts get enabled.
+ * If the nexting is 0 then the interupts get enabled. The unprivileged tasks
+ * leave their critical sections from the Supervisor Call handler (svc 4).
  *
  */
 void __attribute__((section(".time_critical.vPortExitCritical"))) vPortExitCritical(void)
 {
+    if( ( __get_IPSR() == 0 ) && ( ( __get_CONTROL() & CONTROL_nPRIV_Msk ) != 0 ) ) {
+        vPortExitCriticalFromThread();
+    }
+    else {
+        vPortExitCriticalPrivileged();
+    }
+}
+
+/**
+ * @brief Enter a critical section from a privileged mode. With the profiler the
+ * outermost critical section is timed.
+ *
+ * @param pvCaller return address of the vPortEnterCritical() call
+ */
+void __attribute__((section(".time_critical.vPortEnterCriticalPrivileged"))) vPortEnterCriticalPrivileged(void *pvCaller)
+{
+    portDISABLE_INTERRUPTS();
+    uxCriticalNesting++;
+#if configUSE_CRITICAL_SECTION_PROFILER == 1
+    if( uxCriticalNesting == 1 ) {
+        pvCriticalCaller = pvCaller;
+        ulCriticalStart = DWT->CYCCNT;
+    }
+#else
+    (void) pvCaller;
+#endif
+}
+
+/**
+ * @brief Exit a critical section from a privileged mode. With the profiler the
+ * masked duration of the outermost one is recorded.
+ *
+ * The call site is looked up in a small open addressing table keyed by the
+ * return address. The bookkeeping is done before the interrupts are enabled but
+ * after the cycle counter is sampled so it does not show up in the profile.
+ *
+ */
+void __attribute__((section(".time_critical.vPortExitCriticalPrivileged"))) vPortExitCriticalPrivileged(void)
+{
+#if configUSE_CRITICAL_SECTION_PROFILER == 1
+    uint32_t ulCycles, ulBucket, ulIndex, ulProbe;
+    PortCriticalSite_t *pxSite;
+#endif
+
     configASSERT(uxCriticalNesting);
     uxCriticalNesting--;
     if( uxCriticalNesting == 0 ) {
+#if configUSE_CRITICAL_SECTION_PROFILER == 1
+        ulCycles = DWT->CYCCNT - ulCriticalStart;
+
+        /* logarithmic bucket with base 4 */
+        ulBucket = (31UL - __CLZ(ulCycles | 1UL)) >> 1;
+        if( ulBucket >= portCRITICAL_PROFILER_BUCKETS ) {
+            ulBucket = portCRITICAL_PROFILER_BUCKETS - 1;
+        }
+
+        xCriticalProfile.ulHistogram[ulBucket]++;
+        if( ulCycles > xCriticalProfile.ulMaxCycles ) {
+            xCriticalProfile.ulMaxCycles = ulCycles;
+            xCriticalProfile.pvMaxCaller = pvCriticalCaller;
+        }
+
+        /* find the slot of the call site or claim a free one */
+        ulIndex = (((uint32_t) pvCriticalCaller) >> 1) % configCRITICAL_SECTION_PROFILER_SITES;
+        pxSite = NULL;
+        for( ulProbe = 0; ulProbe < configCRITICAL_SECTION_PROFILER_SITES; ulProbe++ ) {
+            if( xCriticalProfile.xSites[ulIndex].pvCaller == pvCriticalCaller ) {
+                pxSite = &xCriticalProfile.xSites[ulIndex];
+                break;
+            }
+            if( xCriticalProfile.xSites[ulIndex].pvCaller == NULL ) {
+                pxSite = &xCriticalProfile.xSites[ulIndex];
+                pxSite->pvCaller = pvCriticalCaller;
+                break;
+            }
+            ulIndex = (ulIndex + 1) % configCRITICAL_SECTION_PROFILER_SITES;
+        }
+
+        if( pxSite != NULL ) {
+            pxSite->ulCount++;
+            pxSite->ulHistogram[ulBucket]++;
+            if( ulCycles > pxSite->ulMaxCycles ) {
+                pxSite->ulMaxCycles = ulCycles;
+            }
+        }
+        else {
+            xCriticalProfile.ulDropped++;
+        }
+#endif
+
         portENABLE_INTERRUPTS();
     }
 }
+
+#if configUSE_CRITICAL_SECTION_PROFILER == 1
+/**
+ * @brief Get a consistent copy of the critical section profile.
+ *
+ * @param pxProfile buffer receiving the profile
+ */
+void vPortGetCriticalProfile(PortCriticalProfile_t *pxProfile)
+{
+    vPortEnterCritical();
+    *pxProfile = xCriticalProfile;
+    vPortExitCritical();
+}
+
+/**
+ * @brief Clear the critical section profile.
+ *
+ */
+void vPortResetCriticalProfile(void)
+{
+    vPortEnterCritical();
+    memset(&xCriticalProfile, 0, sizeof(xCriticalProfile));
+    vPortExitCritical();
+}
+#endif
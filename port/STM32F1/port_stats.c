@@ -21,7 +21,7 @@
  | THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                 |
  |____________________________________________________________________________|
  |                                                                            |
- |  Author: Mihai Baneu                           Last modified: 26.Jan.2021  |
+ |  Author: Mihai Baneu                           Last modified: 17.Oct.2026  |
  |  Based on original M4 port from http://www.FreeRTOS.org                    |
  |___________________________________________________________________________*/
 
@@ -29,35 +29,103 @@
 #include "portmacro.h"
 #include "task.h"
 
+#if configRUN_TIME_COUNTER_WIDTH_IN_BITS == 64
+/* upper 32 bits of the software extended cycle counter */
+static volatile uint32_t ulStatsTimerHigh = 0;
+
+/* cycle counter value seen at the last update - used to detect the overflow */
+static volatile uint32_t ulStatsTimerLast = 0;
+#endif
 
 void vPortConfigureStatsTimer(void)
 {
     CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
     DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#if configUSE_BOOT_PROFILER == 1
+    vPortBootProfilerRebase();
+#endif
     DWT->CYCCNT = 0;
 }
 
-uint32_t vPortGetStatsTimerValue(void)
+#if configRUN_TIME_COUNTER_WIDTH_IN_BITS == 64
+/**
+ * @brief Track the overflow of the cycle counter.
+ *
+ * Called from the SysTick interrupt. The SysTick counts the CPU clock with a 24
+ * bit reload (also in tickless mode), so it always runs at least once between
+ * two overflows of the 32 bit cycle counter.
+ */
+void __attribute__((section(".time_critical.vPortUpdateStatsTimer"))) vPortUpdateStatsTimer(void)
 {
-    return DWT->CYCCNT;
+    uint32_t ulCycles = DWT->CYCCNT;
+
+    if( ulCycles < ulStatsTimerLast ) {
+        ulStatsTimerHigh++;
+    }
+    ulStatsTimerLast = ulCycles;
 }
 
-uint32_t vPortGetRunTimeStats(TaskStatus_t *pxTaskStatusArray, UBaseType_t *uxArraySize)
+/**
+ * @brief Get the 64 bit extended cycle counter.
+ *
+ * The value is consistent even if the SysTick interrupts the read. An overflow
+ * that happened since the last SysTick is accounted for here. The unprivileged
+ * tasks can not access the DWT, they get the value from the Supervisor Call
+ * handler.
+ */
+uint64_t __attribute__((section(".time_critical.vPortGetStatsTimerValue"))) vPortGetStatsTimerValue(void)
 {
-    uint32_t ulTotalTime;
+    uint32_t ulHigh, ulLast, ulCycles;
 
-    /* Take a snapshot of the number of tasks in case it changes while this
-    function is executing. */
-    *uxArraySize = uxTaskGetNumberOfTasks();
+    if( ( __get_IPSR() == 0 ) && ( ( __get_CONTROL() & CONTROL_nPRIV_Msk ) != 0 ) ) {
+        return vPortGetStatsTimerValueFromThread();
+    }
 
-    /* Allocate an array index for each task.  NOTE!  If
-    configSUPPORT_DYNAMIC_ALLOCATION is set to 0 then pvPortMalloc() will
-    equate to NULL. */
-    pxTaskStatusArray = pvPortMalloc((*uxArraySize) * sizeof(TaskStatus_t));
+    do {
+        ulHigh = ulStatsTimerHigh;
+        ulLast = ulStatsTimerLast;
+        ulCycles = DWT->CYCCNT;
+    } while( ulHigh != ulStatsTimerHigh );
 
-    if( pxTaskStatusArray != NULL ) {
-        *uxArraySize = uxTaskGetSystemState(pxTaskStatusArray, (*uxArraySize), &ulTotalTime);
+    if( ulCycles < ulLast ) {
+        ulHigh++;
     }
 
+    return ( ( uint64_t ) ulHigh << 32 ) | ulCycles;
+}
+#else
+/**
+ * @brief Get the cycle counter.
+ *
+ * The unprivileged tasks can not access the DWT, they get the value from the
+ * Supervisor Call handler.
+ */
+uint32_t __attribute__((section(".time_critical.vPortGetStatsTimerValue"))) vPortGetStatsTimerValue(void)
+{
+    if( ( __get_IPSR() == 0 ) && ( ( __get_CONTROL() & CONTROL_nPRIV_Msk ) != 0 ) ) {
+        return vPortGetStatsTimerValueFromThread();
+    }
+
+    return DWT->CYCCNT;
+}
+#endif
+
+/**
+ * @brief Get the cumulative run time stats of all tasks.
+ *
+ * The caller supplies the array, nothing is allocated. This also reports the
+ * stack high water marks, which keeps the scheduler suspended while the stacks
+ * are scanned - for periodic monitoring use the load window API in task.h.
+ *
+ * @param pxTaskStatusArray array that receives the status of each task
+ * @param uxArraySize in: number of entries in the array, out: number of tasks reported (0 if the array is too small)
+ * @return configRUN_TIME_COUNTER_TYPE total run time
+ */
+configRUN_TIME_COUNTER_TYPE vPortGetRunTimeStats(TaskStatus_t *pxTaskStatusArray, UBaseType_t *uxArraySize)
+{
+    configRUN_TIME_COUNTER_TYPE ulTotalTime = 0;
+
+    *uxArraySize = uxTaskGetSystemState(pxTaskStatusArray, *uxArraySize, &ulTotalTime);
+
     return ulTotalTime;
 }
\ No newline at end of file
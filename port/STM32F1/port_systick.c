@@ -21,7 +21,7 @@
  | THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                 |
  |____________________________________________________________________________|
  |                                                                            |
- |  Author: Mihai Baneu                           Last modified: 08.Jan.2021  |
+ |  Author: Mihai Baneu                           Last modified: 17.Oct.2026  |
  |  Based on original M4 port from http://www.FreeRTOS.org                    |
  |___________________________________________________________________________*/
 
@@ -31,6 +31,22 @@
 
 extern unsigned int system_cpu_f();
 
+#if configUSE_TICKLESS_IDLE == 1
+/* a fiddle factor to estimate the number of SysTick counts that would have
+occurred while the SysTick counter is stopped during tickless idle calculations */
+#define portMISSED_COUNTS_FACTOR            94UL
+
+/* number of SysTick counts that make up one tick period */
+static uint32_t ulTimerCountsForOneTick = 0;
+
+/* maximum number of tick periods that can be suppressed - limited by the 24 bit
+resolution of the SysTick timer */
+static uint32_t xMaximumPossibleSuppressedTicks = 0;
+
+/* compensate for the CPU cycles that pass while the SysTick is stopped */
+static uint32_t ulStoppedTimerCompensation = 0;
+#endif
+
 /**
  * @brief Setup the systick timer to generate the tick interrupts at the required frequency.
  *
@@ -47,6 +63,19 @@ void vPortConfigureSysTick(void)
     /* configure SysTick to interrupt at the requested rate. */
     SysTick->LOAD = ( configCPU_CLOCK_HZ / configTICK_RATE_HZ ) - 1UL;
     SysTick->CTRL = ( SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk );
+
+#if configUSE_TICKLESS_IDLE == 1
+    /* calculate the constants required to configure the tick interrupt - the
+    CPU clock is only known at run time */
+    ulTimerCountsForOneTick = ( configCPU_CLOCK_HZ / configTICK_RATE_HZ );
+    xMaximumPossibleSuppressedTicks = SysTick_LOAD_RELOAD_Msk / ulTimerCountsForOneTick;
+    ulStoppedTimerCompensation = portMISSED_COUNTS_FACTOR;
+
+    /* the tickless sleep waits in the SVC handler, where only the interrupts
+    above the SVC priority would wake a WFI. With SEVONPEND every interrupt that
+    becomes pending wakes a WFE */
+    SCB->SCR |= SCB_SCR_SEVONPEND_Msk;
+#endif
 }
 
 /**
@@ -61,6 +90,11 @@ void __attribute__((section(".time_critical.SysTick_Handler"))) SysTick_Handler(
 {
     portDISABLE_INTERRUPTS();
     {
+#if ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configRUN_TIME_COUNTER_WIDTH_IN_BITS == 64 )
+        /* keep track of the cycle counter overflows */
+        vPortUpdateStatsTimer();
+#endif
+
         /* increment the RTOS tick. If necessary trigger a context switch using
         the PendSV interrupt */
         if( xTaskIncrementTick() != pdFALSE ) {
@@ -70,3 +104,163 @@ void __attribute__((section(".time_critical.SysTick_Handler"))) SysTick_Handler(
     }
     portENABLE_INTERRUPTS();
 }
+
+#if configUSE_TICKLESS_IDLE == 1
+/**
+ * @brief Stop the tick interrupt and sleep for the expected idle time.
+ *
+ * Called by the idle task with the scheduler suspended. The SysTick is reloaded
+ * so that the next interrupt fires when the next task has to be unblocked, the
+ * CPU sleeps and on wakeup the tick count is stepped forward by the number of
+ * complete tick periods that have elapsed. The partial tick period is carried
+ * over into the reload value so no drift is accumulated.
+ *
+ * The idle task runs unprivileged and can not access the SysTick/SCB registers
+ * or the PRIMASK. It calls vPortSuppressTicksAndSleep(), a dedicated service
+ * call (svc 2), and this function is executed by the SVC handler. The CPU waits
+ * with WFE, the interrupt that ends the sleep is served once the service call
+ * returns. configPRE_SLEEP_PROCESSING() and configPOST_SLEEP_PROCESSING() run
+ * here as well, in handler mode with PRIMASK set, and can not use the FreeRTOS
+ * API.
+ *
+ * @param xExpectedIdleTime number of ticks until the next task has to run
+ */
+void vPortTicklessSleep(TickType_t xExpectedIdleTime)
+{
+    uint32_t ulReloadValue, ulCompleteTickPeriods, ulCompletedSysTickDecrements, ulSysTickDecrementsLeft;
+    TickType_t xModifiableIdleTime;
+
+    /* make sure the SysTick reload value does not overflow the counter */
+    if( xExpectedIdleTime > xMaximumPossibleSuppressedTicks ) {
+        xExpectedIdleTime = xMaximumPossibleSuppressedTicks;
+    }
+
+    /* enter a critical section but don't use the taskENTER_CRITICAL() method as
+    that will mask interrupts that should exit sleep mode */
+    __disable_irq();
+    __DSB();
+    __ISB();
+
+    /* if a context switch is pending or a task is waiting for the scheduler to
+    be unsuspended then abandon the low power entry */
+    if( eTaskConfirmSleepModeStatus() == eAbortSleep ) {
+        __enable_irq();
+        return;
+    }
+
+    /* stop the SysTick momentarily - the time the SysTick is stopped for is
+    accounted for through ulStoppedTimerCompensation */
+    SysTick->CTRL = ( SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk );
+
+    /* number of SysTick decrements remaining until the next tick interrupt. If
+    the current value is zero there is a full tick period left, not zero, because
+    the SysTick requests the interrupt when decrementing from 1 to 0 */
+    ulSysTickDecrementsLeft = SysTick->VAL;
+    if( ulSysTickDecrementsLeft == 0 ) {
+        ulSysTickDecrementsLeft = ulTimerCountsForOneTick;
+    }
+
+    /* calculate the reload value required to wait xExpectedIdleTime tick
+    periods. -1 is used because this code normally executes part way through the
+    first tick period. If the SysTick interrupt is already pending then clear it,
+    suppressing the first tick, and correct the reload value to reflect that the
+    second tick period is already underway */
+    ulReloadValue = ulSysTickDecrementsLeft + ( ulTimerCountsForOneTick * ( xExpectedIdleTime - 1UL ) );
+    if( ( SCB->ICSR & SCB_ICSR_PENDSTSET_Msk ) != 0 ) {
+        SCB->ICSR = SCB_ICSR_PENDSTCLR_Msk;
+        ulReloadValue -= ulTimerCountsForOneTick;
+    }
+
+    if( ulReloadValue > ulStoppedTimerCompensation ) {
+        ulReloadValue -= ulStoppedTimerCompensation;
+    }
+
+    /* set the new reload value, clear the count flag and restart the SysTick */
+    SysTick->LOAD = ulReloadValue;
+    SysTick->VAL  = 0UL;
+    SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+
+    /* sleep until something happens. configPRE_SLEEP_PROCESSING() can set its
+    parameter to 0 to indicate that its implementation contains its own wait
+    for event instruction, and so wfe should not be executed again - it runs in
+    handler mode, a wait for interrupt there would not wake up for the kernel
+    interrupts. The original expected idle time must remain unmodified */
+    xModifiableIdleTime = xExpectedIdleTime;
+    configPRE_SLEEP_PROCESSING(xModifiableIdleTime);
+    if( xModifiableIdleTime > 0 ) {
+        /* clear an event left over from before, then only wait if no interrupt
+        became pending meanwhile. One that becomes pending later sets the event
+        again and the wfe returns at once */
+        __SEV();
+        __WFE();
+        if( ( SCB->ICSR & SCB_ICSR_VECTPENDING_Msk ) == 0 ) {
+            __DSB();
+            __WFE();
+            __ISB();
+        }
+    }
+    configPOST_SLEEP_PROCESSING(xExpectedIdleTime);
+
+    /* re-enable interrupts to allow the interrupts above the SVC priority to
+    execute immediately, the others stay pending until the service call returns */
+    __enable_irq();
+    __DSB();
+    __ISB();
+
+    /* disable interrupts again because the clock is about to be stopped and
+    interrupts that execute while the clock is stopped will increase the drift
+    between the time maintained by the RTOS and the calendar time */
+    __disable_irq();
+    __DSB();
+    __ISB();
+
+    /* stop the SysTick without reading the CTRL register to ensure the count
+    flag is not cleared if it is set */
+    SysTick->CTRL = ( SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk );
+
+    if( ( SysTick->CTRL & SysTick_CTRL_COUNTFLAG_Msk ) != 0 ) {
+        uint32_t ulCalculatedLoadValue;
+
+        /* the tick interrupt ended the sleep (or is now pending) and a new tick
+        period has started. Reload the SysTick with whatever remains of the new
+        tick period */
+        ulCalculatedLoadValue = ( ulTimerCountsForOneTick - 1UL ) - ( ulReloadValue - SysTick->VAL );
+
+        /* don't allow a tiny value, or values that have somehow underflowed
+        because the post sleep hook did something that took too long or because
+        the SysTick current value is zero */
+        if( ( ulCalculatedLoadValue <= ulStoppedTimerCompensation ) || ( ulCalculatedLoadValue > ulTimerCountsForOneTick ) ) {
+            ulCalculatedLoadValue = ( ulTimerCountsForOneTick - 1UL );
+        }
+
+        SysTick->LOAD = ulCalculatedLoadValue;
+
+        /* as the pending tick will be processed as soon as this function exits,
+        the tick count is stepped forward by one less than the time spent waiting */
+        ulCompleteTickPeriods = xExpectedIdleTime - 1UL;
+    }
+    else {
+        /* something other than the tick interrupt ended the sleep - work out how
+        long the sleep lasted rounded to complete tick periods */
+        ulSysTickDecrementsLeft = SysTick->VAL;
+        ulCompletedSysTickDecrements = ( xExpectedIdleTime * ulTimerCountsForOneTick ) - ulSysTickDecrementsLeft;
+        ulCompleteTickPeriods = ulCompletedSysTickDecrements / ulTimerCountsForOneTick;
+
+        /* the reload value is set to whatever fraction of a single tick period
+        remains */
+        SysTick->LOAD = ( ( ulCompleteTickPeriods + 1UL ) * ulTimerCountsForOneTick ) - ulCompletedSysTickDecrements;
+    }
+
+    /* restart the SysTick so it runs from the calculated reload value, then set
+    the reload back to its standard value - it will be used from the next period */
+    SysTick->VAL  = 0UL;
+    SysTick->CTRL = ( SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk );
+    SysTick->LOAD = ulTimerCountsForOneTick - 1UL;
+
+    /* step the tick to account for any tick periods that elapsed */
+    vTaskStepTick(ulCompleteTickPeriods);
+
+    /* exit with interrupts enabled */
+    __enable_irq();
+}
+#endif
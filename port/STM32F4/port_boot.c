@@ -0,0 +1,184 @@
+/*_____________________________________________________________________________
+ │                                                                            |
+ │ COPYRIGHT (C) 2023 Mihai Baneu                                             |
+ │                                                                            |
+ | Permission is hereby  granted,  free of charge,  to any person obtaining a |
+ | copy of this software and associated documentation files (the "Software"), |
+ | to deal in the Software without restriction,  including without limitation |
+ | the rights to  use, copy, modify, merge, publish, distribute,  sublicense, |
+ | and/or sell copies  of  the Software, and to permit  persons to  whom  the |
+ | Software is furnished to do so, subject to the following conditions:       |
+ |                                                                            |
+ | The above  copyright notice  and this permission notice  shall be included |
+ | in all copies or substantial portions of the Software.                     |
+ |                                                                            |
+ | THE SOFTWARE IS PROVIDED  "AS IS",  WITHOUT WARRANTY OF ANY KIND,  EXPRESS |
+ | OR   IMPLIED,   INCLUDING   BUT   NOT   LIMITED   TO   THE  WARRANTIES  OF |
+ | MERCHANTABILITY,  FITNESS FOR  A  PARTICULAR  PURPOSE AND NONINFRINGEMENT. |
+ | IN NO  EVENT SHALL  THE AUTHORS  OR  COPYRIGHT  HOLDERS  BE LIABLE FOR ANY |
+ | CLAIM, DAMAGES OR OTHER LIABILITY,  WHETHER IN AN ACTION OF CONTRACT, TORT |
+ | OR OTHERWISE, ARISING FROM,  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR  |
+ | THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                 |
+ |____________________________________________________________________________|
+ |                                                                            |
+ |  Author: Mihai Baneu                           Last modified: 17.Oct.2026  |
+ |  Based on original M4 port from http://www.FreeRTOS.org                    |
+ |___________________________________________________________________________*/
+
+#include "port.h"
+#include "portmacro.h"
+#include "task.h"
+
+#if configUSE_BOOT_PROFILER == 1
+/* boot profile table */
+static PortBootProfile_t xBootProfile;
+
+/* cycles counted before the last reset of the cycle counter */
+static uint32_t ulBootCycleOffset = 0;
+
+/* start of the stack painting in progress */
+static uint32_t ulBootPaintStart;
+
+/* the accounting of the stack painting stops with the first task */
+static uint32_t ulBootFirstTaskStarted = 0;
+
+/**
+ * @brief Read the boot time in cycles.
+ *
+ * Must be executed privileged, the unprivileged tasks can not access the DWT.
+ * They read the boot time through ulPortBootProfilerCyclesFromThread(), which
+ * is served by the SVC handler.
+ *
+ */
+uint32_t ulPortBootProfilerCycles(void)
+{
+    if( ( DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk ) == 0 ) {
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    }
+    return ulBootCycleOffset + DWT->CYCCNT;
+}
+
+/**
+ * @brief Read the boot time in cycles from any mode.
+ *
+ */
+static uint32_t prvBootCycles(void)
+{
+    if( ( __get_IPSR() == 0 ) && ( ( __get_CONTROL() & CONTROL_nPRIV_Msk ) != 0 ) ) {
+        return ulPortBootProfilerCyclesFromThread();
+    }
+    return ulPortBootProfilerCycles();
+}
+
+/**
+ * @brief Start the boot profiler.
+ *
+ * Optional. Call it first thing in main() (or from the reset handler) so the
+ * time base starts at 0 there. Without it the cycle counter is enabled by the
+ * first mark. The 32 bit cycle counter wraps after 2^32 CPU cycles, the boot has
+ * to be shorter than that.
+ *
+ */
+void vPortBootProfilerStart(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    DWT->CYCCNT = 0;
+
+    ulBootCycleOffset = 0;
+    xBootProfile.ulNumberOfMarks = 0;
+    xBootProfile.ulDroppedMarks = 0;
+    xBootProfile.ulStackPaintCycles = 0;
+    xBootProfile.ulStackPaintCount = 0;
+
+    vPortBootProfilerMark("start");
+}
+
+/**
+ * @brief Record a named time stamp in the boot profile.
+ *
+ * The kernel records the start of its boot phases, the application can add its
+ * own marks. The name is stored by reference and must stay valid.
+ *
+ * @param pcName name of the mark
+ */
+void vPortBootProfilerMark(const char *pcName)
+{
+    uint32_t ulCycles = prvBootCycles();
+    uint32_t ulMask;
+
+    /* also used with the interrupts disabled by vTaskStartScheduler() */
+    ulMask = portSET_INTERRUPT_MASK_FROM_ISR();
+    if( xBootProfile.ulNumberOfMarks < configBOOT_PROFILER_MARKS ) {
+        xBootProfile.xMarks[xBootProfile.ulNumberOfMarks].pcName = pcName;
+        xBootProfile.xMarks[xBootProfile.ulNumberOfMarks].ulCycles = ulCycles;
+        xBootProfile.ulNumberOfMarks++;
+    }
+    else {
+        xBootProfile.ulDroppedMarks++;
+    }
+    portCLEAR_INTERRUPT_MASK_FROM_ISR(ulMask);
+}
+
+/**
+ * @brief Start timing the painting of a new task stack.
+ *
+ */
+void vPortBootProfilerPaintBegin(void)
+{
+    if( ulBootFirstTaskStarted == 0 ) {
+        ulBootPaintStart = prvBootCycles();
+    }
+}
+
+/**
+ * @brief Add the painting of a new task stack to the boot profile.
+ *
+ * Only the tasks created before the first task starts are accounted.
+ *
+ */
+void vPortBootProfilerPaintEnd(void)
+{
+    if( ulBootFirstTaskStarted == 0 ) {
+        xBootProfile.ulStackPaintCycles += prvBootCycles() - ulBootPaintStart;
+        xBootProfile.ulStackPaintCount++;
+    }
+}
+
+/**
+ * @brief Record the start of the first task, the end of the boot.
+ *
+ * Called by xPortStartScheduler() with the interrupts disabled.
+ *
+ */
+void vPortBootProfilerFirstTask(void)
+{
+    vPortBootProfilerMark("vPortStartFirstTask");
+    ulBootFirstTaskStarted = 1;
+}
+
+/**
+ * @brief Carry the boot time over a reset of the cycle counter.
+ *
+ * Called before the run time stats clear the cycle counter.
+ *
+ */
+void vPortBootProfilerRebase(void)
+{
+    ulBootCycleOffset += DWT->CYCCNT;
+}
+
+/**
+ * @brief Get the boot profile.
+ *
+ * The marks are in the order they were recorded, the time stamps are CPU cycles
+ * since vPortBootProfilerStart() or since the first mark.
+ *
+ * @return the boot profile table
+ */
+const PortBootProfile_t *pxPortGetBootProfile(void)
+{
+    return &xBootProfile;
+}
+#endif
@@ -21,7 +21,7 @@
  | THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                 |
  |____________________________________________________________________________|
  |                                                                            |
- |  Author: Mihai Baneu                           Last modified: 08.Jan.2021  |
+ |  Author: Mihai Baneu                           Last modified: 17.Oct.2026  |
  |  Based on original M4 port from http://www.FreeRTOS.org                    |
  |___________________________________________________________________________*/
 
@@ -84,6 +84,12 @@ typedef unsigned long UBaseType_t;
 #define portYIELD_FROM_ISR() 					vPortYieldFromISR();
 /*-----------------------------------------------------------*/
 
+/* Tickless idle/low power functionality. */
+#if configUSE_TICKLESS_IDLE == 1
+	#define portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime ) vPortSuppressTicksAndSleep( xExpectedIdleTime )
+#endif
+/*-----------------------------------------------------------*/
+
 /* Critical section management. */
 #define portSET_INTERRUPT_MASK_FROM_ISR()		__get_BASEPRI();__set_BASEPRI(configMAX_SYSCALL_INTERRUPT_PRIORITY);__DSB();__ISB()
 #define portCLEAR_INTERRUPT_MASK_FROM_ISR(x)	__set_BASEPRI(x)
@@ -91,6 +97,14 @@ typedef unsigned long UBaseType_t;
 #define portENABLE_INTERRUPTS()					__set_BASEPRI(0)
 #define portENTER_CRITICAL()					vPortEnterCritical()
 #define portEXIT_CRITICAL()						vPortExitCritical()
+
+/* Inlined critical sections for the kernel regions that do not nest a
+vPortEnterCritical() one. The profiler only times the out of line critical
+sections, so these are not used when it is on. */
+#if configUSE_CRITICAL_SECTION_PROFILER != 1
+	#define portENTER_CRITICAL_INLINE()			ulPortRaiseBASEPRI()
+	#define portEXIT_CRITICAL_INLINE(x)			vPortRestoreBASEPRI(x)
+#endif
 /*-----------------------------------------------------------*/
 
  /* macros used to allow port/compiler specific language extensions.*/
@@ -105,8 +119,8 @@ typedef unsigned long UBaseType_t;
 
 #if configUSE_PORT_OPTIMISED_TASK_SELECTION == 1
 	/* check the configuration. */
-	#if( configMAX_PRIORITIES > 32 )
-		#error configUSE_PORT_OPTIMISED_TASK_SELECTION can only be set to 1 when configMAX_PRIORITIES is less than or equal to 32.  It is very rare that a system requires more than 10 to 15 difference priorities as tasks that share a priority will time slice.
+	#if( configMAX_PRIORITIES > 1024 )
+		#error configUSE_PORT_OPTIMISED_TASK_SELECTION can only be set to 1 when configMAX_PRIORITIES is less than or equal to 1024.  Above 32 priorities the kernel uses these macros on a two level bitmap of 32 groups of 32 priorities.
 	#endif
 
 	/* Store/clear the ready priorities in a bit map. */
@@ -129,6 +143,17 @@ typedef unsigned long UBaseType_t;
 	#define portGET_RUN_TIME_COUNTER_VALUE()         vPortGetStatsTimerValue()
 #endif
 
+#if configRUN_TIME_COUNTER_WIDTH_IN_BITS == 64
+	#define configRUN_TIME_COUNTER_TYPE              uint64_t
+#endif
+
+/* boot profiler */
+#if configUSE_BOOT_PROFILER == 1
+	#define portBOOT_PROFILER_MARK( pcName )         vPortBootProfilerMark( pcName )
+	#define portBOOT_PROFILER_STACK_PAINT_BEGIN()    vPortBootProfilerPaintBegin()
+	#define portBOOT_PROFILER_STACK_PAINT_END()      vPortBootProfilerPaintEnd()
+#endif
+
 #ifdef __cplusplus
 }
 #endif
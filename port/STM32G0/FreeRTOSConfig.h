@@ -64,6 +64,14 @@
  * priority. */
 #define configMAX_PRIORITIES                       16
 
+/* Set configUSE_EDF_SCHEDULING to 1 to schedule the Ready state tasks of priority
+ * configEDF_PRIORITY earliest deadline first instead of round robin.  A task joins
+ * with vTaskSetDeadline() and is released periodically with xTaskDelayUntil(),
+ * each release setting its absolute deadline.  Tasks of other priorities are
+ * scheduled as before.  Defaults to 0 if left undefined. */
+#define configUSE_EDF_SCHEDULING                   0
+#define configEDF_PRIORITY                         ( configMAX_PRIORITIES / 2 )
+
 /* configMINIMAL_STACK_SIZE defines the size of the stack used by the Idle task
  * (in words, not in bytes!).  The kernel does not use this constant for any other
  * purpose.  Demo applications use the constant to make the demos somewhat portable
@@ -90,6 +98,15 @@
  * TickType_t to be defined (typedef'ed) as an unsigned 64-bit type. */
 #define configTICK_TYPE_WIDTH_IN_BITS              TICK_TYPE_WIDTH_32_BITS
 
+/* Set configUSE_DELAYED_TASK_WHEEL to 1 to hold Blocked state tasks with short
+ * timeouts in a hierarchical timing wheel instead of the sorted delayed list.
+ * Each of the configDELAYED_TASK_WHEEL_LEVELS levels has 32 slots, so timeouts of
+ * up to 32 ^ configDELAYED_TASK_WHEEL_LEVELS ticks are inserted and expired in
+ * constant time.  Longer timeouts still use the sorted delayed list.  Defaults to
+ * 0 if left undefined. */
+#define configUSE_DELAYED_TASK_WHEEL               0
+#define configDELAYED_TASK_WHEEL_LEVELS            2
+
 /* Set configIDLE_SHOULD_YIELD to 1 to have the Idle task yield to an
  * application task if there is an Idle priority (priority 0) application task that
  * can run.  Set to 0 to have the Idle task use all of its timeslice.  Default to 1
@@ -102,6 +119,14 @@
  * left undefined. */
 #define configTASK_NOTIFICATION_ARRAY_ENTRIES      1
 
+/* Set configUSE_TASK_MAILBOX to 1 to give each task a mailbox holding one
+ * message of up to configTASK_MAILBOX_SIZE bytes (a multiple of 4), sent with
+ * xTaskMailboxSend() and received with xTaskMailboxReceive().  The mailbox
+ * reserves notification index configTASK_MAILBOX_NOTIFICATION_INDEX, which
+ * defaults to the last index of the array.  Defaults to 0 if left undefined. */
+#define configUSE_TASK_MAILBOX                     0
+#define configTASK_MAILBOX_SIZE                    16
+
 /* configQUEUE_REGISTRY_SIZE sets the maximum number of queues and semaphores
  * that can be referenced from the queue registry.  Only required when using a
  * kernel aware debugger.  Defaults to 0 if left undefined. */
@@ -188,6 +213,56 @@
  * if configUSE_TIMERS is set to 1. */
 #define configTIMER_QUEUE_LENGTH                   10
 
+/* Set configUSE_TIMER_HEAP to 1 to keep the active software timers in a pairing
+ * heap instead of a sorted list, so starting, resetting or stopping a timer costs
+ * O(1) or O(log n) in the timer task rather than O(number of active timers).
+ * Timers that expire on the same tick are then not called in the order they
+ * were started.  Defaults to 0 if left undefined.  Only used if configUSE_TIMERS
+ * is set to 1. */
+#define configUSE_TIMER_HEAP                       0
+
+/* Set configUSE_TICK_TIMERS to 1 to include xTimerCreateTickContext(), software
+ * timers whose callbacks run from the tick interrupt instead of the timer task.
+ * Their callbacks must not block and may only call FromISR API functions.  A
+ * callback due while the scheduler is suspended runs late, from xTaskResumeAll()
+ * in the task that resumes the scheduler.  Defaults to 0 if left undefined.
+ * Only used if configUSE_TIMERS is set to 1. */
+#define configUSE_TICK_TIMERS                      0
+
+/* Set configUSE_TIMER_COMMAND_BATCH to 1 to include xTimerCommandBatch(), which
+ * sends any number of timer commands to the timer task in one queue message, and
+ * to have timer commands issued from the timer task itself (from timer callbacks
+ * or pended functions) applied directly instead of being queued.  Defaults to 0
+ * if left undefined.  Only used if configUSE_TIMERS is set to 1. */
+#define configUSE_TIMER_COMMAND_BATCH              0
+
+/* Set configUSE_DEFERRED_WORK to 1 to include the deferred interrupt work queue
+ * (deferred_work.h) in the build.  Interrupts post work to one of
+ * configDEFERRED_WORK_LANES lanes, each served by its own worker task, without
+ * going through the timer task.  Defaults to 0 if left undefined. */
+#define configUSE_DEFERRED_WORK                    0
+
+/* configDEFERRED_WORK_LANES sets the number of lanes.  The worker of lane 0
+ * runs at configDEFERRED_WORK_TASK_PRIORITY, each following lane one priority
+ * lower.  configDEFERRED_WORK_QUEUE_LENGTH is the number of work items a lane
+ * can hold and must be a power of two.  Only used if configUSE_DEFERRED_WORK is
+ * set to 1. */
+#define configDEFERRED_WORK_LANES                  2
+#define configDEFERRED_WORK_QUEUE_LENGTH           16
+#define configDEFERRED_WORK_TASK_PRIORITY          ( configMAX_PRIORITIES - 1 )
+#define configDEFERRED_WORK_TASK_STACK_DEPTH       configMINIMAL_STACK_SIZE
+
+/* Set configUSE_TASK_POOL to 1 to include the task pool (task_pool.h) in the
+ * build.  configTASK_POOL_SIZE tasks with a stack of configTASK_POOL_STACK_DEPTH
+ * words are created when the scheduler starts and xTaskPoolSpawn() runs a
+ * function in one of them without creating a task.  The tasks go back to
+ * configTASK_POOL_TASK_PRIORITY when the function returns.  Defaults to 0 if
+ * left undefined. */
+#define configUSE_TASK_POOL                        0
+#define configTASK_POOL_SIZE                       4
+#define configTASK_POOL_STACK_DEPTH                configMINIMAL_STACK_SIZE
+#define configTASK_POOL_TASK_PRIORITY              ( configMAX_PRIORITIES - 1 )
+
 
 /******************************************************************************/
 /* Memory allocation related definitions. *************************************/
@@ -262,6 +337,23 @@
  * to 0 if left undefined. */
 #define configCHECK_FOR_STACK_OVERFLOW               1
 
+/* Set configUSE_PARTIAL_STACK_PAINTING to 1 to fill only the
+ * configSTACK_PAINT_DEPTH words at the limit of a new task stack with the known
+ * value, instead of the whole stack, so creating tasks with large stacks is
+ * faster.  The stack high water mark is then not counted past the painted band,
+ * so it reports at most configSTACK_PAINT_DEPTH words - a lower bound of the
+ * space that was never used.  Defaults to 0 if left undefined. */
+#define configUSE_PARTIAL_STACK_PAINTING             0
+#define configSTACK_PAINT_DEPTH                      64
+
+/* Set configUSE_IDLE_STACK_SCAN to 1 to have the idle task scan the stacks of
+ * all the tasks in turn and cache the high water mark of each task, so a monitor
+ * task can read them all cheaply with uxTaskGetStackHighWaterMarks().  Each pass
+ * of the idle task scans at most configIDLE_STACK_SCAN_WORDS words with the
+ * scheduler suspended.  Defaults to 0 if left undefined. */
+#define configUSE_IDLE_STACK_SCAN                    0
+#define configIDLE_STACK_SCAN_WORDS                  64
+
 
 /******************************************************************************/
 /* Run time and task stats gathering related definitions. *********************/
@@ -273,6 +365,40 @@
  * if left undefined.  See https://www.freertos.org/rtos-run-time-stats.html. */
 #define configGENERATE_RUN_TIME_STATS                0
 
+/* Set configUSE_TASK_BUDGETS to 1 to include vTaskSetBudget(), which limits a
+ * task to a budget of run time counter units every period of ticks.  A task that
+ * uses up its budget is suspended, or demoted to priority
+ * configTASK_BUDGET_BACKGROUND_PRIORITY, until the budget is replenished at the
+ * start of its next period.  Requires configGENERATE_RUN_TIME_STATS.  Defaults to
+ * 0 if left undefined. */
+#define configUSE_TASK_BUDGETS                       0
+#define configTASK_BUDGET_BACKGROUND_PRIORITY        tskIDLE_PRIORITY
+
+/* Set configUSE_TASK_JOB_STATS to 1 to have the kernel measure, with the run time
+ * counter, the execution time of each job of each task.  A job runs from one
+ * blocking call (or call to xTaskDelayUntil()) of the task to the next.  The
+ * count, minimum, maximum, total and a log2 histogram of the job execution times
+ * are read with vTaskGetJobStats().  Requires configGENERATE_RUN_TIME_STATS.
+ * Defaults to 0 if left undefined. */
+#define configUSE_TASK_JOB_STATS                     0
+
+/* Number of histogram bins of the job statistics.  Bin n counts the jobs that
+ * took 2 ^ ( n + configTASK_JOB_STATS_HISTOGRAM_SHIFT ) up to twice that many run
+ * time counter units, the first bin also counts shorter jobs and the last bin
+ * longer jobs. */
+#define configTASK_JOB_STATS_HISTOGRAM_BINS          16
+#define configTASK_JOB_STATS_HISTOGRAM_SHIFT         8
+
+/* Set configUSE_TASK_OVERRUN_STATS to 1 to have xTaskDelayUntil() detect the
+ * periods in which a task missed its next release, that is the calls made when
+ * the next wake time had already been reached.  The number of overruns and the
+ * largest lateness in ticks of each task are reported by vTaskGetInfo() and
+ * uxTaskGetSystemState().  Set configUSE_TASK_OVERRUN_HOOK to 1 as well to have
+ * vApplicationTaskOverrunHook() called on every overrun.  Both default to 0 if
+ * left undefined. */
+#define configUSE_TASK_OVERRUN_STATS                 0
+#define configUSE_TASK_OVERRUN_HOOK                  0
+
 /* Set configUSE_TRACE_FACILITY to include additional task structure members
  * are used by trace and visualisation functions and tools.  Set to 0 to exclude
  * the additional information from the structures. Defaults to 0 if left
@@ -59,6 +59,11 @@ extern void vPortRestoreInterrupts(uint32_t mask);
 extern void vPortEnterCritical(void);
 extern void vPortExitCritical(void);
 
+/* tickless idle */
+extern void vPortSuppressTicksAndSleep(uint32_t xExpectedIdleTime);
+
 /* stats gathering function */
 extern void vPortConfigureStatsTimer(void);
 extern uint32_t vPortGetStatsTimerValue(void);
+extern void vPortUpdateStatsTimer(void);
+extern void vPortStepStatsTimer(uint32_t ulTicks);
@@ -51,25 +51,16 @@ void __attribute__((section(".time_critical.vPortYieldFromISR"))) vPortYieldFrom
 
 /**
  * @brief Handler for the Supervisor Call.
- * 
- * @param svc_args 
+ *
+ * Only the service calls that are not dispatched directly by the SVC_Handler
+ * end up here: starting the first task (svc 0) and yield (svc 1) never leave
+ * the assembly handler. The tasks run privileged on this port so it has no
+ * other service calls, unknown numbers are ignored.
+ *
+ * @param svc_args
  */
 void __attribute__((section(".time_critical.vPortServiceHandler"))) vPortServiceHandler(uint32_t *svc_args)
 {
-    uint8_t svc_number = ((char *) svc_args[6])[-2]; //Memory[(Stacked PC)-2]
-    // r0 = svc_args[0];
-    // r1 = svc_args[1];
-    // r2 = svc_args[2];
-    // r3 = svc_args[3];
-
-    switch (svc_number)
-    {
-        case 0:
-            vPortSetFirstTaskContext();
-            break;
-        case 1:
-            vPortYieldFromISR();
-            break;
-    }
+    (void) svc_args;
 }
 
@@ -0,0 +1,114 @@
+/*_____________________________________________________________________________
+ │                                                                            |
+ │ COPYRIGHT (C) 2023 Mihai Baneu                                             |
+ │                                                                            |
+ | Permission is hereby  granted,  free of charge,  to any person obtaining a |
+ | copy of this software and associated documentation files (the "Software"), |
+ | to deal in the Software without restriction,  including without limitation |
+ | the rights to  use, copy, modify, merge, publish, distribute,  sublicense, |
+ | and/or sell copies  of  the Software, and to permit  persons to  whom  the |
+ | Software is furnished to do so, subject to the following conditions:       |
+ |                                                                            |
+ | The above  copyright notice  and this permission notice  shall be included |
+ | in all copies or substantial portions of the Software.                     |
+ |                                                                            |
+ | THE SOFTWARE IS PROVIDED  "AS IS",  WITHOUT WARRANTY OF ANY KIND,  EXPRESS |
+ | OR   IMPLIED,   INCLUDING   BUT   NOT   LIMITED   TO   THE  WARRANTIES  OF |
+ | MERCHANTABILITY,  FITNESS FOR  A  PARTICULAR  PURPOSE AND NONINFRINGEMENT. |
+ | IN NO  EVENT SHALL  THE AUTHORS  OR  COPYRIGHT  HOLDERS  BE LIABLE FOR ANY |
+ | CLAIM, DAMAGES OR OTHER LIABILITY,  WHETHER IN AN ACTION OF CONTRACT, TORT |
+ | OR OTHERWISE, ARISING FROM,  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR  |
+ | THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                 |
+ |____________________________________________________________________________|
+ |                                                                            |
+ |  Author: Mihai Baneu                           Last modified: 17.Oct.2026  |
+ |  Based on original M4 port from http://www.FreeRTOS.org                    |
+ |___________________________________________________________________________*/
+
+#include "port.h"
+#include "portmacro.h"
+#include "core_cm0plus.h"
+#include "task.h"
+
+extern unsigned int system_cpu_f();
+
+/* Cortex-M0+ has no DWT cycle counter, the run time stats clock is built from the
+SysTick instead: the CPU cycles of all the completed tick periods plus the cycles
+already counted down in the current one. */
+
+/* number of SysTick counts that make up one tick period */
+static uint32_t ulStatsCountsPerTick = 0;
+
+/* cycles of all the completed tick periods - maintained by the SysTick handler */
+static volatile uint32_t ulStatsTimerBase = 0;
+
+void vPortConfigureStatsTimer(void)
+{
+    /* called before the scheduler configures the SysTick */
+    ulStatsCountsPerTick = ( configCPU_CLOCK_HZ / configTICK_RATE_HZ );
+    ulStatsTimerBase = 0;
+}
+
+/**
+ * @brief Account one completed tick period.
+ *
+ * Called from the SysTick interrupt.
+ */
+void __attribute__((section(".time_critical.vPortUpdateStatsTimer"))) vPortUpdateStatsTimer(void)
+{
+    ulStatsTimerBase += ulStatsCountsPerTick;
+}
+
+/**
+ * @brief Account the tick periods suppressed by the tickless idle.
+ *
+ * @param ulTicks number of complete tick periods the tick count was stepped by
+ */
+void vPortStepStatsTimer(uint32_t ulTicks)
+{
+    ulStatsTimerBase += ulTicks * ulStatsCountsPerTick;
+}
+
+/**
+ * @brief Get the run time stats clock in CPU cycles.
+ *
+ * If the SysTick has already wrapped but its interrupt is still pending (the
+ * caller runs at the same or higher priority, e.g. PendSV) the new tick period
+ * is accounted for here. Like the DWT cycle counter of the other ports the
+ * value wraps at 32 bits.
+ */
+uint32_t __attribute__((section(".time_critical.vPortGetStatsTimerValue"))) vPortGetStatsTimerValue(void)
+{
+    uint32_t ulMask, ulBase, ulCounts;
+
+    ulMask = ulPortDisableInterrupts();
+    ulBase = ulStatsTimerBase;
+    ulCounts = SysTick->VAL;
+    if( ( SCB->ICSR & SCB_ICSR_PENDSTSET_Msk ) != 0 ) {
+        ulCounts = SysTick->VAL;
+        ulBase += ulStatsCountsPerTick;
+    }
+    vPortRestoreInterrupts(ulMask);
+
+    return ulBase + ( ulStatsCountsPerTick - 1UL - ulCounts );
+}
+
+#if configUSE_TRACE_FACILITY == 1
+/**
+ * @brief Get the cumulative run time stats of all tasks.
+ *
+ * The caller supplies the array, nothing is allocated.
+ *
+ * @param pxTaskStatusArray array that receives the status of each task
+ * @param uxArraySize in: number of entries in the array, out: number of tasks reported (0 if the array is too small)
+ * @return configRUN_TIME_COUNTER_TYPE total run time
+ */
+configRUN_TIME_COUNTER_TYPE vPortGetRunTimeStats(TaskStatus_t *pxTaskStatusArray, UBaseType_t *uxArraySize)
+{
+    configRUN_TIME_COUNTER_TYPE ulTotalTime = 0;
+
+    *uxArraySize = uxTaskGetSystemState(pxTaskStatusArray, *uxArraySize, &ulTotalTime);
+
+    return ulTotalTime;
+}
+#endif
@@ -176,8 +176,33 @@ SVC_Handler:
 2:
     mrs r0, psp
 3:
+    /* get the svc number: Memory[(Stacked PC)-2] - M0+ has no negative offsets */
+    ldr r1, [r0, #24]
+    subs r1, #2
+    ldrb r1, [r1]
+
+    /* the kernel service calls are dispatched from here - M0+ has no table
+    branch, so compare in the order of frequency */
+    cmp r1, #1
+    beq 5f
+    cmp r1, #0
+    beq 4f
+
+    /* all the others are forwarded to C for service */
     ldr r3, =vPortServiceHandler
     bx r3
+4:
+    /* svc 0 - start the first task */
+    ldr r3, =vPortSetFirstTaskContext
+    bx r3
+5:
+    /* svc 1 - yield: pend the PendSV interrupt, context switching is performed there */
+    ldr r0, =0xE000ED04
+    ldr r1, =0x10000000
+    str r1, [r0]
+    dsb
+    isb
+    bx lr
 
 .size SVC_Handler, .-SVC_Handler
 
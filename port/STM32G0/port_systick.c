@@ -21,7 +21,7 @@
  | THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                 |
  |____________________________________________________________________________|
  |                                                                            |
- |  Author: Mihai Baneu                           Last modified: 08.Jan.2021  |
+ |  Author: Mihai Baneu                           Last modified: 17.Oct.2026  |
  |  Based on original M4 port from http://www.FreeRTOS.org                    |
  |___________________________________________________________________________*/
 
@@ -32,6 +32,22 @@
 
 extern unsigned int system_cpu_f();
 
+#if configUSE_TICKLESS_IDLE == 1
+/* a fiddle factor to estimate the number of SysTick counts that would have
+occurred while the SysTick counter is stopped during tickless idle calculations */
+#define portMISSED_COUNTS_FACTOR            94UL
+
+/* number of SysTick counts that make up one tick period */
+static uint32_t ulTimerCountsForOneTick = 0;
+
+/* maximum number of tick periods that can be suppressed - limited by the 24 bit
+resolution of the SysTick timer */
+static uint32_t xMaximumPossibleSuppressedTicks = 0;
+
+/* compensate for the CPU cycles that pass while the SysTick is stopped */
+static uint32_t ulStoppedTimerCompensation = 0;
+#endif
+
 /**
  * @brief Setup the systick timer to generate the tick interrupts at the required frequency.
  *
@@ -48,6 +64,14 @@ void vPortConfigureSysTick(void)
     /* configure SysTick to interrupt at the requested rate. */
     SysTick->LOAD = ( configCPU_CLOCK_HZ / configTICK_RATE_HZ ) - 1UL;
     SysTick->CTRL = ( SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk );
+
+#if configUSE_TICKLESS_IDLE == 1
+    /* calculate the constants required to configure the tick interrupt - the
+    CPU clock is only known at run time */
+    ulTimerCountsForOneTick = ( configCPU_CLOCK_HZ / configTICK_RATE_HZ );
+    xMaximumPossibleSuppressedTicks = SysTick_LOAD_RELOAD_Msk / ulTimerCountsForOneTick;
+    ulStoppedTimerCompensation = portMISSED_COUNTS_FACTOR;
+#endif
 }
 
 /**
@@ -62,6 +86,11 @@ void __attribute__((section(".time_critical.SysTick_Handler"))) SysTick_Handler(
 {
     portDISABLE_INTERRUPTS();
     {
+#if configGENERATE_RUN_TIME_STATS == 1
+        /* account the completed tick period in the run time stats clock */
+        vPortUpdateStatsTimer();
+#endif
+
         /* increment the RTOS tick. If necessary trigger a context switch using
         the PendSV interrupt */
         if( xTaskIncrementTick() != pdFALSE ) {
@@ -71,3 +100,140 @@ void __attribute__((section(".time_critical.SysTick_Handler"))) SysTick_Handler(
     }
     portENABLE_INTERRUPTS();
 }
+
+#if configUSE_TICKLESS_IDLE == 1
+/**
+ * @brief Stop the tick interrupt and sleep for the expected idle time.
+ *
+ * Called by the idle task with the scheduler suspended. The SysTick is reloaded
+ * so that the next interrupt fires when the next task has to be unblocked, the
+ * CPU sleeps with WFI and on wakeup the tick count is stepped forward by the
+ * number of complete tick periods that have elapsed.
+ *
+ * The SysTick reload register is only 24 bits wide, so at 64MHz and 1kHz tick
+ * rate at most 262 ticks can be suppressed at once. Longer idle periods are
+ * split: the idle task calls this function again after the tick is processed.
+ *
+ * @param xExpectedIdleTime number of ticks until the next task has to run
+ */
+void vPortSuppressTicksAndSleep(TickType_t xExpectedIdleTime)
+{
+    uint32_t ulReloadValue, ulCompleteTickPeriods, ulCompletedSysTickDecrements, ulSysTickDecrementsLeft;
+    TickType_t xModifiableIdleTime;
+    uint32_t ulMask;
+
+    /* make sure the SysTick reload value does not overflow the 24 bit counter */
+    if( xExpectedIdleTime > xMaximumPossibleSuppressedTicks ) {
+        xExpectedIdleTime = xMaximumPossibleSuppressedTicks;
+    }
+
+    /* enter a critical section through PRIMASK - pending interrupts still wake
+    the core from WFI, they just don't execute until the mask is restored */
+    ulMask = ulPortDisableInterrupts();
+    __DSB();
+    __ISB();
+
+    /* if a context switch is pending or a task is waiting for the scheduler to
+    be unsuspended then abandon the low power entry */
+    if( eTaskConfirmSleepModeStatus() == eAbortSleep ) {
+        vPortRestoreInterrupts(ulMask);
+        return;
+    }
+
+    /* stop the SysTick momentarily - the time the SysTick is stopped for is
+    accounted for through ulStoppedTimerCompensation */
+    SysTick->CTRL = ( SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk );
+
+    /* number of SysTick decrements remaining until the next tick interrupt. If
+    the current value is zero there is a full tick period left, not zero, because
+    the SysTick requests the interrupt when decrementing from 1 to 0 */
+    ulSysTickDecrementsLeft = SysTick->VAL;
+    if( ulSysTickDecrementsLeft == 0 ) {
+        ulSysTickDecrementsLeft = ulTimerCountsForOneTick;
+    }
+
+    /* calculate the reload value required to wait xExpectedIdleTime tick
+    periods. If the SysTick interrupt is already pending then clear it,
+    suppressing the first tick, and correct the reload value to reflect that the
+    second tick period is already underway */
+    ulReloadValue = ulSysTickDecrementsLeft + ( ulTimerCountsForOneTick * ( xExpectedIdleTime - 1UL ) );
+    if( ( SCB->ICSR & SCB_ICSR_PENDSTSET_Msk ) != 0 ) {
+        SCB->ICSR = SCB_ICSR_PENDSTCLR_Msk;
+        ulReloadValue -= ulTimerCountsForOneTick;
+    }
+
+    if( ulReloadValue > ulStoppedTimerCompensation ) {
+        ulReloadValue -= ulStoppedTimerCompensation;
+    }
+
+    /* set the new reload value, clear the count flag and restart the SysTick */
+    SysTick->LOAD = ulReloadValue;
+    SysTick->VAL  = 0UL;
+    SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+
+    /* sleep until something happens. configPRE_SLEEP_PROCESSING() can set its
+    parameter to 0 to indicate that it already contains its own wait for
+    interrupt instruction */
+    xModifiableIdleTime = xExpectedIdleTime;
+    configPRE_SLEEP_PROCESSING(xModifiableIdleTime);
+    if( xModifiableIdleTime > 0 ) {
+        __DSB();
+        __WFI();
+        __ISB();
+    }
+    configPOST_SLEEP_PROCESSING(xExpectedIdleTime);
+
+    /* let the interrupt that brought the MCU out of sleep mode execute and mask
+    the interrupts again before the SysTick is stopped */
+    vPortRestoreInterrupts(ulMask);
+    __ISB();
+    ulPortDisableInterrupts();
+    __ISB();
+
+    /* stop the SysTick without reading the CTRL register to ensure the count
+    flag is not cleared if it is set */
+    SysTick->CTRL = ( SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk );
+
+    if( ( SysTick->CTRL & SysTick_CTRL_COUNTFLAG_Msk ) != 0 ) {
+        uint32_t ulCalculatedLoadValue;
+
+        /* the tick interrupt ended the sleep (or is now pending) and a new tick
+        period has started. Reload the SysTick with whatever remains of it */
+        ulCalculatedLoadValue = ( ulTimerCountsForOneTick - 1UL ) - ( ulReloadValue - SysTick->VAL );
+
+        /* don't allow a tiny value or values that have underflowed */
+        if( ( ulCalculatedLoadValue <= ulStoppedTimerCompensation ) || ( ulCalculatedLoadValue > ulTimerCountsForOneTick ) ) {
+            ulCalculatedLoadValue = ( ulTimerCountsForOneTick - 1UL );
+        }
+
+        SysTick->LOAD = ulCalculatedLoadValue;
+
+        /* the pending tick will be processed as soon as this function exits */
+        ulCompleteTickPeriods = xExpectedIdleTime - 1UL;
+    }
+    else {
+        /* something other than the tick interrupt ended the sleep - work out how
+        long the sleep lasted rounded to complete tick periods */
+        ulSysTickDecrementsLeft = SysTick->VAL;
+        ulCompletedSysTickDecrements = ( xExpectedIdleTime * ulTimerCountsForOneTick ) - ulSysTickDecrementsLeft;
+        ulCompleteTickPeriods = ulCompletedSysTickDecrements / ulTimerCountsForOneTick;
+
+        /* the reload value is set to whatever fraction of a tick period remains */
+        SysTick->LOAD = ( ( ulCompleteTickPeriods + 1UL ) * ulTimerCountsForOneTick ) - ulCompletedSysTickDecrements;
+    }
+
+    /* restart the SysTick so it runs from the calculated reload value, then set
+    the reload back to its standard value - it will be used from the next period */
+    SysTick->VAL  = 0UL;
+    SysTick->CTRL = ( SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk );
+    SysTick->LOAD = ulTimerCountsForOneTick - 1UL;
+
+    /* step the tick to account for any tick periods that elapsed */
+    vTaskStepTick(ulCompleteTickPeriods);
+#if configGENERATE_RUN_TIME_STATS == 1
+    vPortStepStatsTimer(ulCompleteTickPeriods);
+#endif
+
+    vPortRestoreInterrupts(ulMask);
+}
+#endif
@@ -21,7 +21,7 @@
  | THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                 |
  |____________________________________________________________________________|
  |                                                                            |
- |  Author: Mihai Baneu                           Last modified: 08.Jan.2021  |
+ |  Author: Mihai Baneu                           Last modified: 17.Oct.2026  |
  |  Based on original M4 port from http://www.FreeRTOS.org                    |
  |___________________________________________________________________________*/
 
@@ -76,6 +76,12 @@ typedef unsigned long UBaseType_t;
 #define portYIELD_FROM_ISR() 					vPortYieldFromISR();
 /*-----------------------------------------------------------*/
 
+/* Tickless idle/low power functionality. */
+#if configUSE_TICKLESS_IDLE == 1
+	#define portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime ) vPortSuppressTicksAndSleep( xExpectedIdleTime )
+#endif
+/*-----------------------------------------------------------*/
+
 /* Critical section management. */
 #define portSET_INTERRUPT_MASK_FROM_ISR()		ulPortDisableInterrupts(); vTaskEnterCritical()
 #define portCLEAR_INTERRUPT_MASK_FROM_ISR(x)	vTaskExitCritical(); vPortRestoreInterrupts(x)
@@ -100,14 +106,35 @@ typedef unsigned long UBaseType_t;
 
 #if configUSE_PORT_OPTIMISED_TASK_SELECTION == 1
 	/* check the configuration. */
-	#if( configMAX_PRIORITIES > 32 )
-		#error configUSE_PORT_OPTIMISED_TASK_SELECTION can only be set to 1 when configMAX_PRIORITIES is less than or equal to 32.  It is very rare that a system requires more than 10 to 15 difference priorities as tasks that share a priority will time slice.
+	#if( configMAX_PRIORITIES > 1024 )
+		#error configUSE_PORT_OPTIMISED_TASK_SELECTION can only be set to 1 when configMAX_PRIORITIES is less than or equal to 1024.  Above 32 priorities the kernel uses these macros on a two level bitmap of 32 groups of 32 priorities.
 	#endif
 
 	/* Store/clear the ready priorities in a bit map. */
 	#define portRECORD_READY_PRIORITY( uxPriority, uxReadyPriorities )    ( uxReadyPriorities ) |= ( 1UL << ( uxPriority ) )
 	#define portRESET_READY_PRIORITY( uxPriority, uxReadyPriorities )     ( uxReadyPriorities ) &= ~( 1UL << ( uxPriority ) )
-	#define portGET_HIGHEST_PRIORITY( uxTopPriority, uxReadyPriorities )  uxTopPriority = ( 31UL - ( uint32_t ) __builtin_clz( ( uxReadyPriorities ) ) )
+	#define portGET_HIGHEST_PRIORITY( uxTopPriority, uxReadyPriorities )  uxTopPriority = ulPortGetHighestPriority( ( uxReadyPriorities ) )
+
+	/* The Cortex-M0+ has no CLZ instruction and __builtin_clz() would call the
+	software __clzsi2() on every context switch. Instead smear the highest set bit
+	into all the lower bits and map the result to its bit number with a De Bruijn
+	multiply and a 32 entry table - branch free and the same few cycles for any
+	bit map. */
+	static portFORCE_INLINE uint32_t ulPortGetHighestPriority(uint32_t ulReadyPriorities)
+	{
+		static const uint8_t ucBitPosition[32] = {
+			0,  9,  1, 10, 13, 21,  2, 29, 11, 14, 16, 18, 22, 25,  3, 30,
+			8, 12, 20, 28, 15, 17, 24,  7, 19, 27, 23,  6, 26,  5,  4, 31
+		};
+
+		ulReadyPriorities |= ulReadyPriorities >> 1;
+		ulReadyPriorities |= ulReadyPriorities >> 2;
+		ulReadyPriorities |= ulReadyPriorities >> 4;
+		ulReadyPriorities |= ulReadyPriorities >> 8;
+		ulReadyPriorities |= ulReadyPriorities >> 16;
+
+		return ucBitPosition[(uint32_t)(ulReadyPriorities * 0x07C4ACDDUL) >> 27];
+	}
 
 #endif /* configUSE_PORT_OPTIMISED_TASK_SELECTION */
 
@@ -51,8 +51,12 @@ void __attribute__((section(".time_critical.vPortYieldFromISR"))) vPortYieldFrom
 
 /**
  * @brief Handler for the Supervisor Call.
- * 
- * @param svc_args 
+ *
+ * Only the service calls that are not dispatched directly by the SVC_Handler
+ * end up here: starting the first task (svc 0), yield (svc 1) and the critical
+ * sections of the unprivileged tasks (svc 3 and 4) never get here.
+ *
+ * @param svc_args
  */
 void __attribute__((section(".time_critical.vPortServiceHandler"))) vPortServiceHandler(uint32_t *svc_args)
 {
@@ -64,12 +68,28 @@ void __attribute__((section(".time_critical.vPortServiceHandler"))) vPortService
 
     switch (svc_number)
     {
-        case 0:
-            vPortSetFirstTaskContext();
+#if configUSE_TICKLESS_IDLE == 1
+        case 2:
+            vPortTicklessSleep(svc_args[0]);
+            break;
+#endif
+#if configGENERATE_RUN_TIME_STATS == 1
+        case 5: {
+#if configRUN_TIME_COUNTER_WIDTH_IN_BITS == 64
+            uint64_t ulValue = vPortGetStatsTimerValue();
+            svc_args[0] = (uint32_t) ulValue;
+            svc_args[1] = (uint32_t) (ulValue >> 32);
+#else
+            svc_args[0] = vPortGetStatsTimerValue();
+#endif
             break;
-        case 1:
-            vPortYieldFromISR();
+        }
+#endif
+#if configUSE_BOOT_PROFILER == 1
+        case 6:
+            svc_args[0] = ulPortBootProfilerCycles();
             break;
+#endif
         case 55:
             ITM_SendChar(svc_args[0]);
             break;
@@ -61,6 +61,84 @@ vPortResetPrivilege:
 
 .size vPortResetPrivilege, .-vPortResetPrivilege
 
+/*-----------------------------------------------------------*/
+/*                 vPortSuppressTicksAndSleep                */
+/*-----------------------------------------------------------*/
+.section .text.vPortSuppressTicksAndSleep, "ax", %progbits
+.global vPortSuppressTicksAndSleep
+.type vPortSuppressTicksAndSleep, %function
+
+/* The tickless idle is entered from the unprivileged idle task. The SysTick and
+the PRIMASK can not be accessed from there, so the whole sleep step is executed
+by the Supervisor Call handler (vPortTicklessSleep). r0 holds the expected idle
+time */
+vPortSuppressTicksAndSleep:
+    svc 2
+    bx lr
+
+.size vPortSuppressTicksAndSleep, .-vPortSuppressTicksAndSleep
+
+/*-----------------------------------------------------------*/
+/*               vPortEnterCriticalFromThread                */
+/*-----------------------------------------------------------*/
+.section .text.vPortEnterCriticalFromThread, "ax", %progbits
+.global vPortEnterCriticalFromThread
+.type vPortEnterCriticalFromThread, %function
+
+/* The unprivileged tasks can not write the BASEPRI, their critical sections are
+entered and left from the Supervisor Call handler. The BASEPRI register is not
+stacked, so the mask set there stays in effect after the return to thread mode.
+r0 holds the caller. */
+vPortEnterCriticalFromThread:
+    svc 3
+    bx lr
+
+.size vPortEnterCriticalFromThread, .-vPortEnterCriticalFromThread
+
+/*-----------------------------------------------------------*/
+/*               vPortExitCriticalFromThread                 */
+/*-----------------------------------------------------------*/
+.section .text.vPortExitCriticalFromThread, "ax", %progbits
+.global vPortExitCriticalFromThread
+.type vPortExitCriticalFromThread, %function
+
+vPortExitCriticalFromThread:
+    svc 4
+    bx lr
+
+.size vPortExitCriticalFromThread, .-vPortExitCriticalFromThread
+
+/*-----------------------------------------------------------*/
+/*             vPortGetStatsTimerValueFromThread             */
+/*-----------------------------------------------------------*/
+.section .text.vPortGetStatsTimerValueFromThread, "ax", %progbits
+.global vPortGetStatsTimerValueFromThread
+.type vPortGetStatsTimerValueFromThread, %function
+
+/* The unprivileged tasks can not read the DWT cycle counter, the run time stats
+counter is read by the Supervisor Call handler and returned in r0 (r0 and r1 for
+the 64 bit counter) */
+vPortGetStatsTimerValueFromThread:
+    svc 5
+    bx lr
+
+.size vPortGetStatsTimerValueFromThread, .-vPortGetStatsTimerValueFromThread
+
+/*-----------------------------------------------------------*/
+/*            ulPortBootProfilerCyclesFromThread             */
+/*-----------------------------------------------------------*/
+.section .text.ulPortBootProfilerCyclesFromThread, "ax", %progbits
+.global ulPortBootProfilerCyclesFromThread
+.type ulPortBootProfilerCyclesFromThread, %function
+
+/* The unprivileged tasks can not read the DWT cycle counter, the boot time is
+read by the Supervisor Call handler and returned in r0 */
+ulPortBootProfilerCyclesFromThread:
+    svc 6
+    bx lr
+
+.size ulPortBootProfilerCyclesFromThread, .-ulPortBootProfilerCyclesFromThread
+
 /*-----------------------------------------------------------*/
 /*                     vPortStartFirstTask                   */
 /*-----------------------------------------------------------*/
@@ -146,14 +224,59 @@ vPortSetFirstTaskContext_Locals:
 .global SVC_Handler
 .type SVC_Handler, %function
 
-/* This is the SuperVisor Call Handler -> forward to C for sevice */
+/* This is the SuperVisor Call Handler. The kernel service calls (start first task,
+yield and the critical sections of the unprivileged tasks) are dispatched through
+a table directly from here, all the others are forwarded to C for service */
 SVC_Handler:
     tst lr, #4
     ite eq
     mrseq r0, msp
     mrsne r0, psp
+
+    /* get the svc number: Memory[(Stacked PC)-2] */
+    ldr r1, [r0, #24]
+    ldrb r1, [r1, #-2]
+
+    /* service calls not in the table take the slow path */
+    cmp r1, #5
+    bhs vPortServiceHandler
+    tbb [pc, r1]
+
+SVC_Handler_Table:
+    .byte (SVC_Handler_StartFirstTask - SVC_Handler_Table) / 2      /* svc 0 */
+    .byte (SVC_Handler_Yield - SVC_Handler_Table) / 2               /* svc 1 */
+    .byte (SVC_Handler_Service - SVC_Handler_Table) / 2             /* svc 2 */
+    .byte (SVC_Handler_EnterCritical - SVC_Handler_Table) / 2       /* svc 3 */
+    .byte (SVC_Handler_ExitCritical - SVC_Handler_Table) / 2        /* svc 4 */
+.align 1
+
+SVC_Handler_Service:
     b vPortServiceHandler
 
+SVC_Handler_EnterCritical:
+    /* the stacked r0 holds the caller, the C function returns from the exception */
+    ldr r0, [r0]
+    b vPortEnterCriticalPrivileged
+
+SVC_Handler_ExitCritical:
+    b vPortExitCriticalPrivileged
+
+SVC_Handler_StartFirstTask:
+    b vPortSetFirstTaskContext
+
+SVC_Handler_Yield:
+    /* pend the PendSV interrupt - context switching is performed there */
+    ldr r0, SVC_Handler_Locals
+    mov r1, #0x10000000
+    str r1, [r0]
+    dsb
+    isb
+    bx lr
+
+.align 4
+SVC_Handler_Locals:
+    .word 0xE000ED04                    /* SCB->ICSR */
+
 .size SVC_Handler, .-SVC_Handler
 
 /*-----------------------------------------------------------*/
@@ -0,0 +1,315 @@
+/*_____________________________________________________________________________
+ │                                                                            |
+ │ COPYRIGHT (C) 2026 Mihai Baneu                                             |
+ │                                                                            |
+ | Permission is hereby  granted,  free of charge,  to any person obtaining a |
+ | copy of this software and associated documentation files (the "Software"), |
+ | to deal in the Software without restriction,  including without limitation |
+ | the rights to  use, copy, modify, merge, publish, distribute,  sublicense, |
+ | and/or sell copies  of  the Software, and to permit  persons to  whom  the |
+ | Software is furnished to do so, subject to the following conditions:       |
+ |                                                                            |
+ | The above  copyright notice  and this permission notice  shall be included |
+ | in all copies or substantial portions of the Software.                     |
+ |                                                                            |
+ | THE SOFTWARE IS PROVIDED  "AS IS",  WITHOUT WARRANTY OF ANY KIND,  EXPRESS |
+ | OR   IMPLIED,   INCLUDING   BUT   NOT   LIMITED   TO   THE  WARRANTIES  OF |
+ | MERCHANTABILITY,  FITNESS FOR  A  PARTICULAR  PURPOSE AND NONINFRINGEMENT. |
+ | IN NO  EVENT SHALL  THE AUTHORS  OR  COPYRIGHT  HOLDERS  BE LIABLE FOR ANY |
+ | CLAIM, DAMAGES OR OTHER LIABILITY,  WHETHER IN AN ACTION OF CONTRACT, TORT |
+ | OR OTHERWISE, ARISING FROM,  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR  |
+ | THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                 |
+ |____________________________________________________________________________|
+ |                                                                            |
+ |  Author: Mihai Baneu                           Last modified: 17.Oct.2026  |
+ |                                                                            |
+ |___________________________________________________________________________*/
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "atomic.h"
+#include "deferred_work.h"
+
+/* The MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* This entire source file will be skipped if the application is not configured
+ * to include the deferred work queue.  This #if is closed at the very bottom of
+ * this file. */
+#if ( configUSE_DEFERRED_WORK == 1 )
+
+    #if ( configUSE_TASK_NOTIFICATIONS == 0 )
+        #error configUSE_TASK_NOTIFICATIONS must be set to 1 to use the deferred work queue.
+    #endif
+
+/* Number of lanes, each served by its own worker task. */
+    #ifndef configDEFERRED_WORK_LANES
+        #define configDEFERRED_WORK_LANES    1
+    #endif
+
+/* Number of work items each lane can hold.  The ring indexes are free running
+ * 32-bit counters, so the length must be a power of two. */
+    #ifndef configDEFERRED_WORK_QUEUE_LENGTH
+        #define configDEFERRED_WORK_QUEUE_LENGTH    16
+    #endif
+
+    #if ( ( configDEFERRED_WORK_QUEUE_LENGTH & ( configDEFERRED_WORK_QUEUE_LENGTH - 1 ) ) != 0 )
+        #error configDEFERRED_WORK_QUEUE_LENGTH must be a power of two.
+    #endif
+
+/* Priority of the worker task of lane 0.  The worker of lane n runs at this
+ * priority minus n. */
+    #ifndef configDEFERRED_WORK_TASK_PRIORITY
+        #define configDEFERRED_WORK_TASK_PRIORITY    ( configMAX_PRIORITIES - 1 )
+    #endif
+
+    #ifndef configDEFERRED_WORK_TASK_STACK_DEPTH
+        #define configDEFERRED_WORK_TASK_STACK_DEPTH    configMINIMAL_STACK_SIZE
+    #endif
+
+/* The name assigned to the worker tasks. */
+    #ifndef configDEFERRED_WORK_TASK_NAME
+        #define configDEFERRED_WORK_TASK_NAME    "DWork"
+    #endif
+
+/* A slot of a lane ring.  The slot is claimed by advancing the ring head, then
+ * filled, then published by setting ulPublished.  The worker clears ulPublished
+ * before it advances the ring tail, which hands the slot back to the producers. */
+    typedef struct dwWorkItem
+    {
+        volatile uint32_t ulPublished;
+        DeferredWorkFunction_t pxFunction;
+        void * pvParameter1;
+        uint32_t ulParameter2;
+    } DeferredWorkItem_t;
+
+    typedef struct dwWorkLane
+    {
+        DeferredWorkItem_t xItems[ configDEFERRED_WORK_QUEUE_LENGTH ];
+        volatile uint32_t ulHead;        /**< Next position claimed by a producer. */
+        volatile uint32_t ulTail;        /**< Next position executed by the worker, only written by the worker. */
+        volatile uint32_t ulWakePending; /**< Set by the producer that notified the worker, cleared by the worker before it drains the ring. */
+        TaskHandle_t xWorkerTask;
+    } DeferredWorkLane_t;
+
+/* Lint e956 can be justified as these variables are only accessed through the
+ * functions of this file. */
+    PRIVILEGED_DATA static DeferredWorkLane_t xLanes[ configDEFERRED_WORK_LANES ];
+
+    #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+        PRIVILEGED_DATA static StaticTask_t xWorkerTaskTCBs[ configDEFERRED_WORK_LANES ];
+        PRIVILEGED_DATA static StackType_t xWorkerTaskStacks[ configDEFERRED_WORK_LANES ][ configDEFERRED_WORK_TASK_STACK_DEPTH ];
+    #endif
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The worker task of a lane.
+ */
+    static portTASK_FUNCTION_PROTO( prvDeferredWorkTask, pvParameters ) PRIVILEGED_FUNCTION;
+
+/*
+ * Executes the published work items of a lane in order, until the ring is empty
+ * or the next slot is claimed but not yet published.
+ */
+    static void prvDrainLane( DeferredWorkLane_t * const pxLane ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+    BaseType_t xDeferredWorkCreateTasks( void )
+    {
+        BaseType_t xReturn = pdPASS;
+        UBaseType_t uxLane;
+
+        traceENTER_xDeferredWorkCreateTasks();
+
+        /* The workers of the lower lanes must not end up at or below the idle
+         * priority. */
+        configASSERT( configDEFERRED_WORK_TASK_PRIORITY >= configDEFERRED_WORK_LANES );
+
+        for( uxLane = 0; ( uxLane < ( UBaseType_t ) configDEFERRED_WORK_LANES ) && ( xReturn == pdPASS ); uxLane++ )
+        {
+            #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+            {
+                xLanes[ uxLane ].xWorkerTask = xTaskCreateStatic( prvDeferredWorkTask,
+                                                                  configDEFERRED_WORK_TASK_NAME,
+                                                                  configDEFERRED_WORK_TASK_STACK_DEPTH,
+                                                                  &( xLanes[ uxLane ] ),
+                                                                  ( ( UBaseType_t ) ( configDEFERRED_WORK_TASK_PRIORITY - uxLane ) ) | portPRIVILEGE_BIT,
+                                                                  xWorkerTaskStacks[ uxLane ],
+                                                                  &( xWorkerTaskTCBs[ uxLane ] ) );
+
+                if( xLanes[ uxLane ].xWorkerTask == NULL )
+                {
+                    xReturn = pdFAIL;
+                }
+            }
+            #else /* if ( configSUPPORT_STATIC_ALLOCATION == 1 ) */
+            {
+                xReturn = xTaskCreate( prvDeferredWorkTask,
+                                       configDEFERRED_WORK_TASK_NAME,
+                                       configDEFERRED_WORK_TASK_STACK_DEPTH,
+                                       &( xLanes[ uxLane ] ),
+                                       ( ( UBaseType_t ) ( configDEFERRED_WORK_TASK_PRIORITY - uxLane ) ) | portPRIVILEGE_BIT,
+                                       &( xLanes[ uxLane ].xWorkerTask ) );
+            }
+            #endif /* configSUPPORT_STATIC_ALLOCATION */
+        }
+
+        configASSERT( xReturn );
+
+        traceRETURN_xDeferredWorkCreateTasks( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xDeferredWorkPostFromISR( UBaseType_t uxLane,
+                                         DeferredWorkFunction_t xFunctionToPost,
+                                         void * pvParameter1,
+                                         uint32_t ulParameter2,
+                                         BaseType_t * pxHigherPriorityTaskWoken )
+    {
+        BaseType_t xReturn = pdPASS;
+        DeferredWorkLane_t * pxLane;
+        DeferredWorkItem_t * pxItem;
+        uint32_t ulHead;
+
+        traceENTER_xDeferredWorkPostFromISR( uxLane, xFunctionToPost, pvParameter1, ulParameter2, pxHigherPriorityTaskWoken );
+
+        configASSERT( uxLane < ( UBaseType_t ) configDEFERRED_WORK_LANES );
+        configASSERT( xFunctionToPost );
+
+        pxLane = &( xLanes[ uxLane ] );
+
+        /* Claim a slot.  An interrupt nesting on this one may claim the same
+         * position first, in which case the compare-and-swap fails and the next
+         * position is tried. */
+        do
+        {
+            ulHead = pxLane->ulHead;
+
+            if( ( ulHead - pxLane->ulTail ) >= ( uint32_t ) configDEFERRED_WORK_QUEUE_LENGTH )
+            {
+                xReturn = pdFAIL;
+                break;
+            }
+        } while( Atomic_CompareAndSwap_u32( &( pxLane->ulHead ), ulHead + 1U, ulHead ) != ATOMIC_COMPARE_AND_SWAP_SUCCESS );
+
+        if( xReturn == pdPASS )
+        {
+            pxItem = &( pxLane->xItems[ ulHead & ( ( uint32_t ) configDEFERRED_WORK_QUEUE_LENGTH - 1U ) ] );
+            pxItem->pxFunction = xFunctionToPost;
+            pxItem->pvParameter1 = pvParameter1;
+            pxItem->ulParameter2 = ulParameter2;
+            portMEMORY_BARRIER();
+            pxItem->ulPublished = pdTRUE;
+
+            /* Only the first post after the worker started draining notifies
+             * it, the following ones are picked up by the same drain pass. */
+            if( Atomic_CompareAndSwap_u32( &( pxLane->ulWakePending ), pdTRUE, pdFALSE ) == ATOMIC_COMPARE_AND_SWAP_SUCCESS )
+            {
+                if( pxLane->xWorkerTask != NULL )
+                {
+                    vTaskNotifyGiveFromISR( pxLane->xWorkerTask, pxHigherPriorityTaskWoken );
+                }
+                else
+                {
+                    /* The scheduler has not been started yet.  The worker
+                     * drains the lane before it waits for the first time. */
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceDEFERRED_WORK_POST_FROM_ISR( uxLane, xFunctionToPost, xReturn );
+        traceRETURN_xDeferredWorkPostFromISR( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    TaskHandle_t xDeferredWorkGetTaskHandle( UBaseType_t uxLane )
+    {
+        traceENTER_xDeferredWorkGetTaskHandle( uxLane );
+
+        configASSERT( uxLane < ( UBaseType_t ) configDEFERRED_WORK_LANES );
+
+        traceRETURN_xDeferredWorkGetTaskHandle( xLanes[ uxLane ].xWorkerTask );
+
+        return xLanes[ uxLane ].xWorkerTask;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvDrainLane( DeferredWorkLane_t * const pxLane )
+    {
+        DeferredWorkItem_t * pxItem;
+        DeferredWorkFunction_t pxFunction;
+        void * pvParameter1;
+        uint32_t ulParameter2;
+        uint32_t ulTail = pxLane->ulTail;
+
+        for( ; ; )
+        {
+            pxItem = &( pxLane->xItems[ ulTail & ( ( uint32_t ) configDEFERRED_WORK_QUEUE_LENGTH - 1U ) ] );
+
+            if( pxItem->ulPublished == pdFALSE )
+            {
+                /* Either empty, or the producer that claimed this slot has been
+                 * preempted before publishing it.  It notifies the worker once
+                 * it does. */
+                break;
+            }
+
+            pxFunction = pxItem->pxFunction;
+            pvParameter1 = pxItem->pvParameter1;
+            ulParameter2 = pxItem->ulParameter2;
+
+            /* Release the slot before the function runs so a long running
+             * function does not keep it from the producers. */
+            pxItem->ulPublished = pdFALSE;
+            portMEMORY_BARRIER();
+            ulTail++;
+            pxLane->ulTail = ulTail;
+
+            traceDEFERRED_WORK_EXECUTE( pxFunction );
+            pxFunction( pvParameter1, ulParameter2 );
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static portTASK_FUNCTION( prvDeferredWorkTask, pvParameters )
+    {
+        DeferredWorkLane_t * const pxLane = ( DeferredWorkLane_t * ) pvParameters;
+
+        for( ; ; )
+        {
+            /* Clear the wake-up flag before looking at the ring, so a post that
+             * happens after the ring is found empty notifies the worker again. */
+            pxLane->ulWakePending = pdFALSE;
+            prvDrainLane( pxLane );
+
+            ( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+        }
+    }
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+ * to include the deferred work queue.  If you want to include the deferred work
+ * queue then ensure configUSE_DEFERRED_WORK is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_DEFERRED_WORK == 1 */
@@ -255,19 +255,21 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength,
  * Macro to mark a queue as locked.  Locking a queue prevents an ISR from
  * accessing the queue event lists.
  */
-#define prvLockQueue( pxQueue )                            \
-    taskENTER_CRITICAL();                                  \
-    {                                                      \
-        if( ( pxQueue )->cRxLock == queueUNLOCKED )        \
-        {                                                  \
-            ( pxQueue )->cRxLock = queueLOCKED_UNMODIFIED; \
-        }                                                  \
-        if( ( pxQueue )->cTxLock == queueUNLOCKED )        \
-        {                                                  \
-            ( pxQueue )->cTxLock = queueLOCKED_UNMODIFIED; \
-        }                                                  \
-    }                                                      \
-    taskEXIT_CRITICAL()
+#define prvLockQueue( pxQueue )                                                \
+    do {                                                                       \
+        UBaseType_t uxLockInterruptStatus = taskENTER_CRITICAL_INLINE();       \
+        {                                                                      \
+            if( ( pxQueue )->cRxLock == queueUNLOCKED )                        \
+            {                                                                  \
+                ( pxQueue )->cRxLock = queueLOCKED_UNMODIFIED;                 \
+            }                                                                  \
+            if( ( pxQueue )->cTxLock == queueUNLOCKED )                        \
+            {                                                                  \
+                ( pxQueue )->cTxLock = queueLOCKED_UNMODIFIED;                 \
+            }                                                                  \
+        }                                                                      \
+        taskEXIT_CRITICAL_INLINE( uxLockInterruptStatus );                     \
+    } while( 0 )
 
 /*
  * Macro to increment cTxLock member of the queue data structure. It is
@@ -941,6 +943,7 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
                               TickType_t xTicksToWait,
                               const BaseType_t xCopyPosition )
 {
+    UBaseType_t uxSavedInterruptStatus;
     BaseType_t xEntryTimeSet = pdFALSE, xYieldRequired;
     TimeOut_t xTimeOut;
     Queue_t * const pxQueue = xQueue;
@@ -958,7 +961,7 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
 
     for( ; ; )
     {
-        taskENTER_CRITICAL();
+        uxSavedInterruptStatus = taskENTER_CRITICAL_INLINE();
         {
             /* Is there room on the queue now?  The running task must be the
              * highest priority task wanting to access the queue.  If the head item
@@ -1064,7 +1067,7 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
                 }
                 #endif /* configUSE_QUEUE_SETS */
 
-                taskEXIT_CRITICAL();
+                taskEXIT_CRITICAL_INLINE( uxSavedInterruptStatus );
 
                 traceRETURN_xQueueGenericSend( pdPASS );
 
@@ -1076,7 +1079,7 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
                 {
                     /* The queue was full and no block time is specified (or
                      * the block time has expired) so leave now. */
-                    taskEXIT_CRITICAL();
+                    taskEXIT_CRITICAL_INLINE( uxSavedInterruptStatus );
 
                     /* Return to the original privilege level before exiting
                      * the function. */
@@ -1099,7 +1102,7 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
                 }
             }
         }
-        taskEXIT_CRITICAL();
+        taskEXIT_CRITICAL_INLINE( uxSavedInterruptStatus );
 
         /* Interrupts and other tasks can send to and receive from the queue
          * now the critical section has been exited. */
@@ -1497,6 +1500,7 @@ BaseType_t xQueueReceive( QueueHandle_t xQueue,
                           void * const pvBuffer,
                           TickType_t xTicksToWait )
 {
+    UBaseType_t uxSavedInterruptStatus;
     BaseType_t xEntryTimeSet = pdFALSE;
     TimeOut_t xTimeOut;
     Queue_t * const pxQueue = xQueue;
@@ -1519,7 +1523,7 @@ BaseType_t xQueueReceive( QueueHandle_t xQueue,
 
     for( ; ; )
     {
-        taskENTER_CRITICAL();
+        uxSavedInterruptStatus = taskENTER_CRITICAL_INLINE();
         {
             const UBaseType_t uxMessagesWaiting = pxQueue->uxMessagesWaiting;
 
@@ -1551,7 +1555,7 @@ BaseType_t xQueueReceive( QueueHandle_t xQueue,
                     mtCOVERAGE_TEST_MARKER();
                 }
 
-                taskEXIT_CRITICAL();
+                taskEXIT_CRITICAL_INLINE( uxSavedInterruptStatus );
 
                 traceRETURN_xQueueReceive( pdPASS );
 
@@ -1563,7 +1567,7 @@ BaseType_t xQueueReceive( QueueHandle_t xQueue,
                 {
                     /* The queue was empty and no block time is specified (or
                      * the block time has expired) so leave now. */
-                    taskEXIT_CRITICAL();
+                    taskEXIT_CRITICAL_INLINE( uxSavedInterruptStatus );
 
                     traceQUEUE_RECEIVE_FAILED( pxQueue );
                     traceRETURN_xQueueReceive( errQUEUE_EMPTY );
@@ -1584,7 +1588,7 @@ BaseType_t xQueueReceive( QueueHandle_t xQueue,
                 }
             }
         }
-        taskEXIT_CRITICAL();
+        taskEXIT_CRITICAL_INLINE( uxSavedInterruptStatus );
 
         /* Interrupts and other tasks can send to and receive from the queue
          * now the critical section has been exited. */
@@ -1646,6 +1650,7 @@ BaseType_t xQueueReceive( QueueHandle_t xQueue,
 BaseType_t xQueueSemaphoreTake( QueueHandle_t xQueue,
                                 TickType_t xTicksToWait )
 {
+    UBaseType_t uxSavedInterruptStatus;
     BaseType_t xEntryTimeSet = pdFALSE;
     TimeOut_t xTimeOut;
     Queue_t * const pxQueue = xQueue;
@@ -1672,7 +1677,7 @@ BaseType_t xQueueSemaphoreTake( QueueHandle_t xQueue,
 
     for( ; ; )
     {
-        taskENTER_CRITICAL();
+        uxSavedInterruptStatus = taskENTER_CRITICAL_INLINE();
         {
             /* Semaphores are queues with an item size of 0, and where the
              * number of messages in the queue is the semaphore's count value. */
@@ -1721,7 +1726,7 @@ BaseType_t xQueueSemaphoreTake( QueueHandle_t xQueue,
                     mtCOVERAGE_TEST_MARKER();
                 }
 
-                taskEXIT_CRITICAL();
+                taskEXIT_CRITICAL_INLINE( uxSavedInterruptStatus );
 
                 traceRETURN_xQueueSemaphoreTake( pdPASS );
 
@@ -1733,7 +1738,7 @@ BaseType_t xQueueSemaphoreTake( QueueHandle_t xQueue,
                 {
                     /* The semaphore count was 0 and no block time is specified
                      * (or the block time has expired) so exit now. */
-                    taskEXIT_CRITICAL();
+                    taskEXIT_CRITICAL_INLINE( uxSavedInterruptStatus );
 
                     traceQUEUE_RECEIVE_FAILED( pxQueue );
                     traceRETURN_xQueueSemaphoreTake( errQUEUE_EMPTY );
@@ -1754,7 +1759,7 @@ BaseType_t xQueueSemaphoreTake( QueueHandle_t xQueue,
                 }
             }
         }
-        taskEXIT_CRITICAL();
+        taskEXIT_CRITICAL_INLINE( uxSavedInterruptStatus );
 
         /* Interrupts and other tasks can give to and take from the semaphore
          * now the critical section has been exited. */
@@ -1872,6 +1877,7 @@ BaseType_t xQueuePeek( QueueHandle_t xQueue,
                        void * const pvBuffer,
                        TickType_t xTicksToWait )
 {
+    UBaseType_t uxSavedInterruptStatus;
     BaseType_t xEntryTimeSet = pdFALSE;
     TimeOut_t xTimeOut;
     int8_t * pcOriginalReadPosition;
@@ -1895,7 +1901,7 @@ BaseType_t xQueuePeek( QueueHandle_t xQueue,
 
     for( ; ; )
     {
-        taskENTER_CRITICAL();
+        uxSavedInterruptStatus = taskENTER_CRITICAL_INLINE();
         {
             const UBaseType_t uxMessagesWaiting = pxQueue->uxMessagesWaiting;
 
@@ -1933,7 +1939,7 @@ BaseType_t xQueuePeek( QueueHandle_t xQueue,
                     mtCOVERAGE_TEST_MARKER();
                 }
 
-                taskEXIT_CRITICAL();
+                taskEXIT_CRITICAL_INLINE( uxSavedInterruptStatus );
 
                 traceRETURN_xQueuePeek( pdPASS );
 
@@ -1945,7 +1951,7 @@ BaseType_t xQueuePeek( QueueHandle_t xQueue,
                 {
                     /* The queue was empty and no block time is specified (or
                      * the block time has expired) so leave now. */
-                    taskEXIT_CRITICAL();
+                    taskEXIT_CRITICAL_INLINE( uxSavedInterruptStatus );
 
                     traceQUEUE_PEEK_FAILED( pxQueue );
                     traceRETURN_xQueuePeek( errQUEUE_EMPTY );
@@ -1967,7 +1973,7 @@ BaseType_t xQueuePeek( QueueHandle_t xQueue,
                 }
             }
         }
-        taskEXIT_CRITICAL();
+        taskEXIT_CRITICAL_INLINE( uxSavedInterruptStatus );
 
         /* Interrupts and other tasks can send to and receive from the queue
          * now that the critical section has been exited. */
@@ -2184,17 +2190,18 @@ BaseType_t xQueuePeekFromISR( QueueHandle_t xQueue,
 
 UBaseType_t uxQueueMessagesWaiting( const QueueHandle_t xQueue )
 {
+    UBaseType_t uxSavedInterruptStatus;
     UBaseType_t uxReturn;
 
     traceENTER_uxQueueMessagesWaiting( xQueue );
 
     configASSERT( xQueue );
 
-    taskENTER_CRITICAL();
+    uxSavedInterruptStatus = taskENTER_CRITICAL_INLINE();
     {
         uxReturn = ( ( Queue_t * ) xQueue )->uxMessagesWaiting;
     }
-    taskEXIT_CRITICAL();
+    taskEXIT_CRITICAL_INLINE( uxSavedInterruptStatus );
 
     traceRETURN_uxQueueMessagesWaiting( uxReturn );
 
@@ -2204,6 +2211,7 @@ UBaseType_t uxQueueMessagesWaiting( const QueueHandle_t xQueue )
 
 UBaseType_t uxQueueSpacesAvailable( const QueueHandle_t xQueue )
 {
+    UBaseType_t uxSavedInterruptStatus;
     UBaseType_t uxReturn;
     Queue_t * const pxQueue = xQueue;
 
@@ -2211,11 +2219,11 @@ UBaseType_t uxQueueSpacesAvailable( const QueueHandle_t xQueue )
 
     configASSERT( pxQueue );
 
-    taskENTER_CRITICAL();
+    uxSavedInterruptStatus = taskENTER_CRITICAL_INLINE();
     {
         uxReturn = ( UBaseType_t ) ( pxQueue->uxLength - pxQueue->uxMessagesWaiting );
     }
-    taskEXIT_CRITICAL();
+    taskEXIT_CRITICAL_INLINE( uxSavedInterruptStatus );
 
     traceRETURN_uxQueueSpacesAvailable( uxReturn );
 
@@ -2481,13 +2489,15 @@ static void prvCopyDataFromQueue( Queue_t * const pxQueue,
 
 static void prvUnlockQueue( Queue_t * const pxQueue )
 {
+    UBaseType_t uxSavedInterruptStatus;
+
     /* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED. */
 
     /* The lock counts contains the number of extra data items placed or
      * removed from the queue while the queue was locked.  When a queue is
      * locked items can be added or removed, but the event lists cannot be
      * updated. */
-    taskENTER_CRITICAL();
+    uxSavedInterruptStatus = taskENTER_CRITICAL_INLINE();
     {
         int8_t cTxLock = pxQueue->cTxLock;
 
@@ -2565,10 +2575,10 @@ static void prvUnlockQueue( Queue_t * const pxQueue )
 
         pxQueue->cTxLock = queueUNLOCKED;
     }
-    taskEXIT_CRITICAL();
+    taskEXIT_CRITICAL_INLINE( uxSavedInterruptStatus );
 
     /* Do the same for the Rx lock. */
-    taskENTER_CRITICAL();
+    uxSavedInterruptStatus = taskENTER_CRITICAL_INLINE();
     {
         int8_t cRxLock = pxQueue->cRxLock;
 
@@ -2595,15 +2605,16 @@ static void prvUnlockQueue( Queue_t * const pxQueue )
 
         pxQueue->cRxLock = queueUNLOCKED;
     }
-    taskEXIT_CRITICAL();
+    taskEXIT_CRITICAL_INLINE( uxSavedInterruptStatus );
 }
 /*-----------------------------------------------------------*/
 
 static BaseType_t prvIsQueueEmpty( const Queue_t * pxQueue )
 {
+    UBaseType_t uxSavedInterruptStatus;
     BaseType_t xReturn;
 
-    taskENTER_CRITICAL();
+    uxSavedInterruptStatus = taskENTER_CRITICAL_INLINE();
     {
         if( pxQueue->uxMessagesWaiting == ( UBaseType_t ) 0 )
         {
@@ -2614,7 +2625,7 @@ static BaseType_t prvIsQueueEmpty( const Queue_t * pxQueue )
             xReturn = pdFALSE;
         }
     }
-    taskEXIT_CRITICAL();
+    taskEXIT_CRITICAL_INLINE( uxSavedInterruptStatus );
 
     return xReturn;
 }
@@ -2646,9 +2657,10 @@ BaseType_t xQueueIsQueueEmptyFromISR( const QueueHandle_t xQueue )
 
 static BaseType_t prvIsQueueFull( const Queue_t * pxQueue )
 {
+    UBaseType_t uxSavedInterruptStatus;
     BaseType_t xReturn;
 
-    taskENTER_CRITICAL();
+    uxSavedInterruptStatus = taskENTER_CRITICAL_INLINE();
     {
         if( pxQueue->uxMessagesWaiting == pxQueue->uxLength )
         {
@@ -2659,7 +2671,7 @@ static BaseType_t prvIsQueueFull( const Queue_t * pxQueue )
             xReturn = pdFALSE;
         }
     }
-    taskEXIT_CRITICAL();
+    taskEXIT_CRITICAL_INLINE( uxSavedInterruptStatus );
 
     return xReturn;
 }
@@ -721,6 +721,7 @@ size_t xStreamBufferSend( StreamBufferHandle_t xStreamBuffer,
                           size_t xDataLengthBytes,
                           TickType_t xTicksToWait )
 {
+    UBaseType_t uxSavedInterruptStatus;
     StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
     size_t xReturn, xSpace = 0;
     size_t xRequiredSpace = xDataLengthBytes;
@@ -783,7 +784,7 @@ size_t xStreamBufferSend( StreamBufferHandle_t xStreamBuffer,
         {
             /* Wait until the required number of bytes are free in the message
              * buffer. */
-            taskENTER_CRITICAL();
+            uxSavedInterruptStatus = taskENTER_CRITICAL_INLINE();
             {
                 xSpace = xStreamBufferSpacesAvailable( pxStreamBuffer );
 
@@ -798,11 +799,11 @@ size_t xStreamBufferSend( StreamBufferHandle_t xStreamBuffer,
                 }
                 else
                 {
-                    taskEXIT_CRITICAL();
+                    taskEXIT_CRITICAL_INLINE( uxSavedInterruptStatus );
                     break;
                 }
             }
-            taskEXIT_CRITICAL();
+            taskEXIT_CRITICAL_INLINE( uxSavedInterruptStatus );
 
             traceBLOCKING_ON_STREAM_BUFFER_SEND( xStreamBuffer );
             ( void ) xTaskNotifyWait( ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
@@ -963,6 +964,7 @@ size_t xStreamBufferReceive( StreamBufferHandle_t xStreamBuffer,
                              size_t xBufferLengthBytes,
                              TickType_t xTicksToWait )
 {
+    UBaseType_t uxSavedInterruptStatus;
     StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
     size_t xReceivedLength = 0, xBytesAvailable, xBytesToStoreMessageLength;
 
@@ -989,7 +991,7 @@ size_t xStreamBufferReceive( StreamBufferHandle_t xStreamBuffer,
     {
         /* Checking if there is data and clearing the notification state must be
          * performed atomically. */
-        taskENTER_CRITICAL();
+        uxSavedInterruptStatus = taskENTER_CRITICAL_INLINE();
         {
             xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
 
@@ -1012,7 +1014,7 @@ size_t xStreamBufferReceive( StreamBufferHandle_t xStreamBuffer,
                 mtCOVERAGE_TEST_MARKER();
             }
         }
-        taskEXIT_CRITICAL();
+        taskEXIT_CRITICAL_INLINE( uxSavedInterruptStatus );
 
         if( xBytesAvailable <= xBytesToStoreMessageLength )
         {
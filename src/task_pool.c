@@ -0,0 +1,304 @@
+/*_____________________________________________________________________________
+ │                                                                            |
+ │ COPYRIGHT (C) 2026 Mihai Baneu                                             |
+ │                                                                            |
+ | Permission is hereby  granted,  free of charge,  to any person obtaining a |
+ | copy of this software and associated documentation files (the "Software"), |
+ | to deal in the Software without restriction,  including without limitation |
+ | the rights to  use, copy, modify, merge, publish, distribute,  sublicense, |
+ | and/or sell copies  of  the Software, and to permit  persons to  whom  the |
+ | Software is furnished to do so, subject to the following conditions:       |
+ |                                                                            |
+ | The above  copyright notice  and this permission notice  shall be included |
+ | in all copies or substantial portions of the Software.                     |
+ |                                                                            |
+ | THE SOFTWARE IS PROVIDED  "AS IS",  WITHOUT WARRANTY OF ANY KIND,  EXPRESS |
+ | OR   IMPLIED,   INCLUDING   BUT   NOT   LIMITED   TO   THE  WARRANTIES  OF |
+ | MERCHANTABILITY,  FITNESS FOR  A  PARTICULAR  PURPOSE AND NONINFRINGEMENT. |
+ | IN NO  EVENT SHALL  THE AUTHORS  OR  COPYRIGHT  HOLDERS  BE LIABLE FOR ANY |
+ | CLAIM, DAMAGES OR OTHER LIABILITY,  WHETHER IN AN ACTION OF CONTRACT, TORT |
+ | OR OTHERWISE, ARISING FROM,  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR  |
+ | THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                 |
+ |____________________________________________________________________________|
+ |                                                                            |
+ |  Author: Mihai Baneu                           Last modified: 17.Oct.2026  |
+ |                                                                            |
+ |___________________________________________________________________________*/
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "task_pool.h"
+
+/* The MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* This entire source file will be skipped if the application is not configured
+ * to include the task pool.  This #if is closed at the very bottom of this
+ * file. */
+#if ( configUSE_TASK_POOL == 1 )
+
+    #if ( configUSE_TASK_NOTIFICATIONS == 0 )
+        #error configUSE_TASK_NOTIFICATIONS must be set to 1 to use the task pool.
+    #endif
+
+    #if ( INCLUDE_vTaskPrioritySet == 0 )
+        #error INCLUDE_vTaskPrioritySet must be set to 1 to use the task pool.
+    #endif
+
+/* Number of tasks in the pool. */
+    #ifndef configTASK_POOL_SIZE
+        #define configTASK_POOL_SIZE    4
+    #endif
+
+    #if ( configTASK_POOL_SIZE < 1 )
+        #error configTASK_POOL_SIZE must be at least 1.
+    #endif
+
+    #ifndef configTASK_POOL_STACK_DEPTH
+        #define configTASK_POOL_STACK_DEPTH    configMINIMAL_STACK_SIZE
+    #endif
+
+/* The priority of the pooled tasks while they are in the pool.  A spawn sets
+ * the priority requested for the function, and the task goes back to this one
+ * when the function returns. */
+    #ifndef configTASK_POOL_TASK_PRIORITY
+        #define configTASK_POOL_TASK_PRIORITY    ( configMAX_PRIORITIES - 1 )
+    #endif
+
+/* The name assigned to the pooled tasks. */
+    #ifndef configTASK_POOL_TASK_NAME
+        #define configTASK_POOL_TASK_NAME    "Pool"
+    #endif
+
+/* A pooled task.  pxTaskCode and pvParameters are written by the spawning task
+ * while the worker is on the free list, and read by the worker once it has
+ * been notified. */
+    typedef struct tpPoolWorker
+    {
+        TaskHandle_t xTask;
+        TaskFunction_t pxTaskCode;
+        void * pvParameters;
+        struct tpPoolWorker * pxNextFree;
+    } TaskPoolWorker_t;
+
+/* Lint e956 can be justified as these variables are only accessed through the
+ * functions of this file. */
+    PRIVILEGED_DATA static TaskPoolWorker_t xWorkers[ configTASK_POOL_SIZE ];
+    PRIVILEGED_DATA static TaskPoolWorker_t * pxFreeWorkers = NULL;
+    PRIVILEGED_DATA static volatile UBaseType_t uxFreeWorkers = ( UBaseType_t ) 0U;
+
+    #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+        PRIVILEGED_DATA static StaticTask_t xWorkerTaskTCBs[ configTASK_POOL_SIZE ];
+        PRIVILEGED_DATA static StackType_t xWorkerTaskStacks[ configTASK_POOL_SIZE ][ configTASK_POOL_STACK_DEPTH ];
+    #endif
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The task function of every pooled task.
+ */
+    static portTASK_FUNCTION_PROTO( prvTaskPoolWorker, pvParameters ) PRIVILEGED_FUNCTION;
+
+/*
+ * Restores the pool priority of a worker and puts it back on the free list.
+ * The list is used last in, first out so the next spawn gets the stack that was
+ * used most recently.
+ */
+    static void prvReturnWorker( TaskPoolWorker_t * const pxWorker ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+    BaseType_t xTaskPoolCreateTasks( void )
+    {
+        BaseType_t xReturn = pdPASS;
+        UBaseType_t uxWorker;
+
+        traceENTER_xTaskPoolCreateTasks();
+
+        for( uxWorker = 0; ( uxWorker < ( UBaseType_t ) configTASK_POOL_SIZE ) && ( xReturn == pdPASS ); uxWorker++ )
+        {
+            /* The workers are created at the pool priority, by default the
+             * highest one, so they reach their first wait as soon as the
+             * scheduler starts. */
+            #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+            {
+                xWorkers[ uxWorker ].xTask = xTaskCreateStatic( prvTaskPoolWorker,
+                                                                configTASK_POOL_TASK_NAME,
+                                                                configTASK_POOL_STACK_DEPTH,
+                                                                &( xWorkers[ uxWorker ] ),
+                                                                ( ( UBaseType_t ) configTASK_POOL_TASK_PRIORITY ) | portPRIVILEGE_BIT,
+                                                                xWorkerTaskStacks[ uxWorker ],
+                                                                &( xWorkerTaskTCBs[ uxWorker ] ) );
+
+                if( xWorkers[ uxWorker ].xTask == NULL )
+                {
+                    xReturn = pdFAIL;
+                }
+            }
+            #else /* if ( configSUPPORT_STATIC_ALLOCATION == 1 ) */
+            {
+                xReturn = xTaskCreate( prvTaskPoolWorker,
+                                       configTASK_POOL_TASK_NAME,
+                                       configTASK_POOL_STACK_DEPTH,
+                                       &( xWorkers[ uxWorker ] ),
+                                       ( ( UBaseType_t ) configTASK_POOL_TASK_PRIORITY ) | portPRIVILEGE_BIT,
+                                       &( xWorkers[ uxWorker ].xTask ) );
+            }
+            #endif /* configSUPPORT_STATIC_ALLOCATION */
+
+            if( xReturn == pdPASS )
+            {
+                prvReturnWorker( &( xWorkers[ uxWorker ] ) );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        configASSERT( xReturn );
+
+        traceRETURN_xTaskPoolCreateTasks( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xTaskPoolSpawn( TaskFunction_t pxTaskCode,
+                               void * pvParameters,
+                               UBaseType_t uxPriority,
+                               TaskHandle_t * const pxSpawnedTask )
+    {
+        BaseType_t xReturn;
+        TaskPoolWorker_t * pxWorker;
+
+        traceENTER_xTaskPoolSpawn( pxTaskCode, pvParameters, uxPriority, pxSpawnedTask );
+
+        configASSERT( pxTaskCode );
+        configASSERT( uxPriority < ( UBaseType_t ) configMAX_PRIORITIES );
+
+        taskENTER_CRITICAL();
+        {
+            pxWorker = pxFreeWorkers;
+
+            if( pxWorker != NULL )
+            {
+                pxFreeWorkers = pxWorker->pxNextFree;
+                uxFreeWorkers--;
+
+                /* The function, its parameter and the priority are all set
+                 * inside the critical section.  A worker woken early by a
+                 * notification left pending by its previous function then either
+                 * finds no function, or runs this one at the requested priority.
+                 * Setting the priority does not switch context before the
+                 * critical section is left. */
+                pxWorker->pvParameters = pvParameters;
+                pxWorker->pxTaskCode = pxTaskCode;
+                vTaskPrioritySet( pxWorker->xTask, uxPriority );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        if( pxWorker != NULL )
+        {
+            if( pxSpawnedTask != NULL )
+            {
+                *pxSpawnedTask = pxWorker->xTask;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            /* Switches context if the worker has a priority above that of the
+             * calling task. */
+            traceTASK_POOL_SPAWN( pxWorker->xTask, pxTaskCode );
+            ( void ) xTaskNotifyGive( pxWorker->xTask );
+
+            xReturn = pdPASS;
+        }
+        else
+        {
+            xReturn = pdFAIL;
+        }
+
+        traceRETURN_xTaskPoolSpawn( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    UBaseType_t uxTaskPoolGetFreeTaskCount( void )
+    {
+        traceENTER_uxTaskPoolGetFreeTaskCount();
+
+        traceRETURN_uxTaskPoolGetFreeTaskCount( uxFreeWorkers );
+
+        return uxFreeWorkers;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvReturnWorker( TaskPoolWorker_t * const pxWorker )
+    {
+        taskENTER_CRITICAL();
+        {
+            /* Restored before the worker is on the free list, so it can not
+             * overwrite the priority set by the next spawn.  Nothing to do for
+             * the workers added to the pool when they are created. */
+            vTaskPrioritySet( pxWorker->xTask, ( UBaseType_t ) configTASK_POOL_TASK_PRIORITY );
+
+            pxWorker->pxNextFree = pxFreeWorkers;
+            pxFreeWorkers = pxWorker;
+            uxFreeWorkers++;
+        }
+        taskEXIT_CRITICAL();
+    }
+/*-----------------------------------------------------------*/
+
+    static portTASK_FUNCTION( prvTaskPoolWorker, pvParameters )
+    {
+        TaskPoolWorker_t * const pxWorker = ( TaskPoolWorker_t * ) pvParameters;
+        TaskFunction_t pxTaskCode;
+
+        for( ; ; )
+        {
+            ( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+
+            /* A notification left pending by the previous function, or the
+             * one sent by a spawn that was already picked up, does not come
+             * with a function to run. */
+            pxTaskCode = pxWorker->pxTaskCode;
+
+            if( pxTaskCode != NULL )
+            {
+                pxWorker->pxTaskCode = NULL;
+
+                traceTASK_POOL_EXECUTE( pxTaskCode );
+                pxTaskCode( pxWorker->pvParameters );
+
+                traceTASK_POOL_RETURN( pxWorker->xTask );
+                prvReturnWorker( pxWorker );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+    }
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+ * to include the task pool.  If you want to include the task pool then ensure
+ * configUSE_TASK_POOL is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_TASK_POOL == 1 */
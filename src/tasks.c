@@ -39,6 +39,8 @@
 #include "FreeRTOS.h"
 #include "task.h"
 #include "timers.h"
+#include "deferred_work.h"
+#include "task_pool.h"
 #include "stack_macros.h"
 
 /* The MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
@@ -79,7 +81,7 @@
 
         #define taskYIELD_ANY_CORE_IF_USING_PREEMPTION( pxTCB ) \
     do {                                                        \
-        if( pxCurrentTCB->uxPriority < ( pxTCB )->uxPriority )  \
+        if( taskSHOULD_PREEMPT_CURRENT_TASK( pxTCB ) )          \
         {                                                       \
             portYIELD_WITHIN_API();                             \
         }                                                       \
@@ -111,6 +113,7 @@
  * is used purely for checking the high water mark for tasks.
  */
 #define tskSTACK_FILL_BYTE                        ( 0xa5U )
+#define tskSTACK_FILL_WORD                        ( ( StackType_t ) ( ( ( StackType_t ) ~( StackType_t ) 0 / ( StackType_t ) 0xffU ) * ( StackType_t ) tskSTACK_FILL_BYTE ) )
 
 /* Bits used to record how a task's stack and TCB were allocated. */
 #define tskDYNAMICALLY_ALLOCATED_STACK_AND_TCB    ( ( uint8_t ) 0 )
@@ -120,7 +123,7 @@
 /* If any of the following are set then task stacks are filled with a known
  * value so the high water mark can be determined.  If none of the following are
  * set then don't fill the stack so there is no unnecessary dependency on memset. */
-#if ( ( configCHECK_FOR_STACK_OVERFLOW > 1 ) || ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) )
+#if ( ( configCHECK_FOR_STACK_OVERFLOW > 1 ) || ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) || ( configUSE_IDLE_STACK_SCAN == 1 ) )
     #define tskSET_NEW_STACKS_TO_KNOWN_VALUE    1
 #else
     #define tskSET_NEW_STACKS_TO_KNOWN_VALUE    0
@@ -192,11 +195,11 @@
 
 /*-----------------------------------------------------------*/
 
-/* Define away taskRESET_READY_PRIORITY() and portRESET_READY_PRIORITY() as
+/* Define away taskRESET_READY_PRIORITY() and taskCLEAR_READY_PRIORITY() as
  * they are only required when a port optimised method of task selection is
  * being used. */
     #define taskRESET_READY_PRIORITY( uxPriority )
-    #define portRESET_READY_PRIORITY( uxPriority, uxTopReadyPriority )
+    #define taskCLEAR_READY_PRIORITY( uxPriority )
 
 #else /* configUSE_PORT_OPTIMISED_TASK_SELECTION */
 
@@ -204,8 +207,60 @@
  * performed in a way that is tailored to the particular microcontroller
  * architecture being used. */
 
+/* The port macros operate on a single 32 bit bitmap. */
+    #define taskREADY_PRIORITY_GROUP_SIZE    ( 32U )
+
+    #if ( configMAX_PRIORITIES > taskREADY_PRIORITY_GROUP_SIZE )
+
+/* There are more priorities than bits in one bitmap, so the ready priorities
+ * are held in a two level bitmap.  uxReadyPriorityGroups[] holds one bit per
+ * priority, 32 priorities per word, and each bit of uxTopReadyPriority marks a
+ * word of uxReadyPriorityGroups[] that has at least one bit set.  Both levels
+ * use the port defined macros, so finding the highest priority ready task
+ * still takes two bit scans however many priorities are configured. */
+        #define taskREADY_PRIORITY_GROUP_SHIFT    ( 5U )
+        #define taskREADY_PRIORITY_GROUP_MASK     ( taskREADY_PRIORITY_GROUP_SIZE - 1U )
+        #define taskREADY_PRIORITY_GROUPS         ( ( ( UBaseType_t ) configMAX_PRIORITIES + taskREADY_PRIORITY_GROUP_MASK ) >> taskREADY_PRIORITY_GROUP_SHIFT )
+
+        #define taskRECORD_READY_PRIORITY( uxPriority )                                                                \
+    do {                                                                                                               \
+        UBaseType_t uxGroup = ( uxPriority ) >> taskREADY_PRIORITY_GROUP_SHIFT;                                        \
+                                                                                                                       \
+        portRECORD_READY_PRIORITY( ( uxPriority ) & taskREADY_PRIORITY_GROUP_MASK, uxReadyPriorityGroups[ uxGroup ] ); \
+        portRECORD_READY_PRIORITY( uxGroup, uxTopReadyPriority );                                                      \
+    } while( 0 )
+
+/* Clear the ready bit of uxPriority without checking its ready list, and the
+ * group bit too if no other priority of the group is ready. */
+        #define taskCLEAR_READY_PRIORITY( uxPriority )                                                                \
+    do {                                                                                                              \
+        UBaseType_t uxGroup = ( uxPriority ) >> taskREADY_PRIORITY_GROUP_SHIFT;                                       \
+                                                                                                                      \
+        portRESET_READY_PRIORITY( ( uxPriority ) & taskREADY_PRIORITY_GROUP_MASK, uxReadyPriorityGroups[ uxGroup ] ); \
+                                                                                                                      \
+        if( uxReadyPriorityGroups[ uxGroup ] == ( UBaseType_t ) 0 )                                                   \
+        {                                                                                                             \
+            portRESET_READY_PRIORITY( uxGroup, uxTopReadyPriority );                                                  \
+        }                                                                                                             \
+    } while( 0 )
+
+        #define taskGET_HIGHEST_READY_PRIORITY( uxTopPriority )                          \
+    do {                                                                                 \
+        UBaseType_t uxGroup;                                                             \
+                                                                                         \
+        portGET_HIGHEST_PRIORITY( uxGroup, uxTopReadyPriority );                         \
+        portGET_HIGHEST_PRIORITY( ( uxTopPriority ), uxReadyPriorityGroups[ uxGroup ] ); \
+        ( uxTopPriority ) += ( uxGroup << taskREADY_PRIORITY_GROUP_SHIFT );              \
+    } while( 0 )
+
+    #else /* if ( configMAX_PRIORITIES > taskREADY_PRIORITY_GROUP_SIZE ) */
+
 /* A port optimised version is provided.  Call the port defined macros. */
-    #define taskRECORD_READY_PRIORITY( uxPriority )    portRECORD_READY_PRIORITY( ( uxPriority ), uxTopReadyPriority )
+        #define taskRECORD_READY_PRIORITY( uxPriority )            portRECORD_READY_PRIORITY( ( uxPriority ), uxTopReadyPriority )
+        #define taskCLEAR_READY_PRIORITY( uxPriority )             portRESET_READY_PRIORITY( ( uxPriority ), uxTopReadyPriority )
+        #define taskGET_HIGHEST_READY_PRIORITY( uxTopPriority )    portGET_HIGHEST_PRIORITY( uxTopPriority, uxTopReadyPriority )
+
+    #endif /* if ( configMAX_PRIORITIES > taskREADY_PRIORITY_GROUP_SIZE ) */
 
 /*-----------------------------------------------------------*/
 
@@ -214,7 +269,7 @@
         UBaseType_t uxTopPriority;                                                              \
                                                                                                 \
         /* Find the highest priority list that contains ready tasks. */                         \
-        portGET_HIGHEST_PRIORITY( uxTopPriority, uxTopReadyPriority );                          \
+        taskGET_HIGHEST_READY_PRIORITY( uxTopPriority );                                        \
         configASSERT( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ uxTopPriority ] ) ) > 0 ); \
         listGET_OWNER_OF_NEXT_ENTRY( pxCurrentTCB, &( pxReadyTasksLists[ uxTopPriority ] ) );   \
     } while( 0 )
@@ -228,7 +283,7 @@
     do {                                                                                               \
         if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ ( uxPriority ) ] ) ) == ( UBaseType_t ) 0 ) \
         {                                                                                              \
-            portRESET_READY_PRIORITY( ( uxPriority ), ( uxTopReadyPriority ) );                        \
+            taskCLEAR_READY_PRIORITY( uxPriority );                                                    \
         }                                                                                              \
     } while( 0 )
 
@@ -275,6 +330,58 @@
  */
 #define prvGetTCBFromHandle( pxHandle )    ( ( ( pxHandle ) == NULL ) ? pxCurrentTCB : ( pxHandle ) )
 
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
+
+/* The run time between two reads of the run time counter.  The counter runs
+ * freely, so the unsigned difference is right across a wrap of the counter as
+ * long as less than a full period of it passed between the reads.  All the run
+ * time charged to the tasks is measured this way. */
+    #define taskRUN_TIME_SINCE( ulNow, ulThen )    ( ( configRUN_TIME_COUNTER_TYPE ) ( ( ulNow ) - ( ulThen ) ) )
+
+#endif /* configGENERATE_RUN_TIME_STATS */
+
+#if ( configUSE_EDF_SCHEDULING == 1 )
+
+/* Is the absolute deadline of pxTCB earlier than that of pxOtherTCB?  A task
+ * without a deadline is later than any task with one.  Deadlines are compared
+ * relative to each other so the comparison survives the tick count wrapping. */
+    #define taskEDF_DEADLINE_IS_EARLIER( pxTCB, pxOtherTCB )                                    \
+    ( ( ( pxTCB )->xRelativeDeadline != ( TickType_t ) 0U ) &&                                  \
+      ( ( ( pxOtherTCB )->xRelativeDeadline == ( TickType_t ) 0U ) ||                           \
+        ( ( TickType_t ) ( ( pxTCB )->xAbsoluteDeadline - ( pxOtherTCB )->xAbsoluteDeadline ) > \
+          ( portMAX_DELAY >> 1 ) ) ) )
+
+/* Should the task pxTCB, which has just become ready, preempt the running
+ * task?  Within priority configEDF_PRIORITY the earlier deadline wins. */
+    #define taskSHOULD_PREEMPT_CURRENT_TASK( pxTCB )                          \
+    ( ( ( pxTCB )->uxPriority > pxCurrentTCB->uxPriority ) ||                 \
+      ( ( ( pxTCB )->uxPriority == ( UBaseType_t ) configEDF_PRIORITY ) &&    \
+        ( pxCurrentTCB->uxPriority == ( UBaseType_t ) configEDF_PRIORITY ) && \
+        taskEDF_DEADLINE_IS_EARLIER( ( pxTCB ), pxCurrentTCB ) ) )
+#else
+    #define taskSHOULD_PREEMPT_CURRENT_TASK( pxTCB )    ( ( pxTCB )->uxPriority > pxCurrentTCB->uxPriority )
+#endif /* configUSE_EDF_SCHEDULING */
+
+#if ( configUSE_TASK_BUDGETS == 1 )
+
+/* Can pxTCB be throttled for using up its budget?  A demoted task is left to
+ * run at the background priority, a suspended task that was resumed by the
+ * application is suspended again. */
+    #define taskBUDGET_CAN_THROTTLE( pxTCB )                                    \
+    ( ( ( pxTCB )->ulBudget != ( configRUN_TIME_COUNTER_TYPE ) 0U ) &&          \
+      ( ( ( pxTCB )->ucBudgetAction == ( uint8_t ) eBudgetSuspend ) ||          \
+        ( ( pxTCB )->ucBudgetThrottled == ( uint8_t ) pdFALSE ) ) )
+
+/* The priority a demotion changes.  With mutexes the base priority is demoted
+ * so that disinheriting a mutex does not undo the demotion. */
+    #if ( configUSE_MUTEXES == 1 )
+        #define taskBUDGET_BASE_PRIORITY( pxTCB )    ( ( pxTCB )->uxBasePriority )
+    #else
+        #define taskBUDGET_BASE_PRIORITY( pxTCB )    ( ( pxTCB )->uxPriority )
+    #endif
+
+#endif /* configUSE_TASK_BUDGETS */
+
 /* The item value of the event list item is normally used to hold the priority
  * of the task to which it belongs (coded to allow it to be held in reverse
  * priority order).  However, it is occasionally borrowed for other purposes.  It
@@ -404,6 +511,37 @@ typedef struct tskTaskControlBlock       /* The old naming convention is used to
         configRUN_TIME_COUNTER_TYPE ulRunTimeCounter; /**< Stores the amount of time the task has spent in the Running state. */
     #endif
 
+    #if ( configUSE_EDF_SCHEDULING == 1 )
+        TickType_t xRelativeDeadline; /**< The deadline of each job relative to its release, or 0 if the task is not scheduled by deadline. */
+        TickType_t xAbsoluteDeadline; /**< The tick count by which the current job of the task should complete. */
+    #endif
+
+    #if ( configUSE_TASK_BUDGETS == 1 )
+        ListItem_t xBudgetListItem;                 /**< Links the task into xBudgetTaskList while it has a budget.  The item value is the tick count of the next replenishment. */
+        configRUN_TIME_COUNTER_TYPE ulBudget;       /**< The run time the task may use each budget period, or 0 if the task has no budget. */
+        configRUN_TIME_COUNTER_TYPE ulBudgetUsed;   /**< The run time the task used in the current budget period. */
+        TickType_t xBudgetPeriod;                   /**< The budget period in ticks. */
+        UBaseType_t uxBudgetSavedPriority;          /**< The priority to restore when a demoted task is replenished. */
+        uint8_t ucBudgetAction;                     /**< An eBudgetAction value. */
+        uint8_t ucBudgetThrottled;                  /**< Set to pdTRUE while the task is suspended or demoted for using up its budget. */
+    #endif
+
+    #if ( configUSE_TASK_JOB_STATS == 1 )
+        TaskJobStats_t xJobStats;                       /**< The execution time statistics of the completed jobs. */
+        configRUN_TIME_COUNTER_TYPE ulJobExecutionTime; /**< The run time of the job in progress, up to the last time the task was switched out. */
+        uint8_t ucJobEnded;                             /**< Set to pdTRUE when the job in progress ends, it is closed when the task is switched out. */
+    #endif
+
+    #if ( configUSE_TASK_OVERRUN_STATS == 1 )
+        uint32_t ulOverrunCount; /**< The number of times xTaskDelayUntil() found the task had missed its next release. */
+        TickType_t xMaxLateness; /**< The largest number of ticks by which the task missed a release. */
+    #endif
+
+    #if ( configUSE_IDLE_STACK_SCAN == 1 )
+        ListItem_t xStackScanListItem;               /**< Links the task into xStackScanTaskList. */
+        configSTACK_DEPTH_TYPE uxStackHighWaterMark; /**< The high water mark found by the last complete scan of the stack by the idle task. */
+    #endif
+
     #if ( configUSE_C_RUNTIME_TLS_SUPPORT == 1 )
         configTLS_BLOCK_TYPE xTLSBlock; /**< Memory block used as Thread Local Storage (TLS) Block for the task. */
     #endif
@@ -413,6 +551,11 @@ typedef struct tskTaskControlBlock       /* The old naming convention is used to
         volatile uint8_t ucNotifyState[ configTASK_NOTIFICATION_ARRAY_ENTRIES ];
     #endif
 
+    #if ( configUSE_TASK_MAILBOX == 1 )
+        uint32_t ulMailbox[ configTASK_MAILBOX_SIZE / 4 ]; /**< The message held in the mailbox. */
+        volatile uint8_t ucMailboxLength;                  /**< The length of the message held in the mailbox, or 0 if the mailbox is empty. */
+    #endif
+
     /* See the comments in FreeRTOS.h with the definition of
      * tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE. */
     #if ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 )
@@ -456,6 +599,25 @@ PRIVILEGED_DATA static List_t * volatile pxDelayedTaskList;              /**< Po
 PRIVILEGED_DATA static List_t * volatile pxOverflowDelayedTaskList;      /**< Points to the delayed task list currently being used to hold tasks that have overflowed the current tick count. */
 PRIVILEGED_DATA static List_t xPendingReadyList;                         /**< Tasks that have been readied while the scheduler was suspended.  They will be moved to the ready list when the scheduler is resumed. */
 
+#if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+
+/* Each wheel level has 32 slots, one bit of a uint32_t map per slot.  A slot
+ * on level n covers 32 ^ n ticks. */
+    #define tskWHEEL_SLOT_BITS    ( ( UBaseType_t ) 5U )
+    #define tskWHEEL_SLOTS        ( ( UBaseType_t ) 32U )
+    #define tskWHEEL_SLOT_MASK    ( ( UBaseType_t ) 31U )
+
+/* Is pxList one of the timing wheel slots? */
+    #define taskLIST_IS_DELAYED_WHEEL( pxList )                 \
+    ( ( ( pxList ) >= &( xDelayedWheel[ 0 ][ 0 ] ) ) &&         \
+      ( ( pxList ) <= &( xDelayedWheel[ configDELAYED_TASK_WHEEL_LEVELS - 1 ][ tskWHEEL_SLOT_MASK ] ) ) )
+
+    PRIVILEGED_DATA static List_t xDelayedWheel[ configDELAYED_TASK_WHEEL_LEVELS ][ 32U ];          /**< Delayed tasks with a wake time close to the tick count, hashed by wake time. */
+    PRIVILEGED_DATA static uint32_t ulDelayedWheelMap[ configDELAYED_TASK_WHEEL_LEVELS ];           /**< One bit per wheel slot that may hold tasks.  A bit can be left set after its slot was emptied. */
+    PRIVILEGED_DATA static TickType_t xDelayedWheelMin[ configDELAYED_TASK_WHEEL_LEVELS ][ 32U ];   /**< The earliest wake time held in each wheel slot. */
+
+#endif
+
 #if ( INCLUDE_vTaskDelete == 1 )
 
     PRIVILEGED_DATA static List_t xTasksWaitingTermination; /**< Tasks that have been deleted - but their memory not yet freed. */
@@ -469,6 +631,22 @@ PRIVILEGED_DATA static List_t xPendingReadyList;                         /**< Ta
 
 #endif
 
+#if ( configUSE_IDLE_STACK_SCAN == 1 )
+
+    PRIVILEGED_DATA static List_t xStackScanTaskList;                                              /**< All the tasks that have not been deleted, in the order the idle task scans their stacks. */
+    PRIVILEGED_DATA static TCB_t * pxStackScanTCB = NULL;                                          /**< The task whose stack is being scanned, or NULL to move on to the next task. */
+    PRIVILEGED_DATA static configSTACK_DEPTH_TYPE uxStackScanDepth = ( configSTACK_DEPTH_TYPE ) 0U; /**< The number of words of the stack of pxStackScanTCB found untouched so far. */
+
+#endif
+
+#if ( configUSE_TASK_BUDGETS == 1 )
+
+    PRIVILEGED_DATA static List_t xBudgetTaskList;                                  /**< Tasks that have a budget, in no particular order. */
+    PRIVILEGED_DATA static TickType_t xNextBudgetReplenishTime = ( TickType_t ) 0U; /**< The earliest replenishment of any task in xBudgetTaskList. */
+    PRIVILEGED_DATA static BaseType_t xCatchingUpPendedTicks = pdFALSE;             /**< Set while xTaskResumeAll() unwinds the pended ticks in task context. */
+
+#endif
+
 /* Global POSIX errno. Its value is changed upon context switching to match
  * the errno of the currently running task. */
 #if ( configUSE_POSIX_ERRNO == 1 )
@@ -479,6 +657,13 @@ PRIVILEGED_DATA static List_t xPendingReadyList;                         /**< Ta
 PRIVILEGED_DATA static volatile UBaseType_t uxCurrentNumberOfTasks = ( UBaseType_t ) 0U;
 PRIVILEGED_DATA static volatile TickType_t xTickCount = ( TickType_t ) configINITIAL_TICK_COUNT;
 PRIVILEGED_DATA static volatile UBaseType_t uxTopReadyPriority = tskIDLE_PRIORITY;
+
+#if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 1 )
+    #if ( configMAX_PRIORITIES > taskREADY_PRIORITY_GROUP_SIZE )
+        PRIVILEGED_DATA static volatile UBaseType_t uxReadyPriorityGroups[ taskREADY_PRIORITY_GROUPS ] = { 0U };
+    #endif
+#endif
+
 PRIVILEGED_DATA static volatile BaseType_t xSchedulerRunning = pdFALSE;
 PRIVILEGED_DATA static volatile TickType_t xPendedTicks = ( TickType_t ) 0U;
 PRIVILEGED_DATA static volatile BaseType_t xYieldPendings[ configNUMBER_OF_CORES ] = { pdFALSE };
@@ -615,6 +800,18 @@ static void prvCheckTasksWaitingTermination( void ) PRIVILEGED_FUNCTION;
 static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
                                             const BaseType_t xCanBlockIndefinitely ) PRIVILEGED_FUNCTION;
 
+/*
+ * Ends the job of the running task.  The job is closed by prvCloseTaskJob() when
+ * the task is switched out, which adds its execution time to the job statistics
+ * of the task.
+ */
+#if ( configUSE_TASK_JOB_STATS == 1 )
+
+    static void prvEndCurrentTaskJob( void ) PRIVILEGED_FUNCTION;
+    static void prvCloseTaskJob( TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+
 /*
  * Fills an TaskStatus_t structure with information on each task that is
  * referenced from the pxList list (which may be a ready list, a delayed list,
@@ -631,6 +828,29 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
 
 #endif
 
+/*
+ * Fills a TaskRunTime_t structure with the run time of each task that is
+ * referenced from the pxList list.  Must be called with the scheduler
+ * suspended.  ulNow is the current value of the run time stats clock, used to
+ * account the time of the current execution of the running task(s).
+ */
+#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configGENERATE_RUN_TIME_STATS == 1 ) )
+
+    static UBaseType_t prvListTaskRunTimesWithinSingleList( TaskRunTime_t * pxTaskRunTimeArray,
+                                                            const List_t * pxList,
+                                                            configRUN_TIME_COUNTER_TYPE ulNow ) PRIVILEGED_FUNCTION;
+
+/*
+ * Searches pxSnapshot for the run time entry of the same task as pxTaskRunTime.
+ * The search starts at uxHint, as tasks are usually found at the same position
+ * in consecutive snapshots.  Returns NULL if the task is not in the snapshot.
+ */
+    static const TaskRunTime_t * prvFindTaskRunTime( const TaskRunTimeSnapshot_t * pxSnapshot,
+                                                     const TaskRunTime_t * pxTaskRunTime,
+                                                     UBaseType_t uxHint ) PRIVILEGED_FUNCTION;
+
+#endif
+
 /*
  * Searches pxList for a task with name pcNameToQuery - returning a handle to
  * the task if it is found, or NULL if the task is not found.
@@ -674,6 +894,95 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
  */
 static void prvResetNextTaskUnblockTime( void ) PRIVILEGED_FUNCTION;
 
+/*
+ * Called by xTaskResumeAll() to process the ticks that were pended while the
+ * scheduler was suspended.  Runs of ticks on which xTaskIncrementTick() would
+ * have nothing to do are stepped over in one go, so the cost depends on the
+ * number of tasks and timers that expire, not on the number of pended ticks.
+ * Returns pdTRUE if a context switch is required.
+ */
+static BaseType_t prvCatchUpPendedTicks( TickType_t xTicksToCatchUp ) PRIVILEGED_FUNCTION;
+
+#if ( configUSE_IDLE_STACK_SCAN == 1 )
+
+/*
+ * Called by the idle task to scan the next configIDLE_STACK_SCAN_WORDS words of
+ * a task stack, and to update the cached high water mark of the task when the
+ * scan of its stack completes.
+ */
+    static void prvStackScanSlice( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configUSE_TASK_BUDGETS == 1 )
+
+/*
+ * Called by vTaskSwitchContext() after a task was selected.  If the selected
+ * task has used up its budget it is suspended or demoted, and pdTRUE is
+ * returned so another task is selected.
+ */
+    static BaseType_t prvThrottleCurrentTaskIfOverBudget( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * Give pxTCB a fresh budget, and end its throttling if it is throttled.
+ * Returns pdTRUE if the task should now preempt the running task.
+ */
+    static BaseType_t prvReplenishTaskBudget( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called by xTaskIncrementTick() to replenish the budgets whose period ended.
+ * Returns pdTRUE if a context switch is required, either because a task that
+ * was replenished should run or because the running task used up its budget.
+ */
+    static BaseType_t prvProcessTaskBudgets( const TickType_t xConstTickCount ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configUSE_EDF_SCHEDULING == 1 )
+
+/*
+ * Called by vTaskSwitchContext() when the highest priority Ready state tasks
+ * are those of priority configEDF_PRIORITY.  Replaces the round robin choice
+ * with the ready task that has the earliest absolute deadline, if any of them
+ * has a deadline.
+ */
+    static void prvSelectEarliestDeadlineTask( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+
+/*
+ * Place a Blocked state list item, whose value is its wake time, in the timing
+ * wheel if the wake time is close enough to xTickNow, or in the sorted
+ * pxSortedList otherwise.
+ */
+    static void prvDelayedWheelInsert( List_t * const pxSortedList,
+                                       ListItem_t * const pxListItem,
+                                       const TickType_t xTickNow ) PRIVILEGED_FUNCTION;
+
+/*
+ * Cascade the wheel slots that are due at xTickNow down the levels and move
+ * the tasks that wake at xTickNow into pxDelayedTaskList.
+ */
+    static void prvDelayedWheelAdvance( const TickType_t xTickNow ) PRIVILEGED_FUNCTION;
+
+/*
+ * Return the earliest time at which the timing wheel needs servicing, or
+ * portMAX_DELAY if the wheel is empty.
+ */
+    static TickType_t prvDelayedWheelNextUnblockTime( const TickType_t xTickNow ) PRIVILEGED_FUNCTION;
+
+/*
+ * Find the first non-empty slot of the wheel level uxLevel at or after the
+ * slot that holds xTickNow.
+ */
+    static BaseType_t prvDelayedWheelNearestSlot( const UBaseType_t uxLevel,
+                                                  const TickType_t xTickNow,
+                                                  UBaseType_t * const puxSlot ) PRIVILEGED_FUNCTION;
+
+#endif /* #if ( configUSE_DELAYED_TASK_WHEEL == 1 ) */
+
 #if ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 )
 
 /*
@@ -1810,10 +2119,42 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
     #endif /* portUSING_MPU_WRAPPERS == 1 */
 
     /* Avoid dependency on memset() if it is not required. */
-    #if ( tskSET_NEW_STACKS_TO_KNOWN_VALUE == 1 )
+    #if ( ( tskSET_NEW_STACKS_TO_KNOWN_VALUE == 1 ) && ( configUSE_PARTIAL_STACK_PAINTING == 1 ) )
+    {
+        /* Only fill the band at the limit of the stack with the known value.
+         * That is all the stack overflow check looks at, and the high water
+         * mark is not counted past it. */
+        uint32_t ulPaintDepth = ulStackDepth;
+
+        if( ulPaintDepth > ( uint32_t ) configSTACK_PAINT_DEPTH )
+        {
+            ulPaintDepth = ( uint32_t ) configSTACK_PAINT_DEPTH;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        portBOOT_PROFILER_STACK_PAINT_BEGIN();
+
+        #if ( portSTACK_GROWTH < 0 )
+        {
+            ( void ) memset( pxNewTCB->pxStack, ( int ) tskSTACK_FILL_BYTE, ( size_t ) ulPaintDepth * sizeof( StackType_t ) );
+        }
+        #else
+        {
+            ( void ) memset( &( pxNewTCB->pxStack[ ulStackDepth - ulPaintDepth ] ), ( int ) tskSTACK_FILL_BYTE, ( size_t ) ulPaintDepth * sizeof( StackType_t ) );
+        }
+        #endif
+
+        portBOOT_PROFILER_STACK_PAINT_END();
+    }
+    #elif ( tskSET_NEW_STACKS_TO_KNOWN_VALUE == 1 )
     {
         /* Fill the stack with a known value to assist debugging. */
+        portBOOT_PROFILER_STACK_PAINT_BEGIN();
         ( void ) memset( pxNewTCB->pxStack, ( int ) tskSTACK_FILL_BYTE, ( size_t ) ulStackDepth * sizeof( StackType_t ) );
+        portBOOT_PROFILER_STACK_PAINT_END();
     }
     #endif /* tskSET_NEW_STACKS_TO_KNOWN_VALUE */
 
@@ -1910,6 +2251,37 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
     listSET_LIST_ITEM_VALUE( &( pxNewTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxPriority );
     listSET_LIST_ITEM_OWNER( &( pxNewTCB->xEventListItem ), pxNewTCB );
 
+    #if ( configUSE_TASK_BUDGETS == 1 )
+    {
+        vListInitialiseItem( &( pxNewTCB->xBudgetListItem ) );
+        listSET_LIST_ITEM_OWNER( &( pxNewTCB->xBudgetListItem ), pxNewTCB );
+    }
+    #endif
+
+    #if ( configUSE_IDLE_STACK_SCAN == 1 )
+    {
+        vListInitialiseItem( &( pxNewTCB->xStackScanListItem ) );
+        listSET_LIST_ITEM_OWNER( &( pxNewTCB->xStackScanListItem ), pxNewTCB );
+
+        /* Nothing of the stack is known to be used until it was scanned.  The
+         * scan never counts past the painted band. */
+        pxNewTCB->uxStackHighWaterMark = ( configSTACK_DEPTH_TYPE ) ulStackDepth;
+
+        #if ( configUSE_PARTIAL_STACK_PAINTING == 1 )
+        {
+            if( ulStackDepth > ( uint32_t ) configSTACK_PAINT_DEPTH )
+            {
+                pxNewTCB->uxStackHighWaterMark = ( configSTACK_DEPTH_TYPE ) configSTACK_PAINT_DEPTH;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif
+    }
+    #endif
+
     #if ( portUSING_MPU_WRAPPERS == 1 )
     {
         vPortStoreTaskMPUSettings( &( pxNewTCB->xMPUSettings ), xRegions, pxNewTCB->pxStack, ulStackDepth );
@@ -2068,6 +2440,12 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
 
             prvAddTaskToReadyList( pxNewTCB );
 
+            #if ( configUSE_IDLE_STACK_SCAN == 1 )
+            {
+                vListInsertEnd( &xStackScanTaskList, &( pxNewTCB->xStackScanListItem ) );
+            }
+            #endif
+
             portSETUP_TCB( pxNewTCB );
         }
         taskEXIT_CRITICAL();
@@ -2232,6 +2610,36 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
                 mtCOVERAGE_TEST_MARKER();
             }
 
+            #if ( configUSE_TASK_BUDGETS == 1 )
+            {
+                if( listLIST_ITEM_CONTAINER( &( pxTCB->xBudgetListItem ) ) != NULL )
+                {
+                    ( void ) uxListRemove( &( pxTCB->xBudgetListItem ) );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif
+
+            #if ( configUSE_IDLE_STACK_SCAN == 1 )
+            {
+                ( void ) uxListRemove( &( pxTCB->xStackScanListItem ) );
+
+                /* Do not let the idle task carry on scanning a stack that is
+                 * about to be freed. */
+                if( pxStackScanTCB == pxTCB )
+                {
+                    pxStackScanTCB = NULL;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif
+
             /* Increment the uxTaskNumber also so kernel aware debuggers can
              * detect that the task lists need re-generating.  This is done before
              * portPRE_TASK_DELETE_HOOK() as in the Windows port that macro will
@@ -2351,6 +2759,10 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
         TickType_t xTimeToWake;
         BaseType_t xAlreadyYielded, xShouldDelay = pdFALSE;
 
+        #if ( configUSE_TASK_OVERRUN_HOOK == 1 )
+            TickType_t xLateness = ( TickType_t ) 0U;
+        #endif
+
         traceENTER_xTaskDelayUntil( pxPreviousWakeTime, xTimeIncrement );
 
         configASSERT( pxPreviousWakeTime );
@@ -2401,6 +2813,23 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
             /* Update the wake time ready for the next call. */
             *pxPreviousWakeTime = xTimeToWake;
 
+            #if ( configUSE_EDF_SCHEDULING == 1 )
+            {
+                /* The wake time is the release of the next job, which sets
+                 * the deadline the task is scheduled by from now on.  If the
+                 * release is already in the past the task yields below, so
+                 * a task with an earlier deadline gets to run first. */
+                if( pxCurrentTCB->xRelativeDeadline != ( TickType_t ) 0U )
+                {
+                    pxCurrentTCB->xAbsoluteDeadline = xTimeToWake + pxCurrentTCB->xRelativeDeadline;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif
+
             if( xShouldDelay != pdFALSE )
             {
                 traceTASK_DELAY_UNTIL( xTimeToWake );
@@ -2411,6 +2840,41 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
             }
             else
             {
+                #if ( configUSE_TASK_JOB_STATS == 1 )
+                {
+                    /* The task does not block, but the next job starts
+                     * here all the same. */
+                    prvEndCurrentTaskJob();
+                }
+                #endif
+
+                #if ( configUSE_TASK_OVERRUN_STATS == 1 )
+                {
+                    /* The wake time has been reached already, so the task
+                     * overran its period and missed the release. */
+                    const TickType_t xMissedBy = xConstTickCount - xTimeToWake;
+
+                    traceTASK_OVERRUN( pxCurrentTCB, xMissedBy );
+
+                    pxCurrentTCB->ulOverrunCount++;
+
+                    if( xMissedBy > pxCurrentTCB->xMaxLateness )
+                    {
+                        pxCurrentTCB->xMaxLateness = xMissedBy;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    #if ( configUSE_TASK_OVERRUN_HOOK == 1 )
+                    {
+                        xLateness = xMissedBy;
+                    }
+                    #endif
+                }
+                #endif
+
                 mtCOVERAGE_TEST_MARKER();
             }
         }
@@ -2427,6 +2891,21 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
             mtCOVERAGE_TEST_MARKER();
         }
 
+        #if ( configUSE_TASK_OVERRUN_HOOK == 1 )
+        {
+            /* The hook is called outside of the suspended scheduler so it can
+             * use the full API. */
+            if( xShouldDelay == pdFALSE )
+            {
+                vApplicationTaskOverrunHook( ( TaskHandle_t ) pxCurrentTCB, xLateness );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif
+
         traceRETURN_xTaskDelayUntil( xShouldDelay );
 
         return xShouldDelay;
@@ -2435,62 +2914,162 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
 #endif /* INCLUDE_xTaskDelayUntil */
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_vTaskDelay == 1 )
+#if ( configUSE_EDF_SCHEDULING == 1 )
 
-    void vTaskDelay( const TickType_t xTicksToDelay )
+    void vTaskSetDeadline( TaskHandle_t xTask,
+                           TickType_t xRelativeDeadline )
     {
-        BaseType_t xAlreadyYielded = pdFALSE;
-
-        traceENTER_vTaskDelay( xTicksToDelay );
-
-        /* A delay time of zero just forces a reschedule. */
-        if( xTicksToDelay > ( TickType_t ) 0U )
-        {
-            vTaskSuspendAll();
-            {
-                configASSERT( uxSchedulerSuspended == 1U );
+        TCB_t * pxTCB;
 
-                traceTASK_DELAY();
+        traceENTER_vTaskSetDeadline( xTask, xRelativeDeadline );
 
-                /* A task that is removed from the event list while the
-                 * scheduler is suspended will not get placed in the ready
-                 * list or removed from the blocked list until the scheduler
-                 * is resumed.
-                 *
-                 * This task cannot be in an event list as it is the currently
-                 * executing task. */
-                prvAddCurrentTaskToDelayedList( xTicksToDelay, pdFALSE );
-            }
-            xAlreadyYielded = xTaskResumeAll();
-        }
-        else
+        taskENTER_CRITICAL();
         {
-            mtCOVERAGE_TEST_MARKER();
-        }
+            pxTCB = prvGetTCBFromHandle( xTask );
+            configASSERT( pxTCB );
 
-        /* Force a reschedule if xTaskResumeAll has not already done so, we may
-         * have put ourselves to sleep. */
-        if( xAlreadyYielded == pdFALSE )
-        {
-            taskYIELD_WITHIN_API();
-        }
-        else
-        {
-            mtCOVERAGE_TEST_MARKER();
+            pxTCB->xRelativeDeadline = xRelativeDeadline;
+            pxTCB->xAbsoluteDeadline = xTickCount + xRelativeDeadline;
         }
+        taskEXIT_CRITICAL();
 
-        traceRETURN_vTaskDelay();
+        traceRETURN_vTaskSetDeadline();
     }
 
-#endif /* INCLUDE_vTaskDelay */
+#endif /* configUSE_EDF_SCHEDULING */
 /*-----------------------------------------------------------*/
 
-#if ( ( INCLUDE_eTaskGetState == 1 ) || ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_xTaskAbortDelay == 1 ) )
+#if ( configUSE_TASK_BUDGETS == 1 )
 
-    eTaskState eTaskGetState( TaskHandle_t xTask )
+    void vTaskSetBudget( TaskHandle_t xTask,
+                         configRUN_TIME_COUNTER_TYPE ulBudget,
+                         TickType_t xPeriod,
+                         eBudgetAction eAction )
     {
-        eTaskState eReturn;
-        List_t const * pxStateList;
+        TCB_t * pxTCB;
+        BaseType_t xYieldRequired;
+
+        traceENTER_vTaskSetBudget( xTask, ulBudget, xPeriod, eAction );
+
+        /* The replenishment times are compared relative to the tick count,
+         * which limits the period to half the tick range. */
+        configASSERT( ( ulBudget == ( configRUN_TIME_COUNTER_TYPE ) 0U ) || ( ( xPeriod > ( TickType_t ) 0U ) && ( xPeriod <= ( portMAX_DELAY >> 1 ) ) ) );
+
+        taskENTER_CRITICAL();
+        {
+            pxTCB = prvGetTCBFromHandle( xTask );
+            configASSERT( pxTCB );
+
+            /* End any throttling under the old settings first. */
+            xYieldRequired = prvReplenishTaskBudget( pxTCB );
+
+            pxTCB->ulBudget = ulBudget;
+            pxTCB->xBudgetPeriod = xPeriod;
+            pxTCB->ucBudgetAction = ( uint8_t ) eAction;
+
+            if( listLIST_ITEM_CONTAINER( &( pxTCB->xBudgetListItem ) ) != NULL )
+            {
+                ( void ) uxListRemove( &( pxTCB->xBudgetListItem ) );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( ulBudget != ( configRUN_TIME_COUNTER_TYPE ) 0U )
+            {
+                listSET_LIST_ITEM_VALUE( &( pxTCB->xBudgetListItem ), xTickCount + xPeriod );
+
+                if( ( listLIST_IS_EMPTY( &xBudgetTaskList ) != pdFALSE ) ||
+                    ( ( TickType_t ) ( xNextBudgetReplenishTime - xTickCount ) > xPeriod ) )
+                {
+                    xNextBudgetReplenishTime = xTickCount + xPeriod;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                listINSERT_END( &xBudgetTaskList, &( pxTCB->xBudgetListItem ) );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( xYieldRequired != pdFALSE )
+            {
+                taskYIELD_WITHIN_API();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        traceRETURN_vTaskSetBudget();
+    }
+
+#endif /* configUSE_TASK_BUDGETS */
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_vTaskDelay == 1 )
+
+    void vTaskDelay( const TickType_t xTicksToDelay )
+    {
+        BaseType_t xAlreadyYielded = pdFALSE;
+
+        traceENTER_vTaskDelay( xTicksToDelay );
+
+        /* A delay time of zero just forces a reschedule. */
+        if( xTicksToDelay > ( TickType_t ) 0U )
+        {
+            vTaskSuspendAll();
+            {
+                configASSERT( uxSchedulerSuspended == 1U );
+
+                traceTASK_DELAY();
+
+                /* A task that is removed from the event list while the
+                 * scheduler is suspended will not get placed in the ready
+                 * list or removed from the blocked list until the scheduler
+                 * is resumed.
+                 *
+                 * This task cannot be in an event list as it is the currently
+                 * executing task. */
+                prvAddCurrentTaskToDelayedList( xTicksToDelay, pdFALSE );
+            }
+            xAlreadyYielded = xTaskResumeAll();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        /* Force a reschedule if xTaskResumeAll has not already done so, we may
+         * have put ourselves to sleep. */
+        if( xAlreadyYielded == pdFALSE )
+        {
+            taskYIELD_WITHIN_API();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_vTaskDelay();
+    }
+
+#endif /* INCLUDE_vTaskDelay */
+/*-----------------------------------------------------------*/
+
+#if ( ( INCLUDE_eTaskGetState == 1 ) || ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_xTaskAbortDelay == 1 ) )
+
+    eTaskState eTaskGetState( TaskHandle_t xTask )
+    {
+        eTaskState eReturn;
+        List_t const * pxStateList;
         List_t const * pxEventList;
         List_t const * pxDelayedList;
         List_t const * pxOverflowedDelayedList;
@@ -2532,6 +3111,15 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
                 eReturn = eBlocked;
             }
 
+            #if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+                else if( taskLIST_IS_DELAYED_WHEEL( pxStateList ) )
+                {
+                    /* The task being queried is referenced from a slot of the
+                     * timing wheel. */
+                    eReturn = eBlocked;
+                }
+            #endif
+
             #if ( INCLUDE_vTaskSuspend == 1 )
                 else if( pxStateList == &xSuspendedTaskList )
                 {
@@ -2911,9 +3499,9 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
                     if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
                     {
                         /* It is known that the task is in its ready list so
-                         * there is no need to check again and the port level
+                         * there is no need to check again and the unchecked
                          * reset macro can be called directly. */
-                        portRESET_READY_PRIORITY( uxPriorityUsedOnEntry, uxTopReadyPriority );
+                        taskCLEAR_READY_PRIORITY( uxPriorityUsedOnEntry );
                     }
                     else
                     {
@@ -3457,7 +4045,7 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
                     {
                         /* Ready lists can be accessed so move the task from the
                          * suspended list to the ready list directly. */
-                        if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                        if( taskSHOULD_PREEMPT_CURRENT_TASK( pxTCB ) )
                         {
                             xYieldRequired = pdTRUE;
 
@@ -3660,6 +4248,8 @@ void vTaskStartScheduler( void )
 
     traceENTER_vTaskStartScheduler();
 
+    portBOOT_PROFILER_MARK( "vTaskStartScheduler" );
+
     #if ( configUSE_CORE_AFFINITY == 1 ) && ( configNUMBER_OF_CORES > 1 )
     {
         /* Sanity check that the UBaseType_t must have greater than or equal to
@@ -3668,12 +4258,14 @@ void vTaskStartScheduler( void )
     }
     #endif /* #if ( configUSE_CORE_AFFINITY == 1 ) && ( configNUMBER_OF_CORES > 1 ) */
 
+    portBOOT_PROFILER_MARK( "prvCreateIdleTasks" );
     xReturn = prvCreateIdleTasks();
 
     #if ( configUSE_TIMERS == 1 )
     {
         if( xReturn == pdPASS )
         {
+            portBOOT_PROFILER_MARK( "xTimerCreateTimerTask" );
             xReturn = xTimerCreateTimerTask();
         }
         else
@@ -3683,6 +4275,34 @@ void vTaskStartScheduler( void )
     }
     #endif /* configUSE_TIMERS */
 
+    #if ( configUSE_DEFERRED_WORK == 1 )
+    {
+        if( xReturn == pdPASS )
+        {
+            portBOOT_PROFILER_MARK( "xDeferredWorkCreateTasks" );
+            xReturn = xDeferredWorkCreateTasks();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    #endif /* configUSE_DEFERRED_WORK */
+
+    #if ( configUSE_TASK_POOL == 1 )
+    {
+        if( xReturn == pdPASS )
+        {
+            portBOOT_PROFILER_MARK( "xTaskPoolCreateTasks" );
+            xReturn = xTaskPoolCreateTasks();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    #endif /* configUSE_TASK_POOL */
+
     if( xReturn == pdPASS )
     {
         /* freertos_tasks_c_additions_init() should only be called if the user
@@ -3728,6 +4348,7 @@ void vTaskStartScheduler( void )
 
         /* The return value for xPortStartScheduler is not required
          * hence using a void datatype. */
+        portBOOT_PROFILER_MARK( "xPortStartScheduler" );
         ( void ) xPortStartScheduler();
 
         /* In most cases, xPortStartScheduler() will not return. If it
@@ -3888,6 +4509,18 @@ void vTaskSuspendAll( void )
             {
                 uxHigherPriorityReadyTasks = pdTRUE;
             }
+
+            #if ( configMAX_PRIORITIES > taskREADY_PRIORITY_GROUP_SIZE )
+            {
+                /* With the two level bitmap the least significant bit of
+                 * uxTopReadyPriority only says that some task of the lowest
+                 * 32 priorities is ready, so check that group as well. */
+                if( uxReadyPriorityGroups[ 0 ] > uxLeastSignificantBit )
+                {
+                    uxHigherPriorityReadyTasks = pdTRUE;
+                }
+            }
+            #endif
         }
         #endif /* if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 ) */
 
@@ -3913,6 +4546,47 @@ void vTaskSuspendAll( void )
         {
             xReturn = xNextTaskUnblockTime;
             xReturn -= xTickCount;
+
+            #if ( configUSE_TICK_TIMERS == 1 )
+            {
+                /* The tick interrupt also has to run when the next tick
+                 * context timer expires. */
+                const TickType_t xTickTimerIdleTime = xTimerGetNextTickTimerExpireTime() - xTickCount;
+
+                if( xTickTimerIdleTime < xReturn )
+                {
+                    xReturn = xTickTimerIdleTime;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif
+
+            #if ( configUSE_TASK_BUDGETS == 1 )
+            {
+                /* The tick interrupt also has to run when the next budget is
+                 * replenished. */
+                if( listLIST_IS_EMPTY( &xBudgetTaskList ) == pdFALSE )
+                {
+                    const TickType_t xBudgetIdleTime = xNextBudgetReplenishTime - xTickCount;
+
+                    if( xBudgetIdleTime < xReturn )
+                    {
+                        xReturn = xBudgetIdleTime;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif
         }
 
         return xReturn;
@@ -3970,7 +4644,7 @@ BaseType_t xTaskResumeAll( void )
                         {
                             /* If the moved task has a priority higher than the current
                              * task then a yield must be performed. */
-                            if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                            if( taskSHOULD_PREEMPT_CURRENT_TASK( pxTCB ) )
                             {
                                 xYieldPendings[ xCoreID ] = pdTRUE;
                             }
@@ -4013,21 +4687,16 @@ BaseType_t xTaskResumeAll( void )
 
                         if( xPendedCounts > ( TickType_t ) 0U )
                         {
-                            do
+                            if( prvCatchUpPendedTicks( xPendedCounts ) != pdFALSE )
                             {
-                                if( xTaskIncrementTick() != pdFALSE )
-                                {
-                                    /* Other cores are interrupted from
-                                     * within xTaskIncrementTick(). */
-                                    xYieldPendings[ xCoreID ] = pdTRUE;
-                                }
-                                else
-                                {
-                                    mtCOVERAGE_TEST_MARKER();
-                                }
-
-                                --xPendedCounts;
-                            } while( xPendedCounts > ( TickType_t ) 0U );
+                                /* Other cores are interrupted from
+                                 * within xTaskIncrementTick(). */
+                                xYieldPendings[ xCoreID ] = pdTRUE;
+                            }
+                            else
+                            {
+                                mtCOVERAGE_TEST_MARKER();
+                            }
 
                             xPendedTicks = 0;
                         }
@@ -4071,70 +4740,207 @@ BaseType_t xTaskResumeAll( void )
 }
 /*-----------------------------------------------------------*/
 
-TickType_t xTaskGetTickCount( void )
+static BaseType_t prvCatchUpPendedTicks( TickType_t xTicksToCatchUp )
 {
-    TickType_t xTicks;
-
-    traceENTER_xTaskGetTickCount();
+    BaseType_t xSwitchRequired = pdFALSE;
+    TickType_t xTicksToSkip;
 
-    /* Critical section required if running on a 16 bit processor. */
-    portTICK_TYPE_ENTER_CRITICAL();
+    #if ( configUSE_TASK_BUDGETS == 1 )
     {
-        xTicks = xTickCount;
+        xCatchingUpPendedTicks = pdTRUE;
     }
-    portTICK_TYPE_EXIT_CRITICAL();
-
-    traceRETURN_xTaskGetTickCount( xTicks );
-
-    return xTicks;
-}
-/*-----------------------------------------------------------*/
-
-TickType_t xTaskGetTickCountFromISR( void )
-{
-    TickType_t xReturn;
-    UBaseType_t uxSavedInterruptStatus;
-
-    traceENTER_xTaskGetTickCountFromISR();
-
-    /* RTOS ports that support interrupt nesting have the concept of a maximum
-     * system call (or maximum API call) interrupt priority.  Interrupts that are
-     * above the maximum system call priority are kept permanently enabled, even
-     * when the RTOS kernel is in a critical section, but cannot make any calls to
-     * FreeRTOS API functions.  If configASSERT() is defined in FreeRTOSConfig.h
-     * then portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
-     * failure if a FreeRTOS API function is called from an interrupt that has been
-     * assigned a priority above the configured maximum system call priority.
-     * Only FreeRTOS functions that end in FromISR can be called from interrupts
-     * that have been assigned a priority at or (logically) below the maximum
-     * system call  interrupt priority.  FreeRTOS maintains a separate interrupt
-     * safe API to ensure interrupt entry is as fast and as simple as possible.
-     * More information (albeit Cortex-M specific) is provided on the following
-     * link: https://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html */
-    portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+    #endif
 
-    uxSavedInterruptStatus = portTICK_TYPE_SET_INTERRUPT_MASK_FROM_ISR();
+    while( xTicksToCatchUp > ( TickType_t ) 0U )
     {
-        xReturn = xTickCount;
-    }
-    portTICK_TYPE_CLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+        /* The last pended tick always goes through xTaskIncrementTick(), so
+         * the per tick checks of the running task are made at least once, and
+         * so does the tick on which the tick count wraps, as it switches the
+         * delayed lists.  The budget of the running task is not checked here,
+         * see prvProcessTaskBudgets(). */
+        xTicksToSkip = xTicksToCatchUp - ( TickType_t ) 1;
 
-    traceRETURN_xTaskGetTickCountFromISR( xReturn );
+        if( ( TickType_t ) ( portMAX_DELAY - xTickCount ) < xTicksToSkip )
+        {
+            xTicksToSkip = portMAX_DELAY - xTickCount;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
 
-    return xReturn;
-}
-/*-----------------------------------------------------------*/
+        /* Stop short of the tick on which the next task leaves the Blocked
+         * state. */
+        if( xNextTaskUnblockTime > xTickCount )
+        {
+            if( ( TickType_t ) ( xNextTaskUnblockTime - xTickCount - ( TickType_t ) 1 ) < xTicksToSkip )
+            {
+                xTicksToSkip = xNextTaskUnblockTime - xTickCount - ( TickType_t ) 1;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            xTicksToSkip = 0;
+        }
 
-UBaseType_t uxTaskGetNumberOfTasks( void )
-{
-    traceENTER_uxTaskGetNumberOfTasks();
+        #if ( configUSE_TICK_TIMERS == 1 )
+        {
+            /* Likewise for the next tick context timer to expire. */
+            const TickType_t xNextTickTimerExpireTime = xTimerGetNextTickTimerExpireTime();
 
-    /* A critical section is not required because the variables are of type
-     * BaseType_t. */
-    traceRETURN_uxTaskGetNumberOfTasks( uxCurrentNumberOfTasks );
+            if( xNextTickTimerExpireTime > xTickCount )
+            {
+                if( ( TickType_t ) ( xNextTickTimerExpireTime - xTickCount - ( TickType_t ) 1 ) < xTicksToSkip )
+                {
+                    xTicksToSkip = xNextTickTimerExpireTime - xTickCount - ( TickType_t ) 1;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                xTicksToSkip = 0;
+            }
+        }
+        #endif /* if ( configUSE_TICK_TIMERS == 1 ) */
 
-    return uxCurrentNumberOfTasks;
-}
+        #if ( configUSE_TASK_BUDGETS == 1 )
+        {
+            /* Likewise for the next budget replenishment.  As in
+             * prvProcessTaskBudgets() a replenishment time no more than half
+             * the tick range behind the tick count has been reached. */
+            if( listLIST_IS_EMPTY( &xBudgetTaskList ) == pdFALSE )
+            {
+                const TickType_t xTicksToReplenish = xNextBudgetReplenishTime - xTickCount;
+
+                if( ( xTicksToReplenish == ( TickType_t ) 0 ) || ( xTicksToReplenish >= ( portMAX_DELAY >> 1 ) ) )
+                {
+                    xTicksToSkip = 0;
+                }
+                else if( ( TickType_t ) ( xTicksToReplenish - ( TickType_t ) 1 ) < xTicksToSkip )
+                {
+                    xTicksToSkip = xTicksToReplenish - ( TickType_t ) 1;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* if ( configUSE_TASK_BUDGETS == 1 ) */
+
+        if( xTicksToSkip > ( TickType_t ) 0U )
+        {
+            /* Nothing happens on the skipped ticks, only the tick count
+             * moves.  As in vTaskStepTick() the tick hook is not called for
+             * them, and it is not called while pended ticks are unwound
+             * anyway. */
+            xTickCount += xTicksToSkip;
+            xTicksToCatchUp -= xTicksToSkip;
+
+            traceINCREASE_TICK_COUNT( xTicksToSkip );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( xTaskIncrementTick() != pdFALSE )
+        {
+            xSwitchRequired = pdTRUE;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        --xTicksToCatchUp;
+    }
+
+    #if ( configUSE_TASK_BUDGETS == 1 )
+    {
+        xCatchingUpPendedTicks = pdFALSE;
+    }
+    #endif
+
+    return xSwitchRequired;
+}
+/*-----------------------------------------------------------*/
+
+TickType_t xTaskGetTickCount( void )
+{
+    TickType_t xTicks;
+
+    traceENTER_xTaskGetTickCount();
+
+    /* Critical section required if running on a 16 bit processor. */
+    portTICK_TYPE_ENTER_CRITICAL();
+    {
+        xTicks = xTickCount;
+    }
+    portTICK_TYPE_EXIT_CRITICAL();
+
+    traceRETURN_xTaskGetTickCount( xTicks );
+
+    return xTicks;
+}
+/*-----------------------------------------------------------*/
+
+TickType_t xTaskGetTickCountFromISR( void )
+{
+    TickType_t xReturn;
+    UBaseType_t uxSavedInterruptStatus;
+
+    traceENTER_xTaskGetTickCountFromISR();
+
+    /* RTOS ports that support interrupt nesting have the concept of a maximum
+     * system call (or maximum API call) interrupt priority.  Interrupts that are
+     * above the maximum system call priority are kept permanently enabled, even
+     * when the RTOS kernel is in a critical section, but cannot make any calls to
+     * FreeRTOS API functions.  If configASSERT() is defined in FreeRTOSConfig.h
+     * then portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
+     * failure if a FreeRTOS API function is called from an interrupt that has been
+     * assigned a priority above the configured maximum system call priority.
+     * Only FreeRTOS functions that end in FromISR can be called from interrupts
+     * that have been assigned a priority at or (logically) below the maximum
+     * system call  interrupt priority.  FreeRTOS maintains a separate interrupt
+     * safe API to ensure interrupt entry is as fast and as simple as possible.
+     * More information (albeit Cortex-M specific) is provided on the following
+     * link: https://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html */
+    portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+    uxSavedInterruptStatus = portTICK_TYPE_SET_INTERRUPT_MASK_FROM_ISR();
+    {
+        xReturn = xTickCount;
+    }
+    portTICK_TYPE_CLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+    traceRETURN_xTaskGetTickCountFromISR( xReturn );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxTaskGetNumberOfTasks( void )
+{
+    traceENTER_uxTaskGetNumberOfTasks();
+
+    /* A critical section is not required because the variables are of type
+     * BaseType_t. */
+    traceRETURN_uxTaskGetNumberOfTasks( uxCurrentNumberOfTasks );
+
+    return uxCurrentNumberOfTasks;
+}
 /*-----------------------------------------------------------*/
 
 char * pcTaskGetName( TaskHandle_t xTaskToQuery )
@@ -4338,6 +5144,20 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery )
                 pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxOverflowDelayedTaskList, pcNameToQuery );
             }
 
+            #if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+            {
+                UBaseType_t uxLevel, uxSlot;
+
+                for( uxLevel = 0U; ( uxLevel < ( UBaseType_t ) configDELAYED_TASK_WHEEL_LEVELS ) && ( pxTCB == NULL ); uxLevel++ )
+                {
+                    for( uxSlot = 0U; ( uxSlot < tskWHEEL_SLOTS ) && ( pxTCB == NULL ); uxSlot++ )
+                    {
+                        pxTCB = prvSearchForNameWithinSingleList( &( xDelayedWheel[ uxLevel ][ uxSlot ] ), pcNameToQuery );
+                    }
+                }
+            }
+            #endif
+
             #if ( INCLUDE_vTaskSuspend == 1 )
             {
                 if( pxTCB == NULL )
@@ -4450,6 +5270,20 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery )
                 uxTask = ( UBaseType_t ) ( uxTask + prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxDelayedTaskList, eBlocked ) );
                 uxTask = ( UBaseType_t ) ( uxTask + prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxOverflowDelayedTaskList, eBlocked ) );
 
+                #if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+                {
+                    UBaseType_t uxLevel, uxSlot;
+
+                    for( uxLevel = 0U; uxLevel < ( UBaseType_t ) configDELAYED_TASK_WHEEL_LEVELS; uxLevel++ )
+                    {
+                        for( uxSlot = 0U; uxSlot < tskWHEEL_SLOTS; uxSlot++ )
+                        {
+                            uxTask = ( UBaseType_t ) ( uxTask + prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( xDelayedWheel[ uxLevel ][ uxSlot ] ), eBlocked ) );
+                        }
+                    }
+                }
+                #endif
+
                 #if ( INCLUDE_vTaskDelete == 1 )
                 {
                     /* Fill in an TaskStatus_t structure with information on
@@ -4501,6 +5335,215 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery )
 #endif /* configUSE_TRACE_FACILITY */
 /*----------------------------------------------------------*/
 
+#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configGENERATE_RUN_TIME_STATS == 1 ) )
+
+    BaseType_t xTaskGetRunTimeSnapshot( TaskRunTimeSnapshot_t * const pxSnapshot )
+    {
+        UBaseType_t uxTask = 0, uxQueue = configMAX_PRIORITIES;
+        TaskRunTime_t * pxArray;
+        configRUN_TIME_COUNTER_TYPE ulNow;
+        BaseType_t xReturn = pdFAIL;
+
+        traceENTER_xTaskGetRunTimeSnapshot( pxSnapshot );
+
+        configASSERT( pxSnapshot );
+        pxArray = pxSnapshot->pxTaskRunTimeArray;
+
+        vTaskSuspendAll();
+        {
+            if( pxSnapshot->uxArraySize >= uxCurrentNumberOfTasks )
+            {
+                #ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+                    portALT_GET_RUN_TIME_COUNTER_VALUE( ulNow );
+                #else
+                    ulNow = ( configRUN_TIME_COUNTER_TYPE ) portGET_RUN_TIME_COUNTER_VALUE();
+                #endif
+
+                do
+                {
+                    uxQueue--;
+                    uxTask = ( UBaseType_t ) ( uxTask + prvListTaskRunTimesWithinSingleList( &( pxArray[ uxTask ] ), &( pxReadyTasksLists[ uxQueue ] ), ulNow ) );
+                } while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY );
+
+                uxTask = ( UBaseType_t ) ( uxTask + prvListTaskRunTimesWithinSingleList( &( pxArray[ uxTask ] ), pxDelayedTaskList, ulNow ) );
+                uxTask = ( UBaseType_t ) ( uxTask + prvListTaskRunTimesWithinSingleList( &( pxArray[ uxTask ] ), pxOverflowDelayedTaskList, ulNow ) );
+
+                #if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+                {
+                    UBaseType_t uxLevel, uxSlot;
+
+                    for( uxLevel = 0U; uxLevel < ( UBaseType_t ) configDELAYED_TASK_WHEEL_LEVELS; uxLevel++ )
+                    {
+                        for( uxSlot = 0U; uxSlot < tskWHEEL_SLOTS; uxSlot++ )
+                        {
+                            uxTask = ( UBaseType_t ) ( uxTask + prvListTaskRunTimesWithinSingleList( &( pxArray[ uxTask ] ), &( xDelayedWheel[ uxLevel ][ uxSlot ] ), ulNow ) );
+                        }
+                    }
+                }
+                #endif
+
+                #if ( INCLUDE_vTaskDelete == 1 )
+                {
+                    uxTask = ( UBaseType_t ) ( uxTask + prvListTaskRunTimesWithinSingleList( &( pxArray[ uxTask ] ), &xTasksWaitingTermination, ulNow ) );
+                }
+                #endif
+
+                #if ( INCLUDE_vTaskSuspend == 1 )
+                {
+                    uxTask = ( UBaseType_t ) ( uxTask + prvListTaskRunTimesWithinSingleList( &( pxArray[ uxTask ] ), &xSuspendedTaskList, ulNow ) );
+                }
+                #endif
+
+                pxSnapshot->uxNumberOfTasks = uxTask;
+                pxSnapshot->ulTotalRunTime = ulNow;
+                xReturn = pdPASS;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        ( void ) xTaskResumeAll();
+
+        traceRETURN_xTaskGetRunTimeSnapshot( xReturn );
+
+        return xReturn;
+    }
+
+#endif /* ( ( configUSE_TRACE_FACILITY == 1 ) && ( configGENERATE_RUN_TIME_STATS == 1 ) ) */
+/*----------------------------------------------------------*/
+
+#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configGENERATE_RUN_TIME_STATS == 1 ) )
+
+    UBaseType_t uxTaskGetRunTimeLoad( const TaskRunTimeSnapshot_t * const pxOldSnapshot,
+                                      const TaskRunTimeSnapshot_t * const pxNewSnapshot,
+                                      TaskLoad_t * const pxTaskLoadArray,
+                                      const UBaseType_t uxArraySize )
+    {
+        UBaseType_t uxTask, uxCount = 0;
+        configRUN_TIME_COUNTER_TYPE ulInterval, ulRunTime;
+        const TaskRunTime_t * pxNew;
+        const TaskRunTime_t * pxOld;
+
+        traceENTER_uxTaskGetRunTimeLoad( pxOldSnapshot, pxNewSnapshot, pxTaskLoadArray, uxArraySize );
+
+        configASSERT( pxOldSnapshot );
+        configASSERT( pxNewSnapshot );
+
+        /* The interval in hundredths of a percent. */
+        ulInterval = taskRUN_TIME_SINCE( pxNewSnapshot->ulTotalRunTime, pxOldSnapshot->ulTotalRunTime ) / 10000U;
+
+        for( uxTask = 0; ( uxTask < pxNewSnapshot->uxNumberOfTasks ) && ( uxCount < uxArraySize ); uxTask++ )
+        {
+            pxNew = &( pxNewSnapshot->pxTaskRunTimeArray[ uxTask ] );
+            pxOld = prvFindTaskRunTime( pxOldSnapshot, pxNew, uxTask );
+            ulRunTime = pxNew->ulRunTimeCounter;
+
+            /* A task that is not in the old snapshot was created within the
+             * interval, so all its run time was spent within the interval. */
+            if( pxOld != NULL )
+            {
+                ulRunTime -= pxOld->ulRunTimeCounter;
+            }
+
+            pxTaskLoadArray[ uxCount ].xHandle = pxNew->xHandle;
+            pxTaskLoadArray[ uxCount ].xTaskNumber = pxNew->xTaskNumber;
+            pxTaskLoadArray[ uxCount ].ulRunTime = ulRunTime;
+
+            if( ulInterval > 0U )
+            {
+                pxTaskLoadArray[ uxCount ].ulLoad = ( uint32_t ) ( ulRunTime / ulInterval );
+            }
+            else
+            {
+                pxTaskLoadArray[ uxCount ].ulLoad = 0;
+            }
+
+            uxCount++;
+        }
+
+        traceRETURN_uxTaskGetRunTimeLoad( uxCount );
+
+        return uxCount;
+    }
+
+#endif /* ( ( configUSE_TRACE_FACILITY == 1 ) && ( configGENERATE_RUN_TIME_STATS == 1 ) ) */
+/*----------------------------------------------------------*/
+
+#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configGENERATE_RUN_TIME_STATS == 1 ) )
+
+    void vTaskLoadWindowInitialise( TaskLoadWindow_t * const pxWindow,
+                                    TaskRunTimeSnapshot_t * const pxSnapshots,
+                                    const UBaseType_t uxNumberOfSnapshots )
+    {
+        configASSERT( pxWindow );
+        configASSERT( pxSnapshots );
+        configASSERT( uxNumberOfSnapshots >= 2U );
+
+        pxWindow->pxSnapshots = pxSnapshots;
+        pxWindow->uxNumberOfSnapshots = uxNumberOfSnapshots;
+        pxWindow->uxNextSnapshot = 0;
+        pxWindow->uxValidSnapshots = 0;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xTaskLoadWindowSample( TaskLoadWindow_t * const pxWindow )
+    {
+        BaseType_t xReturn;
+
+        configASSERT( pxWindow );
+
+        xReturn = xTaskGetRunTimeSnapshot( &( pxWindow->pxSnapshots[ pxWindow->uxNextSnapshot ] ) );
+
+        if( xReturn == pdPASS )
+        {
+            pxWindow->uxNextSnapshot++;
+
+            if( pxWindow->uxNextSnapshot >= pxWindow->uxNumberOfSnapshots )
+            {
+                pxWindow->uxNextSnapshot = 0;
+            }
+
+            if( pxWindow->uxValidSnapshots < pxWindow->uxNumberOfSnapshots )
+            {
+                pxWindow->uxValidSnapshots++;
+            }
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    UBaseType_t uxTaskLoadWindowGet( const TaskLoadWindow_t * const pxWindow,
+                                     UBaseType_t uxSamples,
+                                     TaskLoad_t * const pxTaskLoadArray,
+                                     const UBaseType_t uxArraySize )
+    {
+        UBaseType_t uxNewest, uxOldest, uxReturn = 0;
+
+        configASSERT( pxWindow );
+
+        /* At least two snapshots are needed to compute the load. */
+        if( pxWindow->uxValidSnapshots >= 2U )
+        {
+            /* Clamp the window to the snapshots that are available. */
+            if( ( uxSamples == 0U ) || ( uxSamples >= pxWindow->uxValidSnapshots ) )
+            {
+                uxSamples = pxWindow->uxValidSnapshots - 1U;
+            }
+
+            uxNewest = ( pxWindow->uxNextSnapshot + pxWindow->uxNumberOfSnapshots - 1U ) % pxWindow->uxNumberOfSnapshots;
+            uxOldest = ( uxNewest + pxWindow->uxNumberOfSnapshots - uxSamples ) % pxWindow->uxNumberOfSnapshots;
+
+            uxReturn = uxTaskGetRunTimeLoad( &( pxWindow->pxSnapshots[ uxOldest ] ), &( pxWindow->pxSnapshots[ uxNewest ] ), pxTaskLoadArray, uxArraySize );
+        }
+
+        return uxReturn;
+    }
+
+#endif /* ( ( configUSE_TRACE_FACILITY == 1 ) && ( configGENERATE_RUN_TIME_STATS == 1 ) ) */
+/*----------------------------------------------------------*/
+
 #if ( INCLUDE_xTaskGetIdleTaskHandle == 1 )
 
     #if ( configNUMBER_OF_CORES == 1 )
@@ -4671,7 +5714,7 @@ BaseType_t xTaskCatchUpTicks( TickType_t xTicksToCatchUp )
                         /* Preemption is on, but a context switch should only be
                          * performed if the unblocked task has a priority that is
                          * higher than the currently executing task. */
-                        if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                        if( taskSHOULD_PREEMPT_CURRENT_TASK( pxTCB ) )
                         {
                             /* Pend the yield to be performed when the scheduler
                              * is unsuspended. */
@@ -4755,6 +5798,15 @@ BaseType_t xTaskIncrementTick( void )
          * look any further down the list. */
         if( xConstTickCount >= xNextTaskUnblockTime )
         {
+            #if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+            {
+                /* Move the tasks that wake on this tick out of the timing wheel
+                 * and into the delayed list, where the loop below unblocks
+                 * them. */
+                prvDelayedWheelAdvance( xConstTickCount );
+            }
+            #endif
+
             for( ; ; )
             {
                 if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
@@ -4826,7 +5878,7 @@ BaseType_t xTaskIncrementTick( void )
                              * processing time (which happens when both
                              * preemption and time slicing are on) is
                              * handled below.*/
-                            if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                            if( taskSHOULD_PREEMPT_CURRENT_TASK( pxTCB ) )
                             {
                                 xSwitchRequired = pdTRUE;
                             }
@@ -4844,16 +5896,55 @@ BaseType_t xTaskIncrementTick( void )
                     #endif /* #if ( configUSE_PREEMPTION == 1 ) */
                 }
             }
-        }
 
-        /* Tasks of equal priority to the currently running task will share
-         * processing time (time slice) if preemption is on, and the application
-         * writer has not explicitly turned time slicing off. */
-        #if ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) )
-        {
-            #if ( configNUMBER_OF_CORES == 1 )
+            #if ( configUSE_DELAYED_TASK_WHEEL == 1 )
             {
-                if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ) ) > 1U )
+                /* The loop above only looked at the sorted delayed list, the
+                 * wheel may need servicing earlier. */
+                xItemValue = prvDelayedWheelNextUnblockTime( xConstTickCount );
+
+                if( xItemValue < xNextTaskUnblockTime )
+                {
+                    xNextTaskUnblockTime = xItemValue;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif /* #if ( configUSE_DELAYED_TASK_WHEEL == 1 ) */
+        }
+
+        #if ( configUSE_TICK_TIMERS == 1 )
+        {
+            /* Call the callbacks of the tick context timers that expire on
+             * this tick.  A task they unblock sets xYieldPendings, which is
+             * checked below. */
+            vTimerProcessTickTimers( xConstTickCount );
+        }
+        #endif
+
+        #if ( configUSE_TASK_BUDGETS == 1 )
+        {
+            if( prvProcessTaskBudgets( xConstTickCount ) != pdFALSE )
+            {
+                xSwitchRequired = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif
+
+        /* Tasks of equal priority to the currently running task will share
+         * processing time (time slice) if preemption is on, and the application
+         * writer has not explicitly turned time slicing off. */
+        #if ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) )
+        {
+            #if ( configNUMBER_OF_CORES == 1 )
+            {
+                if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ) ) > 1U )
                 {
                     xSwitchRequired = pdTRUE;
                 }
@@ -5091,206 +6182,580 @@ BaseType_t xTaskIncrementTick( void )
 #endif /* configUSE_APPLICATION_TASK_TAG */
 /*-----------------------------------------------------------*/
 
-#if ( configNUMBER_OF_CORES == 1 )
-    void vTaskSwitchContext( void )
+#if ( configUSE_TASK_BUDGETS == 1 )
+
+    static BaseType_t prvThrottleCurrentTaskIfOverBudget( void )
     {
-        traceENTER_vTaskSwitchContext();
+        TCB_t * const pxTCB = pxCurrentTCB;
+        BaseType_t xReturn = pdFALSE;
 
-        if( uxSchedulerSuspended != ( UBaseType_t ) 0U )
-        {
-            /* The scheduler is currently suspended - do not allow a context
-             * switch. */
-            xYieldPendings[ 0 ] = pdTRUE;
-        }
-        else
+        if( ( taskBUDGET_CAN_THROTTLE( pxTCB ) ) && ( pxTCB->ulBudgetUsed >= pxTCB->ulBudget ) )
         {
-            xYieldPendings[ 0 ] = pdFALSE;
-            traceTASK_SWITCHED_OUT();
+            traceTASK_BUDGET_THROTTLED( pxTCB );
 
-            #if ( configGENERATE_RUN_TIME_STATS == 1 )
+            pxTCB->ucBudgetThrottled = ( uint8_t ) pdTRUE;
+
+            /* The task was selected, so it is in a ready list. */
+            if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
             {
-                #ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
-                    portALT_GET_RUN_TIME_COUNTER_VALUE( ulTotalRunTime[ 0 ] );
+                taskRESET_READY_PRIORITY( pxTCB->uxPriority );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( pxTCB->ucBudgetAction == ( uint8_t ) eBudgetSuspend )
+            {
+                listINSERT_END( &xSuspendedTaskList, &( pxTCB->xStateListItem ) );
+            }
+            else
+            {
+                pxTCB->uxBudgetSavedPriority = taskBUDGET_BASE_PRIORITY( pxTCB );
+
+                #if ( configUSE_MUTEXES == 1 )
+                {
+                    /* A task that inherited a priority keeps it until it
+                     * gives the mutex back, and then drops to the demoted
+                     * base priority. */
+                    if( pxTCB->uxPriority == pxTCB->uxBasePriority )
+                    {
+                        pxTCB->uxPriority = ( UBaseType_t ) configTASK_BUDGET_BACKGROUND_PRIORITY;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    pxTCB->uxBasePriority = ( UBaseType_t ) configTASK_BUDGET_BACKGROUND_PRIORITY;
+                }
                 #else
-                    ulTotalRunTime[ 0 ] = portGET_RUN_TIME_COUNTER_VALUE();
+                {
+                    pxTCB->uxPriority = ( UBaseType_t ) configTASK_BUDGET_BACKGROUND_PRIORITY;
+                }
                 #endif
 
-                /* Add the amount of time the task has been running to the
-                 * accumulated time so far.  The time the task started running was
-                 * stored in ulTaskSwitchedInTime.  Note that there is no overflow
-                 * protection here so count values are only valid until the timer
-                 * overflows.  The guard against negative values is to protect
-                 * against suspect run time stat counter implementations - which
-                 * are provided by the application, not the kernel. */
-                if( ulTotalRunTime[ 0 ] > ulTaskSwitchedInTime[ 0 ] )
+                if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == ( ( TickType_t ) 0UL ) )
                 {
-                    pxCurrentTCB->ulRunTimeCounter += ( ulTotalRunTime[ 0 ] - ulTaskSwitchedInTime[ 0 ] );
+                    listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) pxTCB->uxPriority ) );
                 }
                 else
                 {
                     mtCOVERAGE_TEST_MARKER();
                 }
 
-                ulTaskSwitchedInTime[ 0 ] = ulTotalRunTime[ 0 ];
-            }
-            #endif /* configGENERATE_RUN_TIME_STATS */
-
-            /* Check for stack overflow, if configured. */
-            taskCHECK_FOR_STACK_OVERFLOW();
-
-            /* Before the currently running task is switched out, save its errno. */
-            #if ( configUSE_POSIX_ERRNO == 1 )
-            {
-                pxCurrentTCB->iTaskErrno = FreeRTOS_errno;
-            }
-            #endif
-
-            /* Select a new task to run using either the generic C or port
-             * optimised asm code. */
-            /* MISRA Ref 11.5.3 [Void pointer assignment] */
-            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
-            /* coverity[misra_c_2012_rule_11_5_violation] */
-            taskSELECT_HIGHEST_PRIORITY_TASK();
-            traceTASK_SWITCHED_IN();
-
-            /* Macro to inject port specific behaviour immediately after
-             * switching tasks, such as setting an end of stack watchpoint
-             * or reconfiguring the MPU. */
-            portTASK_SWITCH_HOOK( pxCurrentTCB );
-
-            /* After the new task is switched in, update the global errno. */
-            #if ( configUSE_POSIX_ERRNO == 1 )
-            {
-                FreeRTOS_errno = pxCurrentTCB->iTaskErrno;
+                prvAddTaskToReadyList( pxTCB );
             }
-            #endif
 
-            #if ( configUSE_C_RUNTIME_TLS_SUPPORT == 1 )
-            {
-                /* Switch C-Runtime's TLS Block to point to the TLS
-                 * Block specific to this task. */
-                configSET_TLS_BLOCK( pxCurrentTCB->xTLSBlock );
-            }
-            #endif
+            xReturn = pdTRUE;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
         }
 
-        traceRETURN_vTaskSwitchContext();
+        return xReturn;
     }
-#else /* if ( configNUMBER_OF_CORES == 1 ) */
-    void vTaskSwitchContext( BaseType_t xCoreID )
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvReplenishTaskBudget( TCB_t * pxTCB )
     {
-        traceENTER_vTaskSwitchContext();
+        BaseType_t xReturn = pdFALSE;
 
-        /* Acquire both locks:
-         * - The ISR lock protects the ready list from simultaneous access by
-         *   both other ISRs and tasks.
-         * - We also take the task lock to pause here in case another core has
-         *   suspended the scheduler. We don't want to simply set xYieldPending
-         *   and move on if another core suspended the scheduler. We should only
-         *   do that if the current core has suspended the scheduler. */
+        traceTASK_BUDGET_REPLENISHED( pxTCB );
 
-        portGET_TASK_LOCK(); /* Must always acquire the task lock first. */
-        portGET_ISR_LOCK();
+        pxTCB->ulBudgetUsed = ( configRUN_TIME_COUNTER_TYPE ) 0U;
+
+        if( pxTCB->ucBudgetThrottled != ( uint8_t ) pdFALSE )
         {
-            /* vTaskSwitchContext() must never be called from within a critical section.
-             * This is not necessarily true for single core FreeRTOS, but it is for this
-             * SMP port. */
-            configASSERT( portGET_CRITICAL_NESTING_COUNT() == 0 );
+            pxTCB->ucBudgetThrottled = ( uint8_t ) pdFALSE;
 
-            if( uxSchedulerSuspended != ( UBaseType_t ) 0U )
-            {
-                /* The scheduler is currently suspended - do not allow a context
-                 * switch. */
-                xYieldPendings[ xCoreID ] = pdTRUE;
-            }
-            else
+            if( pxTCB->ucBudgetAction == ( uint8_t ) eBudgetSuspend )
             {
-                xYieldPendings[ xCoreID ] = pdFALSE;
-                traceTASK_SWITCHED_OUT();
-
-                #if ( configGENERATE_RUN_TIME_STATS == 1 )
+                /* The application may have resumed the task already. */
+                if( prvTaskIsTaskSuspended( pxTCB ) != pdFALSE )
                 {
-                    #ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
-                        portALT_GET_RUN_TIME_COUNTER_VALUE( ulTotalRunTime[ xCoreID ] );
-                    #else
-                        ulTotalRunTime[ xCoreID ] = portGET_RUN_TIME_COUNTER_VALUE();
-                    #endif
+                    ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+                    prvAddTaskToReadyList( pxTCB );
 
-                    /* Add the amount of time the task has been running to the
-                     * accumulated time so far.  The time the task started running was
-                     * stored in ulTaskSwitchedInTime.  Note that there is no overflow
-                     * protection here so count values are only valid until the timer
-                     * overflows.  The guard against negative values is to protect
-                     * against suspect run time stat counter implementations - which
-                     * are provided by the application, not the kernel. */
-                    if( ulTotalRunTime[ xCoreID ] > ulTaskSwitchedInTime[ xCoreID ] )
+                    if( taskSHOULD_PREEMPT_CURRENT_TASK( pxTCB ) )
                     {
-                        pxCurrentTCBs[ xCoreID ]->ulRunTimeCounter += ( ulTotalRunTime[ xCoreID ] - ulTaskSwitchedInTime[ xCoreID ] );
+                        xReturn = pdTRUE;
                     }
                     else
                     {
                         mtCOVERAGE_TEST_MARKER();
                     }
-
-                    ulTaskSwitchedInTime[ xCoreID ] = ulTotalRunTime[ xCoreID ];
                 }
-                #endif /* configGENERATE_RUN_TIME_STATS */
-
-                /* Check for stack overflow, if configured. */
-                taskCHECK_FOR_STACK_OVERFLOW();
-
-                /* Before the currently running task is switched out, save its errno. */
-                #if ( configUSE_POSIX_ERRNO == 1 )
+                else
                 {
-                    pxCurrentTCBs[ xCoreID ]->iTaskErrno = FreeRTOS_errno;
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else if( taskBUDGET_BASE_PRIORITY( pxTCB ) == ( UBaseType_t ) configTASK_BUDGET_BACKGROUND_PRIORITY )
+            {
+                #if ( configUSE_MUTEXES == 1 )
+                {
+                    pxTCB->uxBasePriority = pxTCB->uxBudgetSavedPriority;
                 }
                 #endif
 
-                /* Select a new task to run. */
-                taskSELECT_HIGHEST_PRIORITY_TASK( xCoreID );
-                traceTASK_SWITCHED_IN();
+                /* Restore the priority the task had before it was demoted,
+                 * moving it to the matching ready list if it is ready.  A
+                 * higher priority inherited in the meantime is kept. */
+                if( ( pxTCB->uxPriority != ( UBaseType_t ) configTASK_BUDGET_BACKGROUND_PRIORITY ) &&
+                    ( pxTCB->uxPriority >= pxTCB->uxBudgetSavedPriority ) )
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+                else if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxTCB->uxPriority ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
+                {
+                    if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+                    {
+                        taskCLEAR_READY_PRIORITY( pxTCB->uxPriority );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
 
-                /* Macro to inject port specific behaviour immediately after
-                 * switching tasks, such as setting an end of stack watchpoint
-                 * or reconfiguring the MPU. */
-                portTASK_SWITCH_HOOK( pxCurrentTCBs[ portGET_CORE_ID() ] );
+                    pxTCB->uxPriority = pxTCB->uxBudgetSavedPriority;
+                    prvAddTaskToReadyList( pxTCB );
 
-                /* After the new task is switched in, update the global errno. */
-                #if ( configUSE_POSIX_ERRNO == 1 )
+                    if( taskSHOULD_PREEMPT_CURRENT_TASK( pxTCB ) )
+                    {
+                        xReturn = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
                 {
-                    FreeRTOS_errno = pxCurrentTCBs[ xCoreID ]->iTaskErrno;
+                    pxTCB->uxPriority = pxTCB->uxBudgetSavedPriority;
                 }
-                #endif
 
-                #if ( configUSE_C_RUNTIME_TLS_SUPPORT == 1 )
+                if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == ( ( TickType_t ) 0UL ) )
                 {
-                    /* Switch C-Runtime's TLS Block to point to the TLS
-                     * Block specific to this task. */
-                    configSET_TLS_BLOCK( pxCurrentTCBs[ xCoreID ]->xTLSBlock );
+                    listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) pxTCB->uxPriority ) );
                 }
-                #endif
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                /* The priority was changed while the task was demoted, keep
+                 * the new priority. */
+                mtCOVERAGE_TEST_MARKER();
             }
         }
-        portRELEASE_ISR_LOCK();
-        portRELEASE_TASK_LOCK();
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
 
-        traceRETURN_vTaskSwitchContext();
+        return xReturn;
     }
-#endif /* if ( configNUMBER_OF_CORES > 1 ) */
 /*-----------------------------------------------------------*/
 
-void vTaskPlaceOnEventList( List_t * const pxEventList,
-                            const TickType_t xTicksToWait )
-{
-    traceENTER_vTaskPlaceOnEventList( pxEventList, xTicksToWait );
+    static BaseType_t prvProcessTaskBudgets( const TickType_t xConstTickCount )
+    {
+        BaseType_t xSwitchRequired = pdFALSE;
+        const ListItem_t * pxEndMarker = listGET_END_MARKER( &xBudgetTaskList );
+        ListItem_t * pxIterator;
+        TCB_t * pxTCB;
+        TickType_t xReplenishTime, xTicksToNext;
+        configRUN_TIME_COUNTER_TYPE ulRunTime;
 
-    configASSERT( pxEventList );
+        if( listLIST_IS_EMPTY( &xBudgetTaskList ) == pdFALSE )
+        {
+            /* Periods are at most half the tick range, so a replenishment
+             * time no more than that behind the tick count has been reached.
+             * The check also catches up after a tickless idle period. */
+            if( ( TickType_t ) ( xConstTickCount - xNextBudgetReplenishTime ) <= ( portMAX_DELAY >> 1 ) )
+            {
+                xTicksToNext = portMAX_DELAY;
 
-    /* THIS FUNCTION MUST BE CALLED WITH THE
-     * SCHEDULER SUSPENDED AND THE QUEUE BEING ACCESSED LOCKED. */
+                for( pxIterator = listGET_HEAD_ENTRY( &xBudgetTaskList ); pxIterator != pxEndMarker; pxIterator = listGET_NEXT( pxIterator ) )
+                {
+                    /* MISRA Ref 11.5.3 [Void pointer assignment] */
+                    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+                    /* coverity[misra_c_2012_rule_11_5_violation] */
+                    pxTCB = listGET_LIST_ITEM_OWNER( pxIterator );
+                    xReplenishTime = listGET_LIST_ITEM_VALUE( pxIterator );
 
-    /* Place the event list item of the TCB in the appropriate event list.
-     * This is placed in the list in priority order so the highest priority task
+                    if( ( TickType_t ) ( xConstTickCount - xReplenishTime ) <= ( portMAX_DELAY >> 1 ) )
+                    {
+                        if( prvReplenishTaskBudget( pxTCB ) != pdFALSE )
+                        {
+                            xSwitchRequired = pdTRUE;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+
+                        xReplenishTime += pxTCB->xBudgetPeriod;
+
+                        if( ( TickType_t ) ( xConstTickCount - xReplenishTime ) <= ( portMAX_DELAY >> 1 ) )
+                        {
+                            /* More than a whole period was missed, start the
+                             * next period from now. */
+                            xReplenishTime = xConstTickCount + pxTCB->xBudgetPeriod;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+
+                        listSET_LIST_ITEM_VALUE( pxIterator, xReplenishTime );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    if( ( TickType_t ) ( xReplenishTime - xConstTickCount ) < xTicksToNext )
+                    {
+                        xTicksToNext = ( TickType_t ) ( xReplenishTime - xConstTickCount );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+
+                xNextBudgetReplenishTime = xConstTickCount + xTicksToNext;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            /* A task that does not block is only charged when it is switched
+             * out, so switch it out once it has used up its budget.  This is
+             * only checked from the tick interrupt: while the pended ticks are
+             * unwound the running task is the one resuming the scheduler, and
+             * the run time counter can not be read cheaply from task context
+             * on every port. */
+            if( ( xCatchingUpPendedTicks == pdFALSE ) && taskBUDGET_CAN_THROTTLE( pxCurrentTCB ) )
+            {
+                #ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+                    portALT_GET_RUN_TIME_COUNTER_VALUE( ulRunTime );
+                #else
+                    ulRunTime = portGET_RUN_TIME_COUNTER_VALUE();
+                #endif
+
+                if( ( pxCurrentTCB->ulBudgetUsed + taskRUN_TIME_SINCE( ulRunTime, ulTaskSwitchedInTime[ 0 ] ) ) >= pxCurrentTCB->ulBudget )
+                {
+                    xSwitchRequired = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xSwitchRequired;
+    }
+
+#endif /* configUSE_TASK_BUDGETS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_SCHEDULING == 1 )
+
+    static void prvSelectEarliestDeadlineTask( void )
+    {
+        const List_t * const pxReadyList = &( pxReadyTasksLists[ configEDF_PRIORITY ] );
+        const ListItem_t * pxEndMarker = listGET_END_MARKER( pxReadyList );
+        ListItem_t * pxIterator;
+        TCB_t * pxTCB;
+        TCB_t * pxEarliestTCB;
+
+        /* Start from the round robin choice, so tasks without a deadline, and
+         * tasks with equal deadlines, still take turns. */
+        pxEarliestTCB = pxCurrentTCB;
+
+        for( pxIterator = listGET_HEAD_ENTRY( pxReadyList ); pxIterator != pxEndMarker; pxIterator = listGET_NEXT( pxIterator ) )
+        {
+            /* MISRA Ref 11.5.3 [Void pointer assignment] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+            /* coverity[misra_c_2012_rule_11_5_violation] */
+            pxTCB = listGET_LIST_ITEM_OWNER( pxIterator );
+
+            if( taskEDF_DEADLINE_IS_EARLIER( pxTCB, pxEarliestTCB ) )
+            {
+                pxEarliestTCB = pxTCB;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        pxCurrentTCB = pxEarliestTCB;
+    }
+
+#endif /* configUSE_EDF_SCHEDULING */
+/*-----------------------------------------------------------*/
+
+#if ( configNUMBER_OF_CORES == 1 )
+    void vTaskSwitchContext( void )
+    {
+        traceENTER_vTaskSwitchContext();
+
+        if( uxSchedulerSuspended != ( UBaseType_t ) 0U )
+        {
+            /* The scheduler is currently suspended - do not allow a context
+             * switch. */
+            xYieldPendings[ 0 ] = pdTRUE;
+        }
+        else
+        {
+            xYieldPendings[ 0 ] = pdFALSE;
+            traceTASK_SWITCHED_OUT();
+
+            #if ( configGENERATE_RUN_TIME_STATS == 1 )
+            {
+                configRUN_TIME_COUNTER_TYPE ulSlice;
+
+                #ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+                    portALT_GET_RUN_TIME_COUNTER_VALUE( ulTotalRunTime[ 0 ] );
+                #else
+                    ulTotalRunTime[ 0 ] = portGET_RUN_TIME_COUNTER_VALUE();
+                #endif
+
+                /* Add the amount of time the task has been running to the
+                 * accumulated time so far.  The time the task started running was
+                 * stored in ulTaskSwitchedInTime. */
+                ulSlice = taskRUN_TIME_SINCE( ulTotalRunTime[ 0 ], ulTaskSwitchedInTime[ 0 ] );
+                pxCurrentTCB->ulRunTimeCounter += ulSlice;
+
+                #if ( configUSE_TASK_BUDGETS == 1 )
+                {
+                    /* Charge the run time to the budget, which is only looked
+                     * at if the task has one. */
+                    pxCurrentTCB->ulBudgetUsed += ulSlice;
+                }
+                #endif
+
+                #if ( configUSE_TASK_JOB_STATS == 1 )
+                {
+                    /* Same as the budget.  A job that ended while the task was
+                     * running is complete now. */
+                    pxCurrentTCB->ulJobExecutionTime += ulSlice;
+
+                    if( pxCurrentTCB->ucJobEnded != ( uint8_t ) pdFALSE )
+                    {
+                        prvCloseTaskJob( pxCurrentTCB );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                #endif
+
+                ulTaskSwitchedInTime[ 0 ] = ulTotalRunTime[ 0 ];
+            }
+            #endif /* configGENERATE_RUN_TIME_STATS */
+
+            /* Check for stack overflow, if configured. */
+            taskCHECK_FOR_STACK_OVERFLOW();
+
+            /* Before the currently running task is switched out, save its errno. */
+            #if ( configUSE_POSIX_ERRNO == 1 )
+            {
+                pxCurrentTCB->iTaskErrno = FreeRTOS_errno;
+            }
+            #endif
+
+            /* Select a new task to run using either the generic C or port
+             * optimised asm code. */
+            /* MISRA Ref 11.5.3 [Void pointer assignment] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+            /* coverity[misra_c_2012_rule_11_5_violation] */
+            taskSELECT_HIGHEST_PRIORITY_TASK();
+
+            #if ( configUSE_EDF_SCHEDULING == 1 )
+            {
+                if( pxCurrentTCB->uxPriority == ( UBaseType_t ) configEDF_PRIORITY )
+                {
+                    prvSelectEarliestDeadlineTask();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif
+
+            #if ( configUSE_TASK_BUDGETS == 1 )
+            {
+                /* A task that has used up its budget is suspended or demoted
+                 * instead of being switched in, then the selection is made
+                 * again. */
+                while( prvThrottleCurrentTaskIfOverBudget() != pdFALSE )
+                {
+                    taskSELECT_HIGHEST_PRIORITY_TASK();
+
+                    #if ( configUSE_EDF_SCHEDULING == 1 )
+                    {
+                        if( pxCurrentTCB->uxPriority == ( UBaseType_t ) configEDF_PRIORITY )
+                        {
+                            prvSelectEarliestDeadlineTask();
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    #endif
+                }
+            }
+            #endif
+
+            traceTASK_SWITCHED_IN();
+
+            /* Macro to inject port specific behaviour immediately after
+             * switching tasks, such as setting an end of stack watchpoint
+             * or reconfiguring the MPU. */
+            portTASK_SWITCH_HOOK( pxCurrentTCB );
+
+            /* After the new task is switched in, update the global errno. */
+            #if ( configUSE_POSIX_ERRNO == 1 )
+            {
+                FreeRTOS_errno = pxCurrentTCB->iTaskErrno;
+            }
+            #endif
+
+            #if ( configUSE_C_RUNTIME_TLS_SUPPORT == 1 )
+            {
+                /* Switch C-Runtime's TLS Block to point to the TLS
+                 * Block specific to this task. */
+                configSET_TLS_BLOCK( pxCurrentTCB->xTLSBlock );
+            }
+            #endif
+        }
+
+        traceRETURN_vTaskSwitchContext();
+    }
+#else /* if ( configNUMBER_OF_CORES == 1 ) */
+    void vTaskSwitchContext( BaseType_t xCoreID )
+    {
+        traceENTER_vTaskSwitchContext();
+
+        /* Acquire both locks:
+         * - The ISR lock protects the ready list from simultaneous access by
+         *   both other ISRs and tasks.
+         * - We also take the task lock to pause here in case another core has
+         *   suspended the scheduler. We don't want to simply set xYieldPending
+         *   and move on if another core suspended the scheduler. We should only
+         *   do that if the current core has suspended the scheduler. */
+
+        portGET_TASK_LOCK(); /* Must always acquire the task lock first. */
+        portGET_ISR_LOCK();
+        {
+            /* vTaskSwitchContext() must never be called from within a critical section.
+             * This is not necessarily true for single core FreeRTOS, but it is for this
+             * SMP port. */
+            configASSERT( portGET_CRITICAL_NESTING_COUNT() == 0 );
+
+            if( uxSchedulerSuspended != ( UBaseType_t ) 0U )
+            {
+                /* The scheduler is currently suspended - do not allow a context
+                 * switch. */
+                xYieldPendings[ xCoreID ] = pdTRUE;
+            }
+            else
+            {
+                xYieldPendings[ xCoreID ] = pdFALSE;
+                traceTASK_SWITCHED_OUT();
+
+                #if ( configGENERATE_RUN_TIME_STATS == 1 )
+                {
+                    #ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+                        portALT_GET_RUN_TIME_COUNTER_VALUE( ulTotalRunTime[ xCoreID ] );
+                    #else
+                        ulTotalRunTime[ xCoreID ] = portGET_RUN_TIME_COUNTER_VALUE();
+                    #endif
+
+                    /* Add the amount of time the task has been running to the
+                     * accumulated time so far.  The time the task started running was
+                     * stored in ulTaskSwitchedInTime. */
+                    pxCurrentTCBs[ xCoreID ]->ulRunTimeCounter += taskRUN_TIME_SINCE( ulTotalRunTime[ xCoreID ], ulTaskSwitchedInTime[ xCoreID ] );
+
+                    ulTaskSwitchedInTime[ xCoreID ] = ulTotalRunTime[ xCoreID ];
+                }
+                #endif /* configGENERATE_RUN_TIME_STATS */
+
+                /* Check for stack overflow, if configured. */
+                taskCHECK_FOR_STACK_OVERFLOW();
+
+                /* Before the currently running task is switched out, save its errno. */
+                #if ( configUSE_POSIX_ERRNO == 1 )
+                {
+                    pxCurrentTCBs[ xCoreID ]->iTaskErrno = FreeRTOS_errno;
+                }
+                #endif
+
+                /* Select a new task to run. */
+                taskSELECT_HIGHEST_PRIORITY_TASK( xCoreID );
+                traceTASK_SWITCHED_IN();
+
+                /* Macro to inject port specific behaviour immediately after
+                 * switching tasks, such as setting an end of stack watchpoint
+                 * or reconfiguring the MPU. */
+                portTASK_SWITCH_HOOK( pxCurrentTCBs[ portGET_CORE_ID() ] );
+
+                /* After the new task is switched in, update the global errno. */
+                #if ( configUSE_POSIX_ERRNO == 1 )
+                {
+                    FreeRTOS_errno = pxCurrentTCBs[ xCoreID ]->iTaskErrno;
+                }
+                #endif
+
+                #if ( configUSE_C_RUNTIME_TLS_SUPPORT == 1 )
+                {
+                    /* Switch C-Runtime's TLS Block to point to the TLS
+                     * Block specific to this task. */
+                    configSET_TLS_BLOCK( pxCurrentTCBs[ xCoreID ]->xTLSBlock );
+                }
+                #endif
+            }
+        }
+        portRELEASE_ISR_LOCK();
+        portRELEASE_TASK_LOCK();
+
+        traceRETURN_vTaskSwitchContext();
+    }
+#endif /* if ( configNUMBER_OF_CORES > 1 ) */
+/*-----------------------------------------------------------*/
+
+void vTaskPlaceOnEventList( List_t * const pxEventList,
+                            const TickType_t xTicksToWait )
+{
+    traceENTER_vTaskPlaceOnEventList( pxEventList, xTicksToWait );
+
+    configASSERT( pxEventList );
+
+    /* THIS FUNCTION MUST BE CALLED WITH THE
+     * SCHEDULER SUSPENDED AND THE QUEUE BEING ACCESSED LOCKED. */
+
+    /* Place the event list item of the TCB in the appropriate event list.
+     * This is placed in the list in priority order so the highest priority task
      * is the first to be woken by the event.
      *
      * Note: Lists are sorted in ascending order by ListItem_t.xItemValue.
@@ -5432,7 +6897,7 @@ BaseType_t xTaskRemoveFromEventList( const List_t * const pxEventList )
 
     #if ( configNUMBER_OF_CORES == 1 )
     {
-        if( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority )
+        if( taskSHOULD_PREEMPT_CURRENT_TASK( pxUnblockedTCB ) )
         {
             /* Return true if the task removed from the event list has a higher
              * priority than the calling task.  This allows the calling task to know if
@@ -5515,7 +6980,7 @@ void vTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem,
 
     #if ( configNUMBER_OF_CORES == 1 )
     {
-        if( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority )
+        if( taskSHOULD_PREEMPT_CURRENT_TASK( pxUnblockedTCB ) )
         {
             /* The unblocked task has a priority above that of the calling task, so
              * a context switch is required.  This function is called with the
@@ -5544,15 +7009,16 @@ void vTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem,
 
 void vTaskSetTimeOutState( TimeOut_t * const pxTimeOut )
 {
+    UBaseType_t uxSavedInterruptStatus;
     traceENTER_vTaskSetTimeOutState( pxTimeOut );
 
     configASSERT( pxTimeOut );
-    taskENTER_CRITICAL();
+    uxSavedInterruptStatus = taskENTER_CRITICAL_INLINE();
     {
         pxTimeOut->xOverflowCount = xNumOfOverflows;
         pxTimeOut->xTimeOnEntering = xTickCount;
     }
-    taskEXIT_CRITICAL();
+    taskEXIT_CRITICAL_INLINE( uxSavedInterruptStatus );
 
     traceRETURN_vTaskSetTimeOutState();
 }
@@ -5573,6 +7039,7 @@ void vTaskInternalSetTimeOutState( TimeOut_t * const pxTimeOut )
 BaseType_t xTaskCheckForTimeOut( TimeOut_t * const pxTimeOut,
                                  TickType_t * const pxTicksToWait )
 {
+    UBaseType_t uxSavedInterruptStatus;
     BaseType_t xReturn;
 
     traceENTER_xTaskCheckForTimeOut( pxTimeOut, pxTicksToWait );
@@ -5580,7 +7047,7 @@ BaseType_t xTaskCheckForTimeOut( TimeOut_t * const pxTimeOut,
     configASSERT( pxTimeOut );
     configASSERT( pxTicksToWait );
 
-    taskENTER_CRITICAL();
+    uxSavedInterruptStatus = taskENTER_CRITICAL_INLINE();
     {
         /* Minor optimisation.  The tick count cannot change in this block. */
         const TickType_t xConstTickCount = xTickCount;
@@ -5631,7 +7098,7 @@ BaseType_t xTaskCheckForTimeOut( TimeOut_t * const pxTimeOut,
             xReturn = pdTRUE;
         }
     }
-    taskEXIT_CRITICAL();
+    taskEXIT_CRITICAL_INLINE( uxSavedInterruptStatus );
 
     traceRETURN_xTaskCheckForTimeOut( xReturn );
 
@@ -5844,6 +7311,14 @@ static portTASK_FUNCTION( prvIdleTask, pvParameters )
         }
         #endif /* ( ( configUSE_PREEMPTION == 1 ) && ( configIDLE_SHOULD_YIELD == 1 ) ) */
 
+        #if ( configUSE_IDLE_STACK_SCAN == 1 )
+        {
+            /* Keep the cached stack high water marks up to date, a short
+             * slice at a time so higher priority tasks are not held off. */
+            prvStackScanSlice();
+        }
+        #endif /* configUSE_IDLE_STACK_SCAN */
+
         #if ( configUSE_IDLE_HOOK == 1 )
         {
             /* Call the user defined function from within the idle task. */
@@ -6072,6 +7547,38 @@ static void prvInitialiseTaskLists( void )
     }
     #endif /* INCLUDE_vTaskSuspend */
 
+    #if ( configUSE_TASK_BUDGETS == 1 )
+    {
+        vListInitialise( &xBudgetTaskList );
+    }
+    #endif
+
+    #if ( configUSE_IDLE_STACK_SCAN == 1 )
+    {
+        vListInitialise( &xStackScanTaskList );
+    }
+    #endif
+
+    #if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+    {
+        UBaseType_t uxLevel, uxSlot;
+
+        /* The highest level slot number is a shift of the tick count by
+         * ( levels - 1 ) * 5 bits, which must be smaller than the tick type. */
+        configASSERT( ( ( ( UBaseType_t ) configDELAYED_TASK_WHEEL_LEVELS - 1U ) * tskWHEEL_SLOT_BITS ) < ( sizeof( TickType_t ) * taskBITS_PER_BYTE ) );
+
+        for( uxLevel = 0U; uxLevel < ( UBaseType_t ) configDELAYED_TASK_WHEEL_LEVELS; uxLevel++ )
+        {
+            for( uxSlot = 0U; uxSlot < tskWHEEL_SLOTS; uxSlot++ )
+            {
+                vListInitialise( &( xDelayedWheel[ uxLevel ][ uxSlot ] ) );
+            }
+
+            ulDelayedWheelMap[ uxLevel ] = 0U;
+        }
+    }
+    #endif /* configUSE_DELAYED_TASK_WHEEL */
+
     /* Start with pxDelayedTaskList using list1 and the pxOverflowDelayedTaskList
      * using list2. */
     pxDelayedTaskList = &xDelayedTaskList1;
@@ -6205,6 +7712,13 @@ static void prvCheckTasksWaitingTermination( void )
         }
         #endif
 
+        #if ( configUSE_TASK_OVERRUN_STATS == 1 )
+        {
+            pxTaskStatus->ulOverrunCount = pxTCB->ulOverrunCount;
+            pxTaskStatus->xMaxLateness = pxTCB->xMaxLateness;
+        }
+        #endif
+
         /* Obtaining the task state is a little fiddly, so is only done if the
          * value of eState passed into this function is eInvalid - otherwise the
          * state is just set to whatever is passed in. */
@@ -6329,15 +7843,102 @@ static void prvCheckTasksWaitingTermination( void )
                 uxTask++;
             } while( pxNextTCB != pxFirstTCB );
         }
-        else
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return uxTask;
+    }
+
+#endif /* configUSE_TRACE_FACILITY */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configGENERATE_RUN_TIME_STATS == 1 ) )
+
+    static UBaseType_t prvListTaskRunTimesWithinSingleList( TaskRunTime_t * pxTaskRunTimeArray,
+                                                            const List_t * pxList,
+                                                            configRUN_TIME_COUNTER_TYPE ulNow )
+    {
+        const ListItem_t * pxIterator;
+        const ListItem_t * pxEndMarker = listGET_END_MARKER( pxList );
+        const TCB_t * pxTCB;
+        UBaseType_t uxTask = 0;
+
+        /* Walk the list from its end marker rather than with
+         * listGET_OWNER_OF_NEXT_ENTRY() so the index of the ready lists, and
+         * with it the round robin order, is left untouched. */
+        for( pxIterator = listGET_HEAD_ENTRY( pxList ); pxIterator != pxEndMarker; pxIterator = listGET_NEXT( pxIterator ) )
+        {
+            /* MISRA Ref 11.5.3 [Void pointer assignment] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+            /* coverity[misra_c_2012_rule_11_5_violation] */
+            pxTCB = listGET_LIST_ITEM_OWNER( pxIterator );
+
+            pxTaskRunTimeArray[ uxTask ].xHandle = ( TaskHandle_t ) pxTCB;
+            pxTaskRunTimeArray[ uxTask ].xTaskNumber = pxTCB->uxTCBNumber;
+            pxTaskRunTimeArray[ uxTask ].ulRunTimeCounter = pxTCB->ulRunTimeCounter;
+
+            /* The counter of a running task is only updated when it is
+             * switched out - add the time of the current execution. */
+            #if ( configNUMBER_OF_CORES == 1 )
+            {
+                if( pxTCB == pxCurrentTCB )
+                {
+                    pxTaskRunTimeArray[ uxTask ].ulRunTimeCounter += taskRUN_TIME_SINCE( ulNow, ulTaskSwitchedInTime[ 0 ] );
+                }
+            }
+            #else
+            {
+                if( taskTASK_IS_RUNNING( pxTCB ) == pdTRUE )
+                {
+                    pxTaskRunTimeArray[ uxTask ].ulRunTimeCounter += taskRUN_TIME_SINCE( ulNow, ulTaskSwitchedInTime[ pxTCB->xTaskRunState ] );
+                }
+            }
+            #endif
+
+            uxTask++;
+        }
+
+        return uxTask;
+    }
+/*-----------------------------------------------------------*/
+
+    static const TaskRunTime_t * prvFindTaskRunTime( const TaskRunTimeSnapshot_t * pxSnapshot,
+                                                     const TaskRunTime_t * pxTaskRunTime,
+                                                     UBaseType_t uxHint )
+    {
+        const TaskRunTime_t * pxEntry;
+        const TaskRunTime_t * pxReturn = NULL;
+        UBaseType_t uxChecked;
+
+        if( uxHint >= pxSnapshot->uxNumberOfTasks )
+        {
+            uxHint = 0;
+        }
+
+        for( uxChecked = 0; uxChecked < pxSnapshot->uxNumberOfTasks; uxChecked++ )
         {
-            mtCOVERAGE_TEST_MARKER();
+            pxEntry = &( pxSnapshot->pxTaskRunTimeArray[ uxHint ] );
+
+            if( ( pxEntry->xHandle == pxTaskRunTime->xHandle ) && ( pxEntry->xTaskNumber == pxTaskRunTime->xTaskNumber ) )
+            {
+                pxReturn = pxEntry;
+                break;
+            }
+
+            uxHint++;
+
+            if( uxHint >= pxSnapshot->uxNumberOfTasks )
+            {
+                uxHint = 0;
+            }
         }
 
-        return uxTask;
+        return pxReturn;
     }
 
-#endif /* configUSE_TRACE_FACILITY */
+#endif /* ( ( configUSE_TRACE_FACILITY == 1 ) && ( configGENERATE_RUN_TIME_STATS == 1 ) ) */
 /*-----------------------------------------------------------*/
 
 #if ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) )
@@ -6350,6 +7951,18 @@ static void prvCheckTasksWaitingTermination( void )
         {
             pucStackByte -= portSTACK_GROWTH;
             ulCount++;
+
+            #if ( configUSE_PARTIAL_STACK_PAINTING == 1 )
+            {
+                /* Only the band at the limit of the stack was painted.  What
+                 * lies beyond it may hold the fill byte by chance, so stop
+                 * counting there - the result is then a lower bound. */
+                if( ulCount >= ( ( uint32_t ) configSTACK_PAINT_DEPTH * ( uint32_t ) sizeof( StackType_t ) ) )
+                {
+                    break;
+                }
+            }
+            #endif
         }
 
         ulCount /= ( uint32_t ) sizeof( StackType_t );
@@ -6433,83 +8046,420 @@ static void prvCheckTasksWaitingTermination( void )
         return uxReturn;
     }
 
-#endif /* INCLUDE_uxTaskGetStackHighWaterMark */
+#endif /* INCLUDE_uxTaskGetStackHighWaterMark */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_IDLE_STACK_SCAN == 1 )
+
+    static void prvStackScanSlice( void )
+    {
+        const StackType_t * pxStackWord;
+        UBaseType_t uxWordsLeft = ( UBaseType_t ) configIDLE_STACK_SCAN_WORDS;
+
+        /* The scheduler is suspended so the task being scanned cannot be
+         * deleted part way through a slice. */
+        vTaskSuspendAll();
+        {
+            if( ( pxStackScanTCB == NULL ) && ( listLIST_IS_EMPTY( &xStackScanTaskList ) == pdFALSE ) )
+            {
+                /* Start on the next task.  The scan of a stack starts again
+                 * at its limit each time round. */
+                /* MISRA Ref 11.5.3 [Void pointer assignment] */
+                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+                /* coverity[misra_c_2012_rule_11_5_violation] */
+                listGET_OWNER_OF_NEXT_ENTRY( pxStackScanTCB, &xStackScanTaskList );
+                uxStackScanDepth = ( configSTACK_DEPTH_TYPE ) 0U;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( pxStackScanTCB != NULL )
+            {
+                #if ( portSTACK_GROWTH < 0 )
+                {
+                    pxStackWord = &( pxStackScanTCB->pxStack[ uxStackScanDepth ] );
+                }
+                #else
+                {
+                    pxStackWord = pxStackScanTCB->pxEndOfStack - uxStackScanDepth;
+                }
+                #endif
+
+                /* Compare whole words with the fill pattern, counting from
+                 * the limit of the stack up to the first word that was written.
+                 * Stack use only grows the used part, so the scan does not
+                 * need to look past the previous high water mark. */
+                while( ( uxWordsLeft > ( UBaseType_t ) 0U ) &&
+                       ( uxStackScanDepth < pxStackScanTCB->uxStackHighWaterMark ) &&
+                       ( *pxStackWord == tskSTACK_FILL_WORD ) )
+                {
+                    pxStackWord -= portSTACK_GROWTH;
+                    uxStackScanDepth++;
+                    uxWordsLeft--;
+                }
+
+                if( uxWordsLeft > ( UBaseType_t ) 0U )
+                {
+                    /* The scan of this stack is complete. */
+                    pxStackScanTCB->uxStackHighWaterMark = uxStackScanDepth;
+                    pxStackScanTCB = NULL;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        ( void ) xTaskResumeAll();
+    }
+
+#endif /* configUSE_IDLE_STACK_SCAN */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_IDLE_STACK_SCAN == 1 )
+
+    UBaseType_t uxTaskGetStackHighWaterMarks( TaskStackHighWaterMark_t * const pxStackHighWaterMarkArray,
+                                              const UBaseType_t uxArraySize )
+    {
+        const ListItem_t * pxEndMarker = listGET_END_MARKER( &xStackScanTaskList );
+        const ListItem_t * pxIterator;
+        TCB_t * pxTCB;
+        UBaseType_t uxTask = 0;
+
+        traceENTER_uxTaskGetStackHighWaterMarks( pxStackHighWaterMarkArray, uxArraySize );
+
+        configASSERT( pxStackHighWaterMarkArray );
+
+        vTaskSuspendAll();
+        {
+            /* Is there a space in the array for each task in the system? */
+            if( uxArraySize >= listCURRENT_LIST_LENGTH( &xStackScanTaskList ) )
+            {
+                for( pxIterator = listGET_HEAD_ENTRY( &xStackScanTaskList ); pxIterator != pxEndMarker; pxIterator = listGET_NEXT( pxIterator ) )
+                {
+                    /* MISRA Ref 11.5.3 [Void pointer assignment] */
+                    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+                    /* coverity[misra_c_2012_rule_11_5_violation] */
+                    pxTCB = listGET_LIST_ITEM_OWNER( pxIterator );
+
+                    pxStackHighWaterMarkArray[ uxTask ].xHandle = ( TaskHandle_t ) pxTCB;
+                    pxStackHighWaterMarkArray[ uxTask ].uxStackHighWaterMark = pxTCB->uxStackHighWaterMark;
+                    uxTask++;
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        ( void ) xTaskResumeAll();
+
+        traceRETURN_uxTaskGetStackHighWaterMarks( uxTask );
+
+        return uxTask;
+    }
+
+#endif /* configUSE_IDLE_STACK_SCAN */
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_vTaskDelete == 1 )
+
+    static void prvDeleteTCB( TCB_t * pxTCB )
+    {
+        /* This call is required specifically for the TriCore port.  It must be
+         * above the vPortFree() calls.  The call is also used by ports/demos that
+         * want to allocate and clean RAM statically. */
+        portCLEAN_UP_TCB( pxTCB );
+
+        #if ( configUSE_C_RUNTIME_TLS_SUPPORT == 1 )
+        {
+            /* Free up the memory allocated for the task's TLS Block. */
+            configDEINIT_TLS_BLOCK( pxTCB->xTLSBlock );
+        }
+        #endif
+
+        #if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) && ( portUSING_MPU_WRAPPERS == 0 ) )
+        {
+            /* The task can only have been allocated dynamically - free both
+             * the stack and TCB. */
+            vPortFreeStack( pxTCB->pxStack );
+            vPortFree( pxTCB );
+        }
+        #elif ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 )
+        {
+            /* The task could have been allocated statically or dynamically, so
+             * check what was statically allocated before trying to free the
+             * memory. */
+            if( pxTCB->ucStaticallyAllocated == tskDYNAMICALLY_ALLOCATED_STACK_AND_TCB )
+            {
+                /* Both the stack and TCB were allocated dynamically, so both
+                 * must be freed. */
+                vPortFreeStack( pxTCB->pxStack );
+                vPortFree( pxTCB );
+            }
+            else if( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_ONLY )
+            {
+                /* Only the stack was statically allocated, so the TCB is the
+                 * only memory that must be freed. */
+                vPortFree( pxTCB );
+            }
+            else
+            {
+                /* Neither the stack nor the TCB were allocated dynamically, so
+                 * nothing needs to be freed. */
+                configASSERT( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_AND_TCB );
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+    }
+
+#endif /* INCLUDE_vTaskDelete */
+/*-----------------------------------------------------------*/
+
+static void prvResetNextTaskUnblockTime( void )
+{
+    if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
+    {
+        /* The new current delayed list is empty.  Set xNextTaskUnblockTime to
+         * the maximum possible value so it is  extremely unlikely that the
+         * if( xTickCount >= xNextTaskUnblockTime ) test will pass until
+         * there is an item in the delayed list. */
+        xNextTaskUnblockTime = portMAX_DELAY;
+    }
+    else
+    {
+        /* The new current delayed list is not empty, get the value of
+         * the item at the head of the delayed list.  This is the time at
+         * which the task at the head of the delayed list should be removed
+         * from the Blocked state. */
+        xNextTaskUnblockTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxDelayedTaskList );
+    }
+
+    #if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+    {
+        const TickType_t xWheelUnblockTime = prvDelayedWheelNextUnblockTime( xTickCount );
+
+        if( xWheelUnblockTime < xNextTaskUnblockTime )
+        {
+            xNextTaskUnblockTime = xWheelUnblockTime;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    #endif /* #if ( configUSE_DELAYED_TASK_WHEEL == 1 ) */
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+
+    static void prvDelayedWheelInsert( List_t * const pxSortedList,
+                                       ListItem_t * const pxListItem,
+                                       const TickType_t xTickNow )
+    {
+        const TickType_t xTimeToWake = listGET_LIST_ITEM_VALUE( pxListItem );
+        UBaseType_t uxLevel;
+        UBaseType_t uxShift;
+        UBaseType_t uxSlot;
+        List_t * pxSlotList = NULL;
+
+        /* A task that wakes on the current tick is placed straight in the
+         * sorted list, where the tick interrupt looks for it. */
+        if( xTimeToWake > xTickNow )
+        {
+            for( uxLevel = 0U; ( uxLevel < ( UBaseType_t ) configDELAYED_TASK_WHEEL_LEVELS ) && ( pxSlotList == NULL ); uxLevel++ )
+            {
+                uxShift = uxLevel * tskWHEEL_SLOT_BITS;
+
+                /* A level only holds the 32 slots starting at the one the tick
+                 * count is in, so a slot never mixes two turns of the wheel. */
+                if( ( ( xTimeToWake >> uxShift ) - ( xTickNow >> uxShift ) ) < ( TickType_t ) tskWHEEL_SLOTS )
+                {
+                    uxSlot = ( UBaseType_t ) ( ( xTimeToWake >> uxShift ) & ( TickType_t ) tskWHEEL_SLOT_MASK );
+                    pxSlotList = &( xDelayedWheel[ uxLevel ][ uxSlot ] );
+
+                    if( listLIST_IS_EMPTY( pxSlotList ) != pdFALSE )
+                    {
+                        xDelayedWheelMin[ uxLevel ][ uxSlot ] = xTimeToWake;
+                        ulDelayedWheelMap[ uxLevel ] |= ( ( uint32_t ) 1U ) << uxSlot;
+                    }
+                    else if( xTimeToWake < xDelayedWheelMin[ uxLevel ][ uxSlot ] )
+                    {
+                        xDelayedWheelMin[ uxLevel ][ uxSlot ] = xTimeToWake;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    listINSERT_END( pxSlotList, pxListItem );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( pxSlotList == NULL )
+        {
+            /* Too far in the future for the wheel. */
+            vListInsert( pxSortedList, pxListItem );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+#endif /* #if ( configUSE_DELAYED_TASK_WHEEL == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+
+    static void prvDelayedWheelAdvance( const TickType_t xTickNow )
+    {
+        UBaseType_t uxLevel;
+        UBaseType_t uxSlot;
+        List_t * pxSlotList;
+        ListItem_t * pxListItem;
+
+        /* Cascade the top level first so the tasks it moves down are looked at
+         * again by the levels below.  Only the nearest slot of a level can be
+         * due, and a task taken from a slot that is due always lands on a lower
+         * level (or in the sorted list if it wakes now). */
+        for( uxLevel = ( UBaseType_t ) configDELAYED_TASK_WHEEL_LEVELS - 1U; uxLevel > 0U; uxLevel-- )
+        {
+            while( ( prvDelayedWheelNearestSlot( uxLevel, xTickNow, &uxSlot ) != pdFALSE ) &&
+                   ( xDelayedWheelMin[ uxLevel ][ uxSlot ] <= xTickNow ) )
+            {
+                pxSlotList = &( xDelayedWheel[ uxLevel ][ uxSlot ] );
+                ulDelayedWheelMap[ uxLevel ] &= ~( ( ( uint32_t ) 1U ) << uxSlot );
+
+                while( listLIST_IS_EMPTY( pxSlotList ) == pdFALSE )
+                {
+                    pxListItem = listGET_HEAD_ENTRY( pxSlotList );
+                    listREMOVE_ITEM( pxListItem );
+                    prvDelayedWheelInsert( pxDelayedTaskList, pxListItem, xTickNow );
+                }
+            }
+        }
+
+        /* Every task in the level 0 slot of the current tick wakes now.  They
+         * are inserted in wake time order, so they end up at the head of the
+         * sorted list. */
+        uxSlot = ( UBaseType_t ) ( xTickNow & ( TickType_t ) tskWHEEL_SLOT_MASK );
+        pxSlotList = &( xDelayedWheel[ 0 ][ uxSlot ] );
+        ulDelayedWheelMap[ 0 ] &= ~( ( ( uint32_t ) 1U ) << uxSlot );
+
+        while( listLIST_IS_EMPTY( pxSlotList ) == pdFALSE )
+        {
+            pxListItem = listGET_HEAD_ENTRY( pxSlotList );
+            listREMOVE_ITEM( pxListItem );
+            vListInsert( pxDelayedTaskList, pxListItem );
+        }
+    }
+
+#endif /* #if ( configUSE_DELAYED_TASK_WHEEL == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+
+    static TickType_t prvDelayedWheelNextUnblockTime( const TickType_t xTickNow )
+    {
+        TickType_t xReturn = portMAX_DELAY;
+        UBaseType_t uxLevel;
+        UBaseType_t uxSlot;
+
+        /* The nearest slot of each level holds the earliest wake times of that
+         * level.  On levels above 0 the slot is cascaded at its earliest wake
+         * time, which may be earlier than the task it was recorded for if that
+         * task has since left the slot - the tick interrupt then just finds
+         * nothing to do. */
+        for( uxLevel = 0U; uxLevel < ( UBaseType_t ) configDELAYED_TASK_WHEEL_LEVELS; uxLevel++ )
+        {
+            if( ( prvDelayedWheelNearestSlot( uxLevel, xTickNow, &uxSlot ) != pdFALSE ) &&
+                ( xDelayedWheelMin[ uxLevel ][ uxSlot ] < xReturn ) )
+            {
+                xReturn = xDelayedWheelMin[ uxLevel ][ uxSlot ];
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        return xReturn;
+    }
+
+#endif /* #if ( configUSE_DELAYED_TASK_WHEEL == 1 ) */
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_vTaskDelete == 1 )
+#if ( configUSE_DELAYED_TASK_WHEEL == 1 )
 
-    static void prvDeleteTCB( TCB_t * pxTCB )
+    static BaseType_t prvDelayedWheelNearestSlot( const UBaseType_t uxLevel,
+                                                  const TickType_t xTickNow,
+                                                  UBaseType_t * const puxSlot )
     {
-        /* This call is required specifically for the TriCore port.  It must be
-         * above the vPortFree() calls.  The call is also used by ports/demos that
-         * want to allocate and clean RAM statically. */
-        portCLEAN_UP_TCB( pxTCB );
-
-        #if ( configUSE_C_RUNTIME_TLS_SUPPORT == 1 )
+        /* Position of the lowest set bit by De Bruijn multiplication, so the
+         * wheel also works on cores without a count leading zeros instruction. */
+        static const uint8_t ucDeBruijnBitPosition[ 32 ] =
         {
-            /* Free up the memory allocated for the task's TLS Block. */
-            configDEINIT_TLS_BLOCK( pxTCB->xTLSBlock );
-        }
-        #endif
+            0U,  1U,  28U, 2U,  29U, 14U, 24U, 3U,  30U, 22U, 20U, 15U, 25U, 17U, 4U,  8U,
+            31U, 27U, 13U, 23U, 21U, 19U, 16U, 7U,  26U, 12U, 18U, 6U,  11U, 5U,  10U, 9U
+        };
+        const UBaseType_t uxCurrentSlot = ( UBaseType_t ) ( ( xTickNow >> ( uxLevel * tskWHEEL_SLOT_BITS ) ) & ( TickType_t ) tskWHEEL_SLOT_MASK );
+        uint32_t ulMap;
+        UBaseType_t uxSlot;
+        BaseType_t xReturn = pdFALSE;
 
-        #if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) && ( portUSING_MPU_WRAPPERS == 0 ) )
+        while( ( xReturn == pdFALSE ) && ( ulDelayedWheelMap[ uxLevel ] != 0U ) )
         {
-            /* The task can only have been allocated dynamically - free both
-             * the stack and TCB. */
-            vPortFreeStack( pxTCB->pxStack );
-            vPortFree( pxTCB );
-        }
-        #elif ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 )
-        {
-            /* The task could have been allocated statically or dynamically, so
-             * check what was statically allocated before trying to free the
-             * memory. */
-            if( pxTCB->ucStaticallyAllocated == tskDYNAMICALLY_ALLOCATED_STACK_AND_TCB )
+            /* Rotate the map so bit 0 is the slot the tick count is in, the
+             * lowest set bit is then the nearest slot. */
+            ulMap = ulDelayedWheelMap[ uxLevel ];
+
+            if( uxCurrentSlot != 0U )
             {
-                /* Both the stack and TCB were allocated dynamically, so both
-                 * must be freed. */
-                vPortFreeStack( pxTCB->pxStack );
-                vPortFree( pxTCB );
+                ulMap = ( ulMap >> uxCurrentSlot ) | ( ulMap << ( tskWHEEL_SLOTS - uxCurrentSlot ) );
             }
-            else if( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_ONLY )
+            else
             {
-                /* Only the stack was statically allocated, so the TCB is the
-                 * only memory that must be freed. */
-                vPortFree( pxTCB );
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            ulMap &= ( ~ulMap + 1U );
+            uxSlot = ( uxCurrentSlot + ( UBaseType_t ) ucDeBruijnBitPosition[ ( ( uint32_t ) ( ulMap * 0x077CB531U ) ) >> 27U ] ) & tskWHEEL_SLOT_MASK;
+
+            if( listLIST_IS_EMPTY( &( xDelayedWheel[ uxLevel ][ uxSlot ] ) ) != pdFALSE )
+            {
+                /* The tasks of the slot all left the Blocked state before
+                 * their timeout, clear the stale bit and look again. */
+                ulDelayedWheelMap[ uxLevel ] &= ~( ( ( uint32_t ) 1U ) << uxSlot );
             }
             else
             {
-                /* Neither the stack nor the TCB were allocated dynamically, so
-                 * nothing needs to be freed. */
-                configASSERT( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_AND_TCB );
-                mtCOVERAGE_TEST_MARKER();
+                *puxSlot = uxSlot;
+                xReturn = pdTRUE;
             }
         }
-        #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
-    }
-
-#endif /* INCLUDE_vTaskDelete */
-/*-----------------------------------------------------------*/
 
-static void prvResetNextTaskUnblockTime( void )
-{
-    if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
-    {
-        /* The new current delayed list is empty.  Set xNextTaskUnblockTime to
-         * the maximum possible value so it is  extremely unlikely that the
-         * if( xTickCount >= xNextTaskUnblockTime ) test will pass until
-         * there is an item in the delayed list. */
-        xNextTaskUnblockTime = portMAX_DELAY;
-    }
-    else
-    {
-        /* The new current delayed list is not empty, get the value of
-         * the item at the head of the delayed list.  This is the time at
-         * which the task at the head of the delayed list should be removed
-         * from the Blocked state. */
-        xNextTaskUnblockTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxDelayedTaskList );
+        return xReturn;
     }
-}
+
+#endif /* #if ( configUSE_DELAYED_TASK_WHEEL == 1 ) */
 /*-----------------------------------------------------------*/
 
 #if ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_MUTEXES == 1 ) ) || ( configNUMBER_OF_CORES > 1 )
@@ -6646,9 +8596,9 @@ static void prvResetNextTaskUnblockTime( void )
                     if( uxListRemove( &( pxMutexHolderTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
                     {
                         /* It is known that the task is in its ready list so
-                         * there is no need to check again and the port level
+                         * there is no need to check again and the unchecked
                          * reset macro can be called directly. */
-                        portRESET_READY_PRIORITY( pxMutexHolderTCB->uxPriority, uxTopReadyPriority );
+                        taskCLEAR_READY_PRIORITY( pxMutexHolderTCB->uxPriority );
                     }
                     else
                     {
@@ -6745,7 +8695,7 @@ static void prvResetNextTaskUnblockTime( void )
                      * the holding task from the ready list. */
                     if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
                     {
-                        portRESET_READY_PRIORITY( pxTCB->uxPriority, uxTopReadyPriority );
+                        taskCLEAR_READY_PRIORITY( pxTCB->uxPriority );
                     }
                     else
                     {
@@ -6879,9 +8829,9 @@ static void prvResetNextTaskUnblockTime( void )
                         if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
                         {
                             /* It is known that the task is in its ready list so
-                             * there is no need to check again and the port level
+                             * there is no need to check again and the unchecked
                              * reset macro can be called directly. */
-                            portRESET_READY_PRIORITY( pxTCB->uxPriority, uxTopReadyPriority );
+                            taskCLEAR_READY_PRIORITY( pxTCB->uxPriority );
                         }
                         else
                         {
@@ -7649,6 +9599,7 @@ TickType_t uxTaskResetEventItemValue( void )
                                       BaseType_t xClearCountOnExit,
                                       TickType_t xTicksToWait )
     {
+        UBaseType_t uxSavedInterruptStatus;
         uint32_t ulReturn;
         BaseType_t xAlreadyYielded;
 
@@ -7656,7 +9607,7 @@ TickType_t uxTaskResetEventItemValue( void )
 
         configASSERT( uxIndexToWaitOn < configTASK_NOTIFICATION_ARRAY_ENTRIES );
 
-        taskENTER_CRITICAL();
+        uxSavedInterruptStatus = taskENTER_CRITICAL_INLINE();
 
         /* Only block if the notification count is not already non-zero. */
         if( pxCurrentTCB->ulNotifiedValue[ uxIndexToWaitOn ] == 0UL )
@@ -7704,7 +9655,7 @@ TickType_t uxTaskResetEventItemValue( void )
                  */
                 vTaskSuspendAll();
                 {
-                    taskEXIT_CRITICAL();
+                    taskEXIT_CRITICAL_INLINE( uxSavedInterruptStatus );
 
                     prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
                 }
@@ -7721,15 +9672,15 @@ TickType_t uxTaskResetEventItemValue( void )
             }
             else
             {
-                taskEXIT_CRITICAL();
+                taskEXIT_CRITICAL_INLINE( uxSavedInterruptStatus );
             }
         }
         else
         {
-            taskEXIT_CRITICAL();
+            taskEXIT_CRITICAL_INLINE( uxSavedInterruptStatus );
         }
 
-        taskENTER_CRITICAL();
+        uxSavedInterruptStatus = taskENTER_CRITICAL_INLINE();
         {
             traceTASK_NOTIFY_TAKE( uxIndexToWaitOn );
             ulReturn = pxCurrentTCB->ulNotifiedValue[ uxIndexToWaitOn ];
@@ -7752,7 +9703,7 @@ TickType_t uxTaskResetEventItemValue( void )
 
             pxCurrentTCB->ucNotifyState[ uxIndexToWaitOn ] = taskNOT_WAITING_NOTIFICATION;
         }
-        taskEXIT_CRITICAL();
+        taskEXIT_CRITICAL_INLINE( uxSavedInterruptStatus );
 
         traceRETURN_ulTaskGenericNotifyTake( ulReturn );
 
@@ -7770,13 +9721,14 @@ TickType_t uxTaskResetEventItemValue( void )
                                        uint32_t * pulNotificationValue,
                                        TickType_t xTicksToWait )
     {
+        UBaseType_t uxSavedInterruptStatus;
         BaseType_t xReturn, xAlreadyYielded;
 
         traceENTER_xTaskGenericNotifyWait( uxIndexToWaitOn, ulBitsToClearOnEntry, ulBitsToClearOnExit, pulNotificationValue, xTicksToWait );
 
         configASSERT( uxIndexToWaitOn < configTASK_NOTIFICATION_ARRAY_ENTRIES );
 
-        taskENTER_CRITICAL();
+        uxSavedInterruptStatus = taskENTER_CRITICAL_INLINE();
 
         /* Only block if a notification is not already pending. */
         if( pxCurrentTCB->ucNotifyState[ uxIndexToWaitOn ] != taskNOTIFICATION_RECEIVED )
@@ -7829,7 +9781,7 @@ TickType_t uxTaskResetEventItemValue( void )
                  */
                 vTaskSuspendAll();
                 {
-                    taskEXIT_CRITICAL();
+                    taskEXIT_CRITICAL_INLINE( uxSavedInterruptStatus );
 
                     prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
                 }
@@ -7846,15 +9798,15 @@ TickType_t uxTaskResetEventItemValue( void )
             }
             else
             {
-                taskEXIT_CRITICAL();
+                taskEXIT_CRITICAL_INLINE( uxSavedInterruptStatus );
             }
         }
         else
         {
-            taskEXIT_CRITICAL();
+            taskEXIT_CRITICAL_INLINE( uxSavedInterruptStatus );
         }
 
-        taskENTER_CRITICAL();
+        uxSavedInterruptStatus = taskENTER_CRITICAL_INLINE();
         {
             traceTASK_NOTIFY_WAIT( uxIndexToWaitOn );
 
@@ -7884,7 +9836,7 @@ TickType_t uxTaskResetEventItemValue( void )
 
             pxCurrentTCB->ucNotifyState[ uxIndexToWaitOn ] = taskNOT_WAITING_NOTIFICATION;
         }
-        taskEXIT_CRITICAL();
+        taskEXIT_CRITICAL_INLINE( uxSavedInterruptStatus );
 
         traceRETURN_xTaskGenericNotifyWait( xReturn );
 
@@ -7902,6 +9854,7 @@ TickType_t uxTaskResetEventItemValue( void )
                                    eNotifyAction eAction,
                                    uint32_t * pulPreviousNotificationValue )
     {
+        UBaseType_t uxSavedInterruptStatus;
         TCB_t * pxTCB;
         BaseType_t xReturn = pdPASS;
         uint8_t ucOriginalNotifyState;
@@ -7912,7 +9865,7 @@ TickType_t uxTaskResetEventItemValue( void )
         configASSERT( xTaskToNotify );
         pxTCB = xTaskToNotify;
 
-        taskENTER_CRITICAL();
+        uxSavedInterruptStatus = taskENTER_CRITICAL_INLINE();
         {
             if( pulPreviousNotificationValue != NULL )
             {
@@ -8004,7 +9957,7 @@ TickType_t uxTaskResetEventItemValue( void )
                 mtCOVERAGE_TEST_MARKER();
             }
         }
-        taskEXIT_CRITICAL();
+        taskEXIT_CRITICAL_INLINE( uxSavedInterruptStatus );
 
         traceRETURN_xTaskGenericNotify( xReturn );
 
@@ -8129,7 +10082,7 @@ TickType_t uxTaskResetEventItemValue( void )
 
                 #if ( configNUMBER_OF_CORES == 1 )
                 {
-                    if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                    if( taskSHOULD_PREEMPT_CURRENT_TASK( pxTCB ) )
                     {
                         /* The notified task has a priority above the currently
                          * executing task so a yield is required. */
@@ -8244,7 +10197,7 @@ TickType_t uxTaskResetEventItemValue( void )
 
                 #if ( configNUMBER_OF_CORES == 1 )
                 {
-                    if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                    if( taskSHOULD_PREEMPT_CURRENT_TASK( pxTCB ) )
                     {
                         /* The notified task has a priority above the currently
                          * executing task so a yield is required. */
@@ -8295,6 +10248,7 @@ TickType_t uxTaskResetEventItemValue( void )
     BaseType_t xTaskGenericNotifyStateClear( TaskHandle_t xTask,
                                              UBaseType_t uxIndexToClear )
     {
+        UBaseType_t uxSavedInterruptStatus;
         TCB_t * pxTCB;
         BaseType_t xReturn;
 
@@ -8306,7 +10260,7 @@ TickType_t uxTaskResetEventItemValue( void )
          * its notification state cleared. */
         pxTCB = prvGetTCBFromHandle( xTask );
 
-        taskENTER_CRITICAL();
+        uxSavedInterruptStatus = taskENTER_CRITICAL_INLINE();
         {
             if( pxTCB->ucNotifyState[ uxIndexToClear ] == taskNOTIFICATION_RECEIVED )
             {
@@ -8318,7 +10272,7 @@ TickType_t uxTaskResetEventItemValue( void )
                 xReturn = pdFAIL;
             }
         }
-        taskEXIT_CRITICAL();
+        taskEXIT_CRITICAL_INLINE( uxSavedInterruptStatus );
 
         traceRETURN_xTaskGenericNotifyStateClear( xReturn );
 
@@ -8334,6 +10288,7 @@ TickType_t uxTaskResetEventItemValue( void )
                                             UBaseType_t uxIndexToClear,
                                             uint32_t ulBitsToClear )
     {
+        UBaseType_t uxSavedInterruptStatus;
         TCB_t * pxTCB;
         uint32_t ulReturn;
 
@@ -8345,14 +10300,14 @@ TickType_t uxTaskResetEventItemValue( void )
          * its notification state cleared. */
         pxTCB = prvGetTCBFromHandle( xTask );
 
-        taskENTER_CRITICAL();
+        uxSavedInterruptStatus = taskENTER_CRITICAL_INLINE();
         {
             /* Return the notification as it was before the bits were cleared,
              * then clear the bit mask. */
             ulReturn = pxTCB->ulNotifiedValue[ uxIndexToClear ];
             pxTCB->ulNotifiedValue[ uxIndexToClear ] &= ~ulBitsToClear;
         }
-        taskEXIT_CRITICAL();
+        taskEXIT_CRITICAL_INLINE( uxSavedInterruptStatus );
 
         traceRETURN_ulTaskGenericNotifyValueClear( ulReturn );
 
@@ -8362,6 +10317,137 @@ TickType_t uxTaskResetEventItemValue( void )
 #endif /* configUSE_TASK_NOTIFICATIONS */
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_TASK_MAILBOX == 1 )
+
+    BaseType_t xTaskMailboxSend( TaskHandle_t xTaskToNotify,
+                                 const void * pvMessage,
+                                 size_t xMessageLength )
+    {
+        UBaseType_t uxSavedInterruptStatus;
+        TCB_t * pxTCB;
+        BaseType_t xReturn;
+
+        traceENTER_xTaskMailboxSend( xTaskToNotify, pvMessage, xMessageLength );
+
+        configASSERT( xTaskToNotify );
+        configASSERT( pvMessage );
+        configASSERT( ( xMessageLength > ( size_t ) 0U ) && ( xMessageLength <= ( size_t ) configTASK_MAILBOX_SIZE ) );
+        pxTCB = xTaskToNotify;
+
+        uxSavedInterruptStatus = taskENTER_CRITICAL_INLINE();
+        {
+            if( pxTCB->ucMailboxLength == ( uint8_t ) 0U )
+            {
+                ( void ) memcpy( ( void * ) pxTCB->ulMailbox, pvMessage, xMessageLength );
+                pxTCB->ucMailboxLength = ( uint8_t ) xMessageLength;
+
+                /* Filling the mailbox and notifying the task are done in the
+                 * same critical section, so a pending notification at the
+                 * mailbox index always comes with a message. */
+                xReturn = xTaskGenericNotify( xTaskToNotify, configTASK_MAILBOX_NOTIFICATION_INDEX, 0U, eNoAction, NULL );
+            }
+            else
+            {
+                xReturn = pdFAIL;
+            }
+        }
+        taskEXIT_CRITICAL_INLINE( uxSavedInterruptStatus );
+
+        traceRETURN_xTaskMailboxSend( xReturn );
+
+        return xReturn;
+    }
+
+#endif /* configUSE_TASK_MAILBOX */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TASK_MAILBOX == 1 )
+
+    BaseType_t xTaskMailboxSendFromISR( TaskHandle_t xTaskToNotify,
+                                        const void * pvMessage,
+                                        size_t xMessageLength,
+                                        BaseType_t * pxHigherPriorityTaskWoken )
+    {
+        UBaseType_t uxSavedInterruptStatus;
+        TCB_t * pxTCB;
+        BaseType_t xReturn;
+
+        traceENTER_xTaskMailboxSendFromISR( xTaskToNotify, pvMessage, xMessageLength, pxHigherPriorityTaskWoken );
+
+        configASSERT( xTaskToNotify );
+        configASSERT( pvMessage );
+        configASSERT( ( xMessageLength > ( size_t ) 0U ) && ( xMessageLength <= ( size_t ) configTASK_MAILBOX_SIZE ) );
+        pxTCB = xTaskToNotify;
+
+        uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+        {
+            if( pxTCB->ucMailboxLength == ( uint8_t ) 0U )
+            {
+                ( void ) memcpy( ( void * ) pxTCB->ulMailbox, pvMessage, xMessageLength );
+                pxTCB->ucMailboxLength = ( uint8_t ) xMessageLength;
+
+                xReturn = xTaskGenericNotifyFromISR( xTaskToNotify, configTASK_MAILBOX_NOTIFICATION_INDEX, 0U, eNoAction, NULL, pxHigherPriorityTaskWoken );
+            }
+            else
+            {
+                xReturn = pdFAIL;
+            }
+        }
+        taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+        traceRETURN_xTaskMailboxSendFromISR( xReturn );
+
+        return xReturn;
+    }
+
+#endif /* configUSE_TASK_MAILBOX */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TASK_MAILBOX == 1 )
+
+    size_t xTaskMailboxReceive( void * pvBuffer,
+                                TickType_t xTicksToWait )
+    {
+        TCB_t * const pxTCB = prvGetTCBFromHandle( NULL );
+        size_t xReceivedLength = 0;
+
+        traceENTER_xTaskMailboxReceive( pvBuffer, xTicksToWait );
+
+        configASSERT( pvBuffer );
+
+        if( xTaskGenericNotifyWait( configTASK_MAILBOX_NOTIFICATION_INDEX, 0U, 0U, NULL, xTicksToWait ) != pdFALSE )
+        {
+            /* No critical section is needed to empty the mailbox.  Senders do
+             * not write to it until ucMailboxLength is cleared, and only this
+             * task clears it. */
+            xReceivedLength = ( size_t ) pxTCB->ucMailboxLength;
+
+            if( xReceivedLength != ( size_t ) 0U )
+            {
+                ( void ) memcpy( pvBuffer, ( const void * ) pxTCB->ulMailbox, xReceivedLength );
+                portMEMORY_BARRIER();
+                pxTCB->ucMailboxLength = ( uint8_t ) 0U;
+            }
+            else
+            {
+                /* The index was notified by something other than a mailbox
+                 * send. */
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xTaskMailboxReceive( xReceivedLength );
+
+        return xReceivedLength;
+    }
+
+#endif /* configUSE_TASK_MAILBOX */
+/*-----------------------------------------------------------*/
+
 #if ( configGENERATE_RUN_TIME_STATS == 1 )
 
     configRUN_TIME_COUNTER_TYPE ulTaskGetRunTimeCounter( const TaskHandle_t xTask )
@@ -8473,6 +10559,117 @@ TickType_t uxTaskResetEventItemValue( void )
 #endif /* if ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( INCLUDE_xTaskGetIdleTaskHandle == 1 ) ) */
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_TASK_JOB_STATS == 1 )
+
+    void vTaskGetJobStats( TaskHandle_t xTask,
+                           TaskJobStats_t * pxJobStats )
+    {
+        TCB_t * pxTCB;
+
+        traceENTER_vTaskGetJobStats( xTask, pxJobStats );
+
+        configASSERT( pxJobStats );
+
+        taskENTER_CRITICAL();
+        {
+            pxTCB = prvGetTCBFromHandle( xTask );
+            configASSERT( pxTCB );
+
+            *pxJobStats = pxTCB->xJobStats;
+        }
+        taskEXIT_CRITICAL();
+
+        traceRETURN_vTaskGetJobStats();
+    }
+
+#endif /* configUSE_TASK_JOB_STATS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TASK_JOB_STATS == 1 )
+
+    void vTaskResetJobStats( TaskHandle_t xTask )
+    {
+        TCB_t * pxTCB;
+
+        traceENTER_vTaskResetJobStats( xTask );
+
+        taskENTER_CRITICAL();
+        {
+            pxTCB = prvGetTCBFromHandle( xTask );
+            configASSERT( pxTCB );
+
+            ( void ) memset( ( void * ) &( pxTCB->xJobStats ), 0x00, sizeof( TaskJobStats_t ) );
+        }
+        taskEXIT_CRITICAL();
+
+        traceRETURN_vTaskResetJobStats();
+    }
+
+#endif /* configUSE_TASK_JOB_STATS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TASK_JOB_STATS == 1 )
+
+    static void prvEndCurrentTaskJob( void )
+    {
+        /* The task blocks or yields right after this, so the job only takes
+         * the rest of the current execution with it.  That is charged when the
+         * task is switched out, which saves reading the run time counter from
+         * task context here. */
+        pxCurrentTCB->ucJobEnded = ( uint8_t ) pdTRUE;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvCloseTaskJob( TCB_t * const pxTCB )
+    {
+        TaskJobStats_t * const pxJobStats = &( pxTCB->xJobStats );
+        const configRUN_TIME_COUNTER_TYPE ulExecutionTime = pxTCB->ulJobExecutionTime;
+        configRUN_TIME_COUNTER_TYPE ulBinLimit;
+        UBaseType_t uxBin;
+
+        pxTCB->ulJobExecutionTime = ( configRUN_TIME_COUNTER_TYPE ) 0U;
+        pxTCB->ucJobEnded = ( uint8_t ) pdFALSE;
+
+        traceTASK_JOB_COMPLETED( pxTCB, ulExecutionTime );
+
+        if( ( pxJobStats->ulJobCount == 0U ) || ( ulExecutionTime < pxJobStats->ulMinExecutionTime ) )
+        {
+            pxJobStats->ulMinExecutionTime = ulExecutionTime;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( ulExecutionTime > pxJobStats->ulMaxExecutionTime )
+        {
+            pxJobStats->ulMaxExecutionTime = ulExecutionTime;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        pxJobStats->ulTotalExecutionTime += ulExecutionTime;
+        pxJobStats->ulJobCount++;
+
+        /* Find the log2 bin.  A limit that shifts out of range leaves the job
+         * in the last bin. */
+        uxBin = 0U;
+        ulBinLimit = ( configRUN_TIME_COUNTER_TYPE ) 2U << configTASK_JOB_STATS_HISTOGRAM_SHIFT;
+
+        while( ( uxBin < ( ( UBaseType_t ) configTASK_JOB_STATS_HISTOGRAM_BINS - 1U ) ) && ( ulExecutionTime >= ulBinLimit ) )
+        {
+            uxBin++;
+            ulBinLimit <<= 1;
+        }
+
+        pxJobStats->ulHistogram[ uxBin ]++;
+    }
+
+#endif /* configUSE_TASK_JOB_STATS */
+/*-----------------------------------------------------------*/
+
 static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
                                             const BaseType_t xCanBlockIndefinitely )
 {
@@ -8481,6 +10678,13 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
     List_t * const pxDelayedList = pxDelayedTaskList;
     List_t * const pxOverflowDelayedList = pxOverflowDelayedTaskList;
 
+    #if ( configUSE_TASK_JOB_STATS == 1 )
+    {
+        /* Blocking ends the job of the task. */
+        prvEndCurrentTaskJob();
+    }
+    #endif
+
     #if ( INCLUDE_xTaskAbortDelay == 1 )
     {
         /* About to enter a delayed list, so ensure the ucDelayAborted flag is
@@ -8495,8 +10699,8 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
     if( uxListRemove( &( pxCurrentTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
     {
         /* The current task must be in a ready list, so there is no need to
-         * check, and the port reset macro can be called directly. */
-        portRESET_READY_PRIORITY( pxCurrentTCB->uxPriority, uxTopReadyPriority );
+         * check, and the unchecked reset macro can be called directly. */
+        taskCLEAR_READY_PRIORITY( pxCurrentTCB->uxPriority );
     }
     else
     {
@@ -8534,7 +10738,16 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
                 /* The wake time has not overflowed, so the current block list
                  * is used. */
                 traceMOVED_TASK_TO_DELAYED_LIST();
-                vListInsert( pxDelayedList, &( pxCurrentTCB->xStateListItem ) );
+
+                #if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+                {
+                    prvDelayedWheelInsert( pxDelayedList, &( pxCurrentTCB->xStateListItem ), xConstTickCount );
+                }
+                #else
+                {
+                    vListInsert( pxDelayedList, &( pxCurrentTCB->xStateListItem ) );
+                }
+                #endif
 
                 /* If the task entering the blocked state was placed at the
                  * head of the list of blocked tasks then xNextTaskUnblockTime
@@ -8570,7 +10783,15 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
         {
             traceMOVED_TASK_TO_DELAYED_LIST();
             /* The wake time has not overflowed, so the current block list is used. */
-            vListInsert( pxDelayedList, &( pxCurrentTCB->xStateListItem ) );
+            #if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+            {
+                prvDelayedWheelInsert( pxDelayedList, &( pxCurrentTCB->xStateListItem ), xConstTickCount );
+            }
+            #else
+            {
+                vListInsert( pxDelayedList, &( pxCurrentTCB->xStateListItem ) );
+            }
+            #endif
 
             /* If the task entering the blocked state was placed at the head of the
              * list of blocked tasks then xNextTaskUnblockTime needs to be updated
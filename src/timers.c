@@ -78,6 +78,11 @@
     #define tmrSTATUS_IS_ACTIVE                  ( 0x01U )
     #define tmrSTATUS_IS_STATICALLY_ALLOCATED    ( 0x02U )
     #define tmrSTATUS_IS_AUTORELOAD              ( 0x04U )
+    #define tmrSTATUS_IS_TICK_CONTEXT            ( 0x08U )
+
+/* The command ID of the message sent by xTimerCommandBatch().  It is only used
+ * within this file so it is not listed with the other command IDs in timers.h. */
+    #define tmrCOMMAND_BATCH                     ( ( BaseType_t ) 10 )
 
 /* The definition of the timers themselves. */
     typedef struct tmrTimerControl                                               /* The old naming convention is used to prevent breaking kernel aware debuggers. */
@@ -91,6 +96,12 @@
             UBaseType_t uxTimerNumber;                                           /**< An ID assigned by trace tools such as FreeRTOS+Trace */
         #endif
         uint8_t ucStatus;                                                        /**< Holds bits to say if the timer was statically allocated or not, and if it is active or not. */
+        #if ( configUSE_TIMER_HEAP == 1 )
+            struct tmrTimerControl * pxHeapChild;                                /**< The first child of the timer in the active timer heap. */
+            struct tmrTimerControl * pxHeapSibling;                              /**< The next sibling of the timer in the active timer heap. */
+            struct tmrTimerControl * pxHeapPrevious;                             /**< The parent of the timer if it is the first child, otherwise the previous sibling.  NULL for the heap root. */
+            struct tmrTimerControl ** ppxHeap;                                   /**< The active timer heap the timer is in, NULL if it is in neither. */
+        #endif
     } xTIMER;
 
 /* The old xTIMER name is maintained above then typedefed to the new Timer_t
@@ -117,6 +128,12 @@
         uint32_t ulParameter2;               /* << The value that will be used as the callback functions second parameter. */
     } CallbackParameters_t;
 
+    typedef struct tmrBatchParameters
+    {
+        TimerCommand_t * pxCommands; /**< The commands sent by xTimerCommandBatch(). */
+        UBaseType_t uxCommandCount;  /**< The number of entries in pxCommands. */
+    } BatchParameters_t;
+
 /* The structure that contains the two message types, along with an identifier
  * that is used to determine which message type is valid. */
     typedef struct tmrTimerQueueMessage
@@ -131,6 +148,10 @@
             #if ( INCLUDE_xTimerPendFunctionCall == 1 )
                 CallbackParameters_t xCallbackParameters;
             #endif /* INCLUDE_xTimerPendFunctionCall */
+
+            #if ( configUSE_TIMER_COMMAND_BATCH == 1 )
+                BatchParameters_t xBatchParameters;
+            #endif /* configUSE_TIMER_COMMAND_BATCH */
         } u;
     } DaemonTaskMessage_t;
 
@@ -140,15 +161,50 @@
  * xActiveTimerList1 and xActiveTimerList2 could be at function scope but that
  * breaks some kernel aware debuggers, and debuggers that reply on removing the
  * static qualifier. */
-    PRIVILEGED_DATA static List_t xActiveTimerList1;
-    PRIVILEGED_DATA static List_t xActiveTimerList2;
-    PRIVILEGED_DATA static List_t * pxCurrentTimerList;
-    PRIVILEGED_DATA static List_t * pxOverflowTimerList;
+    #if ( configUSE_TIMER_HEAP == 1 )
+
+/* With configUSE_TIMER_HEAP the active timers are held in two pairing heaps
+ * ordered by expiry time instead, the roots being the timers that expire first.
+ * The heaps are switched on a tick count overflow exactly like the lists.  The
+ * expiry time is still held in the value of xTimerListItem. */
+        PRIVILEGED_DATA static Timer_t * pxActiveTimerHeap1 = NULL;
+        PRIVILEGED_DATA static Timer_t * pxActiveTimerHeap2 = NULL;
+        PRIVILEGED_DATA static Timer_t ** ppxCurrentTimerHeap;
+        PRIVILEGED_DATA static Timer_t ** ppxOverflowTimerHeap;
+    #else
+        PRIVILEGED_DATA static List_t xActiveTimerList1;
+        PRIVILEGED_DATA static List_t xActiveTimerList2;
+        PRIVILEGED_DATA static List_t * pxCurrentTimerList;
+        PRIVILEGED_DATA static List_t * pxOverflowTimerList;
+    #endif /* configUSE_TIMER_HEAP */
+
+    #if ( configUSE_TICK_TIMERS == 1 )
+
+/* The lists in which active tick context timers are stored, switched on a tick
+ * count overflow like the lists above.  They are accessed from the tick
+ * interrupt and from critical sections only.  xNextTickTimerExpireTime is the
+ * expire time of the timer at the head of the current list, or earlier if that
+ * timer has since been stopped. */
+        PRIVILEGED_DATA static List_t xTickTimerList1;
+        PRIVILEGED_DATA static List_t xTickTimerList2;
+        PRIVILEGED_DATA static List_t * pxCurrentTickTimerList;
+        PRIVILEGED_DATA static List_t * pxOverflowTickTimerList;
+        PRIVILEGED_DATA static volatile TickType_t xNextTickTimerExpireTime = portMAX_DELAY;
+    #endif /* configUSE_TICK_TIMERS */
 
 /* A queue that is used to send commands to the timer service task. */
     PRIVILEGED_DATA static QueueHandle_t xTimerQueue = NULL;
     PRIVILEGED_DATA static TaskHandle_t xTimerTaskHandle = NULL;
 
+    #if ( configUSE_TIMER_COMMAND_BATCH == 1 )
+
+/* Non zero while the timer service task calls callbacks from a point where the
+ * active timer lists must not be changed under it (while the lists are being
+ * switched, or while an auto-reload timer catches up on missed periods).
+ * Commands issued by those callbacks are queued instead of applied directly. */
+        PRIVILEGED_DATA static UBaseType_t uxDirectCommandsBlocked = 0U;
+    #endif
+
 /*-----------------------------------------------------------*/
 
 /*
@@ -170,6 +226,31 @@
  */
     static void prvProcessReceivedCommands( void ) PRIVILEGED_FUNCTION;
 
+/*
+ * Apply a single timer command, received on the timer queue or issued by the
+ * timer service task itself, to a timer.
+ */
+    static void prvProcessTimerCommand( Timer_t * const pxTimer,
+                                        const BaseType_t xCommandID,
+                                        const TickType_t xMessageValue ) PRIVILEGED_FUNCTION;
+
+    #if ( configUSE_TIMER_COMMAND_BATCH == 1 )
+
+/*
+ * Apply the commands sent by xTimerCommandBatch() in order, marking each as
+ * done by setting its xTimer member to NULL.
+ */
+        static void prvProcessCommandBatch( TimerCommand_t * const pxCommands,
+                                            const UBaseType_t uxCommandCount ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns pdTRUE if the caller is the timer service task at a point where it
+ * can apply timer commands directly rather than sending them to itself.
+ */
+        static BaseType_t prvCanApplyCommandsDirectly( void ) PRIVILEGED_FUNCTION;
+
+    #endif /* configUSE_TIMER_COMMAND_BATCH */
+
 /*
  * Insert the timer into either xActiveTimerList1, or xActiveTimerList2,
  * depending on if the expire time causes a timer counter overflow.
@@ -232,6 +313,61 @@
                                        void * const pvTimerID,
                                        TimerCallbackFunction_t pxCallbackFunction,
                                        Timer_t * pxNewTimer ) PRIVILEGED_FUNCTION;
+
+    #if ( configUSE_TIMER_HEAP == 1 )
+
+/*
+ * Add pxTimer to the active timer heap *ppxHeap, keyed on the value of its
+ * xTimerListItem.
+ */
+        static void prvTimerHeapInsert( Timer_t ** const ppxHeap,
+                                        Timer_t * const pxTimer ) PRIVILEGED_FUNCTION;
+
+/*
+ * Remove pxTimer from the active timer heap it is in.
+ */
+        static void prvTimerHeapRemove( Timer_t * const pxTimer ) PRIVILEGED_FUNCTION;
+
+/*
+ * Link two heap roots into one heap and return the new root.
+ */
+        static Timer_t * prvTimerHeapMeld( Timer_t * const pxFirst,
+                                           Timer_t * const pxSecond ) PRIVILEGED_FUNCTION;
+
+/*
+ * Combine a list of sibling heaps, starting at pxFirst, into one heap and
+ * return its root.
+ */
+        static Timer_t * prvTimerHeapMergePairs( Timer_t * pxFirst ) PRIVILEGED_FUNCTION;
+
+    #endif /* configUSE_TIMER_HEAP */
+
+    #if ( configUSE_TICK_TIMERS == 1 )
+
+/*
+ * Apply a timer command to a tick context timer.  Must be called from within
+ * a critical section.
+ */
+        static void prvTickTimerCommand( Timer_t * const pxTimer,
+                                         const BaseType_t xCommandID,
+                                         const TickType_t xOptionalValue,
+                                         const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
+
+/*
+ * Insert a tick context timer into the current or the overflow tick timer
+ * list, depending on whether xExpiryTime has overflowed relative to xTimeNow.
+ */
+        static void prvInsertTimerInTickTimerList( Timer_t * const pxTimer,
+                                                   const TickType_t xExpiryTime,
+                                                   const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
+
+/*
+ * Call the callbacks of the tick context timers in the current tick timer
+ * list that expire at or before xTimeNow, reloading the auto-reload ones.
+ */
+        static void prvProcessExpiredTickTimers( const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
+
+    #endif /* configUSE_TICK_TIMERS */
 /*-----------------------------------------------------------*/
 
     BaseType_t xTimerCreateTimerTask( void )
@@ -414,6 +550,63 @@
     #endif /* configSUPPORT_STATIC_ALLOCATION */
 /*-----------------------------------------------------------*/
 
+    #if ( ( configUSE_TICK_TIMERS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+
+        TimerHandle_t xTimerCreateTickContext( const char * const pcTimerName,
+                                               const TickType_t xTimerPeriodInTicks,
+                                               const BaseType_t xAutoReload,
+                                               void * const pvTimerID,
+                                               TimerCallbackFunction_t pxCallbackFunction )
+        {
+            Timer_t * pxNewTimer;
+
+            traceENTER_xTimerCreateTickContext( pcTimerName, xTimerPeriodInTicks, xAutoReload, pvTimerID, pxCallbackFunction );
+
+            pxNewTimer = xTimerCreate( pcTimerName, xTimerPeriodInTicks, xAutoReload, pvTimerID, pxCallbackFunction );
+
+            if( pxNewTimer != NULL )
+            {
+                /* The timer has not been started yet, so nothing else can
+                 * access it. */
+                pxNewTimer->ucStatus |= ( uint8_t ) tmrSTATUS_IS_TICK_CONTEXT;
+            }
+
+            traceRETURN_xTimerCreateTickContext( pxNewTimer );
+
+            return pxNewTimer;
+        }
+
+    #endif /* ( configUSE_TICK_TIMERS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) */
+/*-----------------------------------------------------------*/
+
+    #if ( ( configUSE_TICK_TIMERS == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+
+        TimerHandle_t xTimerCreateTickContextStatic( const char * const pcTimerName,
+                                                     const TickType_t xTimerPeriodInTicks,
+                                                     const BaseType_t xAutoReload,
+                                                     void * const pvTimerID,
+                                                     TimerCallbackFunction_t pxCallbackFunction,
+                                                     StaticTimer_t * pxTimerBuffer )
+        {
+            Timer_t * pxNewTimer;
+
+            traceENTER_xTimerCreateTickContextStatic( pcTimerName, xTimerPeriodInTicks, xAutoReload, pvTimerID, pxCallbackFunction, pxTimerBuffer );
+
+            pxNewTimer = xTimerCreateStatic( pcTimerName, xTimerPeriodInTicks, xAutoReload, pvTimerID, pxCallbackFunction, pxTimerBuffer );
+
+            if( pxNewTimer != NULL )
+            {
+                pxNewTimer->ucStatus |= ( uint8_t ) tmrSTATUS_IS_TICK_CONTEXT;
+            }
+
+            traceRETURN_xTimerCreateTickContextStatic( pxNewTimer );
+
+            return pxNewTimer;
+        }
+
+    #endif /* ( configUSE_TICK_TIMERS == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) */
+/*-----------------------------------------------------------*/
+
     static void prvInitialiseNewTimer( const char * const pcTimerName,
                                        const TickType_t xTimerPeriodInTicks,
                                        const BaseType_t xAutoReload,
@@ -436,6 +629,15 @@
         pxNewTimer->pxCallbackFunction = pxCallbackFunction;
         vListInitialiseItem( &( pxNewTimer->xTimerListItem ) );
 
+        #if ( configUSE_TIMER_HEAP == 1 )
+        {
+            pxNewTimer->pxHeapChild = NULL;
+            pxNewTimer->pxHeapSibling = NULL;
+            pxNewTimer->pxHeapPrevious = NULL;
+            pxNewTimer->ppxHeap = NULL;
+        }
+        #endif
+
         if( xAutoReload != pdFALSE )
         {
             pxNewTimer->ucStatus |= ( uint8_t ) tmrSTATUS_IS_AUTORELOAD;
@@ -460,6 +662,49 @@
 
         configASSERT( xTimer );
 
+        #if ( configUSE_TICK_TIMERS == 1 )
+            if( ( ( ( Timer_t * ) xTimer )->ucStatus & tmrSTATUS_IS_TICK_CONTEXT ) != 0U )
+            {
+                /* Tick context timers are not handled by the timer service
+                 * task, apply the command now. */
+                configASSERT( xCommandID < tmrFIRST_FROM_ISR_COMMAND );
+
+                taskENTER_CRITICAL();
+                {
+                    prvTickTimerCommand( xTimer, xCommandID, xOptionalValue, xTaskGetTickCount() );
+                }
+                taskEXIT_CRITICAL();
+
+                #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+                {
+                    if( ( xCommandID == tmrCOMMAND_DELETE ) &&
+                        ( ( ( ( Timer_t * ) xTimer )->ucStatus & tmrSTATUS_IS_STATICALLY_ALLOCATED ) == ( uint8_t ) 0 ) )
+                    {
+                        vPortFree( xTimer );
+                    }
+                }
+                #endif
+
+                xReturn = pdPASS;
+            }
+            else
+        #endif /* configUSE_TICK_TIMERS */
+
+        #if ( configUSE_TIMER_COMMAND_BATCH == 1 )
+            if( prvCanApplyCommandsDirectly() != pdFALSE )
+            {
+                /* Called from a timer callback or pended function, so the
+                 * command can be applied here without a trip through the
+                 * queue.  It takes effect ahead of any command still queued. */
+                configASSERT( xCommandID < tmrFIRST_FROM_ISR_COMMAND );
+
+                traceTIMER_COMMAND_SEND( xTimer, xCommandID, xOptionalValue, pdPASS );
+                prvProcessTimerCommand( xTimer, xCommandID, xOptionalValue );
+                xReturn = pdPASS;
+            }
+            else
+        #endif /* configUSE_TIMER_COMMAND_BATCH */
+
         /* Send a message to the timer service task to perform a particular action
          * on a particular timer definition. */
         if( xTimerQueue != NULL )
@@ -511,6 +756,24 @@
 
         configASSERT( xTimer );
 
+        #if ( configUSE_TICK_TIMERS == 1 )
+            if( ( ( ( Timer_t * ) xTimer )->ucStatus & tmrSTATUS_IS_TICK_CONTEXT ) != 0U )
+            {
+                UBaseType_t uxSavedInterruptStatus;
+
+                configASSERT( xCommandID >= tmrFIRST_FROM_ISR_COMMAND );
+
+                uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+                {
+                    prvTickTimerCommand( xTimer, xCommandID, xOptionalValue, xTaskGetTickCountFromISR() );
+                }
+                taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+                xReturn = pdPASS;
+            }
+            else
+        #endif /* configUSE_TICK_TIMERS */
+
         /* Send a message to the timer service task to perform a particular action
          * on a particular timer definition. */
         if( xTimerQueue != NULL )
@@ -700,6 +963,15 @@
                                 TickType_t xExpiredTime,
                                 const TickType_t xTimeNow )
     {
+        #if ( configUSE_TIMER_COMMAND_BATCH == 1 )
+        {
+            /* The timer is not in a list while its callback is called below,
+             * a command applied to it from the callback would corrupt the
+             * loop. */
+            uxDirectCommandsBlocked++;
+        }
+        #endif
+
         /* Insert the timer into the appropriate list for the next expiry time.
          * If the next expiry time has already passed, advance the expiry time,
          * call the callback function, and try again. */
@@ -712,6 +984,12 @@
             traceTIMER_EXPIRED( pxTimer );
             pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
         }
+
+        #if ( configUSE_TIMER_COMMAND_BATCH == 1 )
+        {
+            uxDirectCommandsBlocked--;
+        }
+        #endif
     }
 /*-----------------------------------------------------------*/
 
@@ -721,12 +999,23 @@
         /* MISRA Ref 11.5.3 [Void pointer assignment] */
         /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
         /* coverity[misra_c_2012_rule_11_5_violation] */
-        Timer_t * const pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTimerList );
+        #if ( configUSE_TIMER_HEAP == 1 )
+            Timer_t * const pxTimer = *ppxCurrentTimerHeap;
+        #else
+            Timer_t * const pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTimerList );
+        #endif
 
         /* Remove the timer from the list of active timers.  A check has already
          * been performed to ensure the list is not empty. */
-
-        ( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+        #if ( configUSE_TIMER_HEAP == 1 )
+        {
+            prvTimerHeapRemove( pxTimer );
+        }
+        #else
+        {
+            ( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+        }
+        #endif
 
         /* If the timer is an auto-reload timer then calculate the next
          * expiry time and re-insert the timer in the list of active timers. */
@@ -814,7 +1103,15 @@
                     {
                         /* The current timer list is empty - is the overflow list
                          * also empty? */
-                        xListWasEmpty = listLIST_IS_EMPTY( pxOverflowTimerList );
+                        #if ( configUSE_TIMER_HEAP == 1 )
+                        {
+                            xListWasEmpty = ( *ppxOverflowTimerHeap == NULL ) ? pdTRUE : pdFALSE;
+                        }
+                        #else
+                        {
+                            xListWasEmpty = listLIST_IS_EMPTY( pxOverflowTimerList );
+                        }
+                        #endif
                     }
 
                     vQueueWaitForMessageRestricted( xTimerQueue, ( xNextExpireTime - xTimeNow ), xListWasEmpty );
@@ -852,11 +1149,27 @@
          * this task to unblock when the tick count overflows, at which point the
          * timer lists will be switched and the next expiry time can be
          * re-assessed.  */
-        *pxListWasEmpty = listLIST_IS_EMPTY( pxCurrentTimerList );
+        #if ( configUSE_TIMER_HEAP == 1 )
+        {
+            *pxListWasEmpty = ( *ppxCurrentTimerHeap == NULL ) ? pdTRUE : pdFALSE;
+        }
+        #else
+        {
+            *pxListWasEmpty = listLIST_IS_EMPTY( pxCurrentTimerList );
+        }
+        #endif
 
         if( *pxListWasEmpty == pdFALSE )
         {
-            xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentTimerList );
+            #if ( configUSE_TIMER_HEAP == 1 )
+            {
+                xNextExpireTime = listGET_LIST_ITEM_VALUE( &( ( *ppxCurrentTimerHeap )->xTimerListItem ) );
+            }
+            #else
+            {
+                xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentTimerList );
+            }
+            #endif
         }
         else
         {
@@ -913,7 +1226,15 @@
             }
             else
             {
-                vListInsert( pxOverflowTimerList, &( pxTimer->xTimerListItem ) );
+                #if ( configUSE_TIMER_HEAP == 1 )
+                {
+                    prvTimerHeapInsert( ppxOverflowTimerHeap, pxTimer );
+                }
+                #else
+                {
+                    vListInsert( pxOverflowTimerList, &( pxTimer->xTimerListItem ) );
+                }
+                #endif
             }
         }
         else
@@ -927,7 +1248,15 @@
             }
             else
             {
-                vListInsert( pxCurrentTimerList, &( pxTimer->xTimerListItem ) );
+                #if ( configUSE_TIMER_HEAP == 1 )
+                {
+                    prvTimerHeapInsert( ppxCurrentTimerHeap, pxTimer );
+                }
+                #else
+                {
+                    vListInsert( pxCurrentTimerList, &( pxTimer->xTimerListItem ) );
+                }
+                #endif
             }
         }
 
@@ -938,9 +1267,6 @@
     static void prvProcessReceivedCommands( void )
     {
         DaemonTaskMessage_t xMessage = { 0 };
-        Timer_t * pxTimer;
-        BaseType_t xTimerListsWereSwitched;
-        TickType_t xTimeNow;
 
         while( xQueueReceive( xTimerQueue, &xMessage, tmrNO_DELAY ) != pdFAIL )
         {
@@ -966,119 +1292,152 @@
             }
             #endif /* INCLUDE_xTimerPendFunctionCall */
 
+            #if ( configUSE_TIMER_COMMAND_BATCH == 1 )
+                if( xMessage.xMessageID == tmrCOMMAND_BATCH )
+                {
+                    prvProcessCommandBatch( xMessage.u.xBatchParameters.pxCommands, xMessage.u.xBatchParameters.uxCommandCount );
+                }
+                else
+            #endif /* configUSE_TIMER_COMMAND_BATCH */
+
             /* Commands that are positive are timer commands rather than pended
              * function calls. */
             if( xMessage.xMessageID >= ( BaseType_t ) 0 )
             {
                 /* The messages uses the xTimerParameters member to work on a
                  * software timer. */
-                pxTimer = xMessage.u.xTimerParameters.pxTimer;
+                prvProcessTimerCommand( xMessage.u.xTimerParameters.pxTimer, xMessage.xMessageID, xMessage.u.xTimerParameters.xMessageValue );
+            }
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvProcessTimerCommand( Timer_t * const pxTimer,
+                                        const BaseType_t xCommandID,
+                                        const TickType_t xMessageValue )
+    {
+        BaseType_t xTimerListsWereSwitched;
+        TickType_t xTimeNow;
+
+        #if ( configUSE_TIMER_HEAP == 1 )
+        {
+            if( pxTimer->ppxHeap != NULL )
+            {
+                /* The timer is in a heap, remove it. */
+                prvTimerHeapRemove( pxTimer );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #else
+        {
+            if( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xTimerListItem ) ) == pdFALSE )
+            {
+                /* The timer is in a list, remove it. */
+                ( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* configUSE_TIMER_HEAP */
+
+        traceTIMER_COMMAND_RECEIVED( pxTimer, xCommandID, xMessageValue );
 
-                if( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xTimerListItem ) ) == pdFALSE )
+        /* In this case the xTimerListsWereSwitched parameter is not used, but
+         *  it must be present in the function call.  prvSampleTimeNow() must be
+         *  called after the message is received from xTimerQueue so there is no
+         *  possibility of a higher priority task adding a message to the message
+         *  queue with a time that is ahead of the timer daemon task (because it
+         *  pre-empted the timer daemon task after the xTimeNow value was set). */
+        xTimeNow = prvSampleTimeNow( &xTimerListsWereSwitched );
+
+        switch( xCommandID )
+        {
+            case tmrCOMMAND_START:
+            case tmrCOMMAND_START_FROM_ISR:
+            case tmrCOMMAND_RESET:
+            case tmrCOMMAND_RESET_FROM_ISR:
+                /* Start or restart a timer. */
+                pxTimer->ucStatus |= ( uint8_t ) tmrSTATUS_IS_ACTIVE;
+
+                if( prvInsertTimerInActiveList( pxTimer, xMessageValue + pxTimer->xTimerPeriodInTicks, xTimeNow, xMessageValue ) != pdFALSE )
                 {
-                    /* The timer is in a list, remove it. */
-                    ( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+                    /* The timer expired before it was added to the active
+                     * timer list.  Process it now. */
+                    if( ( pxTimer->ucStatus & tmrSTATUS_IS_AUTORELOAD ) != 0U )
+                    {
+                        prvReloadTimer( pxTimer, xMessageValue + pxTimer->xTimerPeriodInTicks, xTimeNow );
+                    }
+                    else
+                    {
+                        pxTimer->ucStatus &= ( ( uint8_t ) ~tmrSTATUS_IS_ACTIVE );
+                    }
+
+                    /* Call the timer callback. */
+                    traceTIMER_EXPIRED( pxTimer );
+                    pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
                 }
                 else
                 {
                     mtCOVERAGE_TEST_MARKER();
                 }
 
-                traceTIMER_COMMAND_RECEIVED( pxTimer, xMessage.xMessageID, xMessage.u.xTimerParameters.xMessageValue );
-
-                /* In this case the xTimerListsWereSwitched parameter is not used, but
-                 *  it must be present in the function call.  prvSampleTimeNow() must be
-                 *  called after the message is received from xTimerQueue so there is no
-                 *  possibility of a higher priority task adding a message to the message
-                 *  queue with a time that is ahead of the timer daemon task (because it
-                 *  pre-empted the timer daemon task after the xTimeNow value was set). */
-                xTimeNow = prvSampleTimeNow( &xTimerListsWereSwitched );
-
-                switch( xMessage.xMessageID )
+                break;
+
+            case tmrCOMMAND_STOP:
+            case tmrCOMMAND_STOP_FROM_ISR:
+                /* The timer has already been removed from the active list. */
+                pxTimer->ucStatus &= ( ( uint8_t ) ~tmrSTATUS_IS_ACTIVE );
+                break;
+
+            case tmrCOMMAND_CHANGE_PERIOD:
+            case tmrCOMMAND_CHANGE_PERIOD_FROM_ISR:
+                pxTimer->ucStatus |= ( uint8_t ) tmrSTATUS_IS_ACTIVE;
+                pxTimer->xTimerPeriodInTicks = xMessageValue;
+                configASSERT( ( pxTimer->xTimerPeriodInTicks > 0 ) );
+
+                /* The new period does not really have a reference, and can
+                 * be longer or shorter than the old one.  The command time is
+                 * therefore set to the current time, and as the period cannot
+                 * be zero the next expiry time can only be in the future,
+                 * meaning (unlike for the xTimerStart() case above) there is
+                 * no fail case that needs to be handled here. */
+                ( void ) prvInsertTimerInActiveList( pxTimer, ( xTimeNow + pxTimer->xTimerPeriodInTicks ), xTimeNow, xTimeNow );
+                break;
+
+            case tmrCOMMAND_DELETE:
+                #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
                 {
-                    case tmrCOMMAND_START:
-                    case tmrCOMMAND_START_FROM_ISR:
-                    case tmrCOMMAND_RESET:
-                    case tmrCOMMAND_RESET_FROM_ISR:
-                        /* Start or restart a timer. */
-                        pxTimer->ucStatus |= ( uint8_t ) tmrSTATUS_IS_ACTIVE;
-
-                        if( prvInsertTimerInActiveList( pxTimer, xMessage.u.xTimerParameters.xMessageValue + pxTimer->xTimerPeriodInTicks, xTimeNow, xMessage.u.xTimerParameters.xMessageValue ) != pdFALSE )
-                        {
-                            /* The timer expired before it was added to the active
-                             * timer list.  Process it now. */
-                            if( ( pxTimer->ucStatus & tmrSTATUS_IS_AUTORELOAD ) != 0U )
-                            {
-                                prvReloadTimer( pxTimer, xMessage.u.xTimerParameters.xMessageValue + pxTimer->xTimerPeriodInTicks, xTimeNow );
-                            }
-                            else
-                            {
-                                pxTimer->ucStatus &= ( ( uint8_t ) ~tmrSTATUS_IS_ACTIVE );
-                            }
-
-                            /* Call the timer callback. */
-                            traceTIMER_EXPIRED( pxTimer );
-                            pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
-                        }
-                        else
-                        {
-                            mtCOVERAGE_TEST_MARKER();
-                        }
-
-                        break;
-
-                    case tmrCOMMAND_STOP:
-                    case tmrCOMMAND_STOP_FROM_ISR:
-                        /* The timer has already been removed from the active list. */
+                    /* The timer has already been removed from the active list,
+                     * just free up the memory if the memory was dynamically
+                     * allocated. */
+                    if( ( pxTimer->ucStatus & tmrSTATUS_IS_STATICALLY_ALLOCATED ) == ( uint8_t ) 0 )
+                    {
+                        vPortFree( pxTimer );
+                    }
+                    else
+                    {
                         pxTimer->ucStatus &= ( ( uint8_t ) ~tmrSTATUS_IS_ACTIVE );
-                        break;
-
-                    case tmrCOMMAND_CHANGE_PERIOD:
-                    case tmrCOMMAND_CHANGE_PERIOD_FROM_ISR:
-                        pxTimer->ucStatus |= ( uint8_t ) tmrSTATUS_IS_ACTIVE;
-                        pxTimer->xTimerPeriodInTicks = xMessage.u.xTimerParameters.xMessageValue;
-                        configASSERT( ( pxTimer->xTimerPeriodInTicks > 0 ) );
-
-                        /* The new period does not really have a reference, and can
-                         * be longer or shorter than the old one.  The command time is
-                         * therefore set to the current time, and as the period cannot
-                         * be zero the next expiry time can only be in the future,
-                         * meaning (unlike for the xTimerStart() case above) there is
-                         * no fail case that needs to be handled here. */
-                        ( void ) prvInsertTimerInActiveList( pxTimer, ( xTimeNow + pxTimer->xTimerPeriodInTicks ), xTimeNow, xTimeNow );
-                        break;
-
-                    case tmrCOMMAND_DELETE:
-                        #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
-                        {
-                            /* The timer has already been removed from the active list,
-                             * just free up the memory if the memory was dynamically
-                             * allocated. */
-                            if( ( pxTimer->ucStatus & tmrSTATUS_IS_STATICALLY_ALLOCATED ) == ( uint8_t ) 0 )
-                            {
-                                vPortFree( pxTimer );
-                            }
-                            else
-                            {
-                                pxTimer->ucStatus &= ( ( uint8_t ) ~tmrSTATUS_IS_ACTIVE );
-                            }
-                        }
-                        #else /* if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) */
-                        {
-                            /* If dynamic allocation is not enabled, the memory
-                             * could not have been dynamically allocated. So there is
-                             * no need to free the memory - just mark the timer as
-                             * "not active". */
-                            pxTimer->ucStatus &= ( ( uint8_t ) ~tmrSTATUS_IS_ACTIVE );
-                        }
-                        #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
-                        break;
-
-                    default:
-                        /* Don't expect to get here. */
-                        break;
+                    }
                 }
-            }
+                #else /* if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) */
+                {
+                    /* If dynamic allocation is not enabled, the memory
+                     * could not have been dynamically allocated. So there is
+                     * no need to free the memory - just mark the timer as
+                     * "not active". */
+                    pxTimer->ucStatus &= ( ( uint8_t ) ~tmrSTATUS_IS_ACTIVE );
+                }
+                #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+                break;
+
+            default:
+                /* Don't expect to get here. */
+                break;
         }
     }
 /*-----------------------------------------------------------*/
@@ -1086,15 +1445,34 @@
     static void prvSwitchTimerLists( void )
     {
         TickType_t xNextExpireTime;
-        List_t * pxTemp;
+        BaseType_t xListIsEmpty;
+
+        #if ( configUSE_TIMER_HEAP == 1 )
+            Timer_t ** ppxTemp;
+        #else
+            List_t * pxTemp;
+        #endif
+
+        #if ( configUSE_TIMER_COMMAND_BATCH == 1 )
+        {
+            /* A command applied from a callback called below would insert
+             * timers into lists that are about to be switched. */
+            uxDirectCommandsBlocked++;
+        }
+        #endif
 
         /* The tick count has overflowed.  The timer lists must be switched.
          * If there are any timers still referenced from the current timer list
          * then they must have expired and should be processed before the lists
          * are switched. */
-        while( listLIST_IS_EMPTY( pxCurrentTimerList ) == pdFALSE )
+        for( ; ; )
         {
-            xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentTimerList );
+            xNextExpireTime = prvGetNextExpireTime( &xListIsEmpty );
+
+            if( xListIsEmpty != pdFALSE )
+            {
+                break;
+            }
 
             /* Process the expired timer.  For auto-reload timers, be careful to
              * process only expirations that occur on the current list.  Further
@@ -1102,44 +1480,456 @@
             prvProcessExpiredTimer( xNextExpireTime, tmrMAX_TIME_BEFORE_OVERFLOW );
         }
 
-        pxTemp = pxCurrentTimerList;
-        pxCurrentTimerList = pxOverflowTimerList;
-        pxOverflowTimerList = pxTemp;
+        #if ( configUSE_TIMER_COMMAND_BATCH == 1 )
+        {
+            uxDirectCommandsBlocked--;
+        }
+        #endif
+
+        #if ( configUSE_TIMER_HEAP == 1 )
+        {
+            ppxTemp = ppxCurrentTimerHeap;
+            ppxCurrentTimerHeap = ppxOverflowTimerHeap;
+            ppxOverflowTimerHeap = ppxTemp;
+        }
+        #else
+        {
+            pxTemp = pxCurrentTimerList;
+            pxCurrentTimerList = pxOverflowTimerList;
+            pxOverflowTimerList = pxTemp;
+        }
+        #endif
     }
 /*-----------------------------------------------------------*/
 
-    static void prvCheckForValidListAndQueue( void )
-    {
-        /* Check that the list from which active timers are referenced, and the
-         * queue used to communicate with the timer service, have been
-         * initialised. */
-        taskENTER_CRITICAL();
+    #if ( configUSE_TIMER_HEAP == 1 )
+
+        static void prvTimerHeapInsert( Timer_t ** const ppxHeap,
+                                        Timer_t * const pxTimer )
         {
-            if( xTimerQueue == NULL )
+            pxTimer->pxHeapChild = NULL;
+            pxTimer->pxHeapSibling = NULL;
+            pxTimer->pxHeapPrevious = NULL;
+            pxTimer->ppxHeap = ppxHeap;
+
+            if( *ppxHeap == NULL )
+            {
+                *ppxHeap = pxTimer;
+            }
+            else
             {
-                vListInitialise( &xActiveTimerList1 );
-                vListInitialise( &xActiveTimerList2 );
-                pxCurrentTimerList = &xActiveTimerList1;
-                pxOverflowTimerList = &xActiveTimerList2;
+                *ppxHeap = prvTimerHeapMeld( *ppxHeap, pxTimer );
+            }
+        }
 
-                #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
-                {
-                    /* The timer queue is allocated statically in case
-                     * configSUPPORT_DYNAMIC_ALLOCATION is 0. */
-                    PRIVILEGED_DATA static StaticQueue_t xStaticTimerQueue;
-                    PRIVILEGED_DATA static uint8_t ucStaticTimerQueueStorage[ ( size_t ) configTIMER_QUEUE_LENGTH * sizeof( DaemonTaskMessage_t ) ];
+    #endif /* configUSE_TIMER_HEAP */
+/*-----------------------------------------------------------*/
 
-                    xTimerQueue = xQueueCreateStatic( ( UBaseType_t ) configTIMER_QUEUE_LENGTH, ( UBaseType_t ) sizeof( DaemonTaskMessage_t ), &( ucStaticTimerQueueStorage[ 0 ] ), &xStaticTimerQueue );
-                }
-                #else
-                {
-                    xTimerQueue = xQueueCreate( ( UBaseType_t ) configTIMER_QUEUE_LENGTH, ( UBaseType_t ) sizeof( DaemonTaskMessage_t ) );
-                }
-                #endif /* if ( configSUPPORT_STATIC_ALLOCATION == 1 ) */
+    #if ( configUSE_TIMER_HEAP == 1 )
 
-                #if ( configQUEUE_REGISTRY_SIZE > 0 )
-                {
-                    if( xTimerQueue != NULL )
+        static void prvTimerHeapRemove( Timer_t * const pxTimer )
+        {
+            Timer_t ** const ppxHeap = pxTimer->ppxHeap;
+            Timer_t * const pxPrevious = pxTimer->pxHeapPrevious;
+            Timer_t * const pxSibling = pxTimer->pxHeapSibling;
+            Timer_t * pxChildren;
+
+            /* The children of the removed timer form a heap of their own, which
+             * is merged back into what is left of the heap. */
+            pxChildren = prvTimerHeapMergePairs( pxTimer->pxHeapChild );
+
+            if( pxTimer == *ppxHeap )
+            {
+                *ppxHeap = pxChildren;
+            }
+            else
+            {
+                /* Unlink the timer from its parent or previous sibling. */
+                if( pxPrevious->pxHeapChild == pxTimer )
+                {
+                    pxPrevious->pxHeapChild = pxSibling;
+                }
+                else
+                {
+                    pxPrevious->pxHeapSibling = pxSibling;
+                }
+
+                if( pxSibling != NULL )
+                {
+                    pxSibling->pxHeapPrevious = pxPrevious;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                if( pxChildren != NULL )
+                {
+                    *ppxHeap = prvTimerHeapMeld( *ppxHeap, pxChildren );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+
+            pxTimer->pxHeapChild = NULL;
+            pxTimer->pxHeapSibling = NULL;
+            pxTimer->pxHeapPrevious = NULL;
+            pxTimer->ppxHeap = NULL;
+        }
+
+    #endif /* configUSE_TIMER_HEAP */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_TIMER_HEAP == 1 )
+
+        static Timer_t * prvTimerHeapMeld( Timer_t * const pxFirst,
+                                           Timer_t * const pxSecond )
+        {
+            Timer_t * pxParent;
+            Timer_t * pxChild;
+
+            /* The root with the earlier expiry time stays the root.  On equal
+             * expiry times pxFirst is kept so a timer added to the heap does not
+             * displace the root. */
+            if( listGET_LIST_ITEM_VALUE( &( pxSecond->xTimerListItem ) ) < listGET_LIST_ITEM_VALUE( &( pxFirst->xTimerListItem ) ) )
+            {
+                pxParent = pxSecond;
+                pxChild = pxFirst;
+            }
+            else
+            {
+                pxParent = pxFirst;
+                pxChild = pxSecond;
+            }
+
+            /* The other root becomes the first child. */
+            pxChild->pxHeapSibling = pxParent->pxHeapChild;
+
+            if( pxParent->pxHeapChild != NULL )
+            {
+                pxParent->pxHeapChild->pxHeapPrevious = pxChild;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxChild->pxHeapPrevious = pxParent;
+            pxParent->pxHeapChild = pxChild;
+            pxParent->pxHeapSibling = NULL;
+            pxParent->pxHeapPrevious = NULL;
+
+            return pxParent;
+        }
+
+    #endif /* configUSE_TIMER_HEAP */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_TIMER_HEAP == 1 )
+
+        static Timer_t * prvTimerHeapMergePairs( Timer_t * pxFirst )
+        {
+            Timer_t * pxPaired = NULL;
+            Timer_t * pxReturn = NULL;
+            Timer_t * pxSecond;
+            Timer_t * pxNext;
+
+            /* First pass, left to right: meld the siblings in pairs and push the
+             * results on a stack linked through pxHeapSibling. */
+            while( pxFirst != NULL )
+            {
+                pxSecond = pxFirst->pxHeapSibling;
+
+                if( pxSecond != NULL )
+                {
+                    pxNext = pxSecond->pxHeapSibling;
+                    pxFirst = prvTimerHeapMeld( pxFirst, pxSecond );
+                }
+                else
+                {
+                    pxNext = NULL;
+                    pxFirst->pxHeapPrevious = NULL;
+                }
+
+                pxFirst->pxHeapSibling = pxPaired;
+                pxPaired = pxFirst;
+                pxFirst = pxNext;
+            }
+
+            /* Second pass, right to left: meld the pairs into one heap. */
+            while( pxPaired != NULL )
+            {
+                pxNext = pxPaired->pxHeapSibling;
+
+                if( pxReturn == NULL )
+                {
+                    pxPaired->pxHeapSibling = NULL;
+                    pxReturn = pxPaired;
+                }
+                else
+                {
+                    pxReturn = prvTimerHeapMeld( pxReturn, pxPaired );
+                }
+
+                pxPaired = pxNext;
+            }
+
+            return pxReturn;
+        }
+
+    #endif /* configUSE_TIMER_HEAP */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_TICK_TIMERS == 1 )
+
+        static void prvTickTimerCommand( Timer_t * const pxTimer,
+                                         const BaseType_t xCommandID,
+                                         const TickType_t xOptionalValue,
+                                         const TickType_t xTimeNow )
+        {
+            if( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xTimerListItem ) ) == pdFALSE )
+            {
+                /* The timer is in a list, remove it. */
+                ( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            traceTIMER_COMMAND_RECEIVED( pxTimer, xCommandID, xOptionalValue );
+
+            switch( xCommandID )
+            {
+                case tmrCOMMAND_START:
+                case tmrCOMMAND_START_FROM_ISR:
+                case tmrCOMMAND_RESET:
+                case tmrCOMMAND_RESET_FROM_ISR:
+                    pxTimer->ucStatus |= ( uint8_t ) tmrSTATUS_IS_ACTIVE;
+
+                    /* xOptionalValue is the tick count at which the command was
+                     * issued.  If a whole period has already passed since then,
+                     * expire the timer on the next tick rather than calling the
+                     * callback from here. */
+                    if( ( ( TickType_t ) ( xTimeNow - xOptionalValue ) ) >= pxTimer->xTimerPeriodInTicks )
+                    {
+                        prvInsertTimerInTickTimerList( pxTimer, xTimeNow, xTimeNow );
+                    }
+                    else
+                    {
+                        prvInsertTimerInTickTimerList( pxTimer, xOptionalValue + pxTimer->xTimerPeriodInTicks, xTimeNow );
+                    }
+
+                    break;
+
+                case tmrCOMMAND_CHANGE_PERIOD:
+                case tmrCOMMAND_CHANGE_PERIOD_FROM_ISR:
+                    pxTimer->ucStatus |= ( uint8_t ) tmrSTATUS_IS_ACTIVE;
+                    pxTimer->xTimerPeriodInTicks = xOptionalValue;
+                    configASSERT( ( pxTimer->xTimerPeriodInTicks > 0 ) );
+                    prvInsertTimerInTickTimerList( pxTimer, xTimeNow + pxTimer->xTimerPeriodInTicks, xTimeNow );
+                    break;
+
+                case tmrCOMMAND_STOP:
+                case tmrCOMMAND_STOP_FROM_ISR:
+                case tmrCOMMAND_DELETE:
+                    /* The timer has already been removed from the list.  The
+                     * memory of a deleted timer is freed by the caller. */
+                    pxTimer->ucStatus &= ( ( uint8_t ) ~tmrSTATUS_IS_ACTIVE );
+                    break;
+
+                default:
+                    /* Don't expect to get here. */
+                    break;
+            }
+        }
+
+    #endif /* configUSE_TICK_TIMERS */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_TICK_TIMERS == 1 )
+
+        static void prvInsertTimerInTickTimerList( Timer_t * const pxTimer,
+                                                   const TickType_t xExpiryTime,
+                                                   const TickType_t xTimeNow )
+        {
+            listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), xExpiryTime );
+            listSET_LIST_ITEM_OWNER( &( pxTimer->xTimerListItem ), pxTimer );
+
+            if( xExpiryTime < xTimeNow )
+            {
+                /* The expiry time has overflowed. */
+                vListInsert( pxOverflowTickTimerList, &( pxTimer->xTimerListItem ) );
+            }
+            else
+            {
+                vListInsert( pxCurrentTickTimerList, &( pxTimer->xTimerListItem ) );
+
+                if( xExpiryTime < xNextTickTimerExpireTime )
+                {
+                    xNextTickTimerExpireTime = xExpiryTime;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        }
+
+    #endif /* configUSE_TICK_TIMERS */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_TICK_TIMERS == 1 )
+
+        static void prvProcessExpiredTickTimers( const TickType_t xTimeNow )
+        {
+            Timer_t * pxTimer;
+            TickType_t xExpiryTime;
+
+            while( listLIST_IS_EMPTY( pxCurrentTickTimerList ) == pdFALSE )
+            {
+                xExpiryTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentTickTimerList );
+
+                if( xExpiryTime > xTimeNow )
+                {
+                    break;
+                }
+
+                /* MISRA Ref 11.5.3 [Void pointer assignment] */
+                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+                /* coverity[misra_c_2012_rule_11_5_violation] */
+                pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTickTimerList );
+                ( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+
+                if( ( pxTimer->ucStatus & tmrSTATUS_IS_AUTORELOAD ) != 0U )
+                {
+                    /* Reload relative to the expiry time so the period does not
+                     * drift.  If that is still not after xTimeNow the timer
+                     * expires again in this loop. */
+                    prvInsertTimerInTickTimerList( pxTimer, xExpiryTime + pxTimer->xTimerPeriodInTicks, xExpiryTime );
+                }
+                else
+                {
+                    pxTimer->ucStatus &= ( ( uint8_t ) ~tmrSTATUS_IS_ACTIVE );
+                }
+
+                traceTIMER_EXPIRED( pxTimer );
+                pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
+            }
+        }
+
+    #endif /* configUSE_TICK_TIMERS */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_TICK_TIMERS == 1 )
+
+        void vTimerProcessTickTimers( const TickType_t xTickCount )
+        {
+            List_t * pxTemp;
+
+            if( xTickCount == ( TickType_t ) 0U )
+            {
+                /* The tick count has overflowed.  Any timers still in the
+                 * current list have expired, process them before switching
+                 * the lists. */
+                prvProcessExpiredTickTimers( tmrMAX_TIME_BEFORE_OVERFLOW );
+
+                pxTemp = pxCurrentTickTimerList;
+                pxCurrentTickTimerList = pxOverflowTickTimerList;
+                pxOverflowTickTimerList = pxTemp;
+
+                xNextTickTimerExpireTime = ( TickType_t ) 0U;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            /* The only check made on most ticks. */
+            if( xTickCount >= xNextTickTimerExpireTime )
+            {
+                prvProcessExpiredTickTimers( xTickCount );
+
+                if( listLIST_IS_EMPTY( pxCurrentTickTimerList ) != pdFALSE )
+                {
+                    xNextTickTimerExpireTime = portMAX_DELAY;
+                }
+                else
+                {
+                    xNextTickTimerExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentTickTimerList );
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+    #endif /* configUSE_TICK_TIMERS */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_TICK_TIMERS == 1 )
+
+        TickType_t xTimerGetNextTickTimerExpireTime( void )
+        {
+            return xNextTickTimerExpireTime;
+        }
+
+    #endif /* configUSE_TICK_TIMERS */
+/*-----------------------------------------------------------*/
+
+    static void prvCheckForValidListAndQueue( void )
+    {
+        /* Check that the list from which active timers are referenced, and the
+         * queue used to communicate with the timer service, have been
+         * initialised. */
+        taskENTER_CRITICAL();
+        {
+            if( xTimerQueue == NULL )
+            {
+                #if ( configUSE_TIMER_HEAP == 1 )
+                {
+                    ppxCurrentTimerHeap = &pxActiveTimerHeap1;
+                    ppxOverflowTimerHeap = &pxActiveTimerHeap2;
+                }
+                #else
+                {
+                    vListInitialise( &xActiveTimerList1 );
+                    vListInitialise( &xActiveTimerList2 );
+                    pxCurrentTimerList = &xActiveTimerList1;
+                    pxOverflowTimerList = &xActiveTimerList2;
+                }
+                #endif
+
+                #if ( configUSE_TICK_TIMERS == 1 )
+                {
+                    vListInitialise( &xTickTimerList1 );
+                    vListInitialise( &xTickTimerList2 );
+                    pxCurrentTickTimerList = &xTickTimerList1;
+                    pxOverflowTickTimerList = &xTickTimerList2;
+                }
+                #endif
+
+                #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+                {
+                    /* The timer queue is allocated statically in case
+                     * configSUPPORT_DYNAMIC_ALLOCATION is 0. */
+                    PRIVILEGED_DATA static StaticQueue_t xStaticTimerQueue;
+                    PRIVILEGED_DATA static uint8_t ucStaticTimerQueueStorage[ ( size_t ) configTIMER_QUEUE_LENGTH * sizeof( DaemonTaskMessage_t ) ];
+
+                    xTimerQueue = xQueueCreateStatic( ( UBaseType_t ) configTIMER_QUEUE_LENGTH, ( UBaseType_t ) sizeof( DaemonTaskMessage_t ), &( ucStaticTimerQueueStorage[ 0 ] ), &xStaticTimerQueue );
+                }
+                #else
+                {
+                    xTimerQueue = xQueueCreate( ( UBaseType_t ) configTIMER_QUEUE_LENGTH, ( UBaseType_t ) sizeof( DaemonTaskMessage_t ) );
+                }
+                #endif /* if ( configSUPPORT_STATIC_ALLOCATION == 1 ) */
+
+                #if ( configQUEUE_REGISTRY_SIZE > 0 )
+                {
+                    if( xTimerQueue != NULL )
                     {
                         vQueueAddToRegistry( xTimerQueue, "TmrQ" );
                     }
@@ -1293,6 +2083,171 @@
     #endif /* INCLUDE_xTimerPendFunctionCall */
 /*-----------------------------------------------------------*/
 
+    #if ( configUSE_TIMER_COMMAND_BATCH == 1 )
+
+        static BaseType_t prvCanApplyCommandsDirectly( void )
+        {
+            BaseType_t xReturn;
+
+            /* Only the timer service task itself may touch the active timer
+             * lists outside of the tick context, and only when it is not in
+             * the middle of walking them. */
+            if( ( xTaskGetSchedulerState() != taskSCHEDULER_NOT_STARTED ) &&
+                ( xTaskGetCurrentTaskHandle() == xTimerTaskHandle ) &&
+                ( uxDirectCommandsBlocked == 0U ) )
+            {
+                xReturn = pdTRUE;
+            }
+            else
+            {
+                xReturn = pdFALSE;
+            }
+
+            return xReturn;
+        }
+
+    #endif /* configUSE_TIMER_COMMAND_BATCH */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_TIMER_COMMAND_BATCH == 1 )
+
+        static void prvProcessCommandBatch( TimerCommand_t * const pxCommands,
+                                            const UBaseType_t uxCommandCount )
+        {
+            UBaseType_t uxIndex;
+            Timer_t * pxTimer;
+
+            for( uxIndex = 0U; uxIndex < uxCommandCount; uxIndex++ )
+            {
+                pxTimer = pxCommands[ uxIndex ].xTimer;
+
+                #if ( configUSE_TICK_TIMERS == 1 )
+                    if( ( pxTimer->ucStatus & tmrSTATUS_IS_TICK_CONTEXT ) != 0U )
+                    {
+                        /* Tick context timers live in their own lists, which
+                         * are only changed with interrupts masked. */
+                        ( void ) xTimerGenericCommandFromTask( pxTimer, pxCommands[ uxIndex ].xCommandID, pxCommands[ uxIndex ].xOptionalValue, NULL, tmrNO_DELAY );
+                    }
+                    else
+                #endif /* configUSE_TICK_TIMERS */
+                {
+                    prvProcessTimerCommand( pxTimer, pxCommands[ uxIndex ].xCommandID, pxCommands[ uxIndex ].xOptionalValue );
+                }
+
+                /* Hand the entry back to the sender. */
+                pxCommands[ uxIndex ].xTimer = NULL;
+            }
+        }
+
+    #endif /* configUSE_TIMER_COMMAND_BATCH */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_TIMER_COMMAND_BATCH == 1 )
+
+        BaseType_t xTimerCommandBatch( TimerCommand_t * const pxCommands,
+                                       const UBaseType_t uxCommandCount,
+                                       const TickType_t xTicksToWait )
+        {
+            DaemonTaskMessage_t xMessage;
+            BaseType_t xReturn = pdFAIL;
+            UBaseType_t uxIndex;
+            TickType_t xTimeNow;
+
+            traceENTER_xTimerCommandBatch( pxCommands, uxCommandCount, xTicksToWait );
+
+            configASSERT( pxCommands );
+            configASSERT( uxCommandCount > 0U );
+
+            xTimeNow = xTaskGetTickCount();
+
+            for( uxIndex = 0U; uxIndex < uxCommandCount; uxIndex++ )
+            {
+                configASSERT( pxCommands[ uxIndex ].xTimer );
+                configASSERT( ( pxCommands[ uxIndex ].xCommandID >= tmrCOMMAND_START ) && ( pxCommands[ uxIndex ].xCommandID < tmrFIRST_FROM_ISR_COMMAND ) );
+
+                /* Start and reset commands are timed from the point the batch
+                 * is sent, exactly as if each had been sent on its own. */
+                if( ( pxCommands[ uxIndex ].xCommandID == tmrCOMMAND_START ) ||
+                    ( pxCommands[ uxIndex ].xCommandID == tmrCOMMAND_RESET ) )
+                {
+                    pxCommands[ uxIndex ].xOptionalValue = xTimeNow;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+
+            if( prvCanApplyCommandsDirectly() != pdFALSE )
+            {
+                prvProcessCommandBatch( pxCommands, uxCommandCount );
+                xReturn = pdPASS;
+            }
+            else if( xTimerQueue != NULL )
+            {
+                /* Only a reference to the array is queued, so the array must
+                 * remain valid until xTimerCommandBatchIsComplete() returns
+                 * pdTRUE. */
+                xMessage.xMessageID = tmrCOMMAND_BATCH;
+                xMessage.u.xBatchParameters.pxCommands = pxCommands;
+                xMessage.u.xBatchParameters.uxCommandCount = uxCommandCount;
+
+                if( xTaskGetSchedulerState() == taskSCHEDULER_RUNNING )
+                {
+                    xReturn = xQueueSendToBack( xTimerQueue, &xMessage, xTicksToWait );
+                }
+                else
+                {
+                    xReturn = xQueueSendToBack( xTimerQueue, &xMessage, tmrNO_DELAY );
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            traceRETURN_xTimerCommandBatch( xReturn );
+
+            return xReturn;
+        }
+
+    #endif /* configUSE_TIMER_COMMAND_BATCH */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_TIMER_COMMAND_BATCH == 1 )
+
+        BaseType_t xTimerCommandBatchIsComplete( const TimerCommand_t * const pxCommands,
+                                                 const UBaseType_t uxCommandCount )
+        {
+            BaseType_t xReturn;
+            const volatile TimerHandle_t * pxLastTimer;
+
+            traceENTER_xTimerCommandBatchIsComplete( pxCommands, uxCommandCount );
+
+            configASSERT( pxCommands );
+            configASSERT( uxCommandCount > 0U );
+
+            /* The timer service task applies the entries in order, so the
+             * batch is complete once the last entry has been handed back. */
+            pxLastTimer = &( pxCommands[ uxCommandCount - 1U ].xTimer );
+
+            if( *pxLastTimer == NULL )
+            {
+                xReturn = pdTRUE;
+            }
+            else
+            {
+                xReturn = pdFALSE;
+            }
+
+            traceRETURN_xTimerCommandBatchIsComplete( xReturn );
+
+            return xReturn;
+        }
+
+    #endif /* configUSE_TIMER_COMMAND_BATCH */
+/*-----------------------------------------------------------*/
+
     #if ( configUSE_TRACE_FACILITY == 1 )
 
         UBaseType_t uxTimerGetTimerNumber( TimerHandle_t xTimer )
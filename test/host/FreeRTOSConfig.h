@@ -0,0 +1,322 @@
+/*_____________________________________________________________________________
+ │                                                                            |
+ │ COPYRIGHT (C) 2026 Mihai Baneu                                             |
+ │                                                                            |
+ | Permission is hereby  granted,  free of charge,  to any person obtaining a |
+ | copy of this software and associated documentation files (the "Software"), |
+ | to deal in the Software without restriction,  including without limitation |
+ | the rights to  use, copy, modify, merge, publish, distribute,  sublicense, |
+ | and/or sell copies  of  the Software, and to permit  persons to  whom  the |
+ | Software is furnished to do so, subject to the following conditions:       |
+ |                                                                            |
+ | The above  copyright notice  and this permission notice  shall be included |
+ | in all copies or substantial portions of the Software.                     |
+ |                                                                            |
+ | THE SOFTWARE IS PROVIDED  "AS IS",  WITHOUT WARRANTY OF ANY KIND,  EXPRESS |
+ | OR   IMPLIED,   INCLUDING   BUT   NOT   LIMITED   TO   THE  WARRANTIES  OF |
+ | MERCHANTABILITY,  FITNESS FOR  A  PARTICULAR  PURPOSE AND NONINFRINGEMENT. |
+ | IN NO  EVENT SHALL  THE AUTHORS  OR  COPYRIGHT  HOLDERS  BE LIABLE FOR ANY |
+ | CLAIM, DAMAGES OR OTHER LIABILITY,  WHETHER IN AN ACTION OF CONTRACT, TORT |
+ | OR OTHERWISE, ARISING FROM,  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR  |
+ | THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                 |
+ |____________________________________________________________________________|
+ |                                                                            |
+ |  Author: Mihai Baneu                           Last modified: 17.Oct.2026  |
+ |                                                                            |
+ |___________________________________________________________________________*/
+
+/* The FreeRTOSConfig.h of the host tests. The values follow the port
+ * configurations, every one of them can be overridden by a test from the
+ * compiler command line. */
+
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+/* Kernel. */
+#ifndef configCPU_CLOCK_HZ
+    #define configCPU_CLOCK_HZ                           16000000
+#endif
+#ifndef configTICK_RATE_HZ
+    #define configTICK_RATE_HZ                           1000
+#endif
+#ifndef configUSE_PREEMPTION
+    #define configUSE_PREEMPTION                         1
+#endif
+#ifndef configUSE_TIME_SLICING
+    #define configUSE_TIME_SLICING                       0
+#endif
+#ifndef configUSE_PORT_OPTIMISED_TASK_SELECTION
+    #define configUSE_PORT_OPTIMISED_TASK_SELECTION      1
+#endif
+#ifndef configUSE_TICKLESS_IDLE
+    #define configUSE_TICKLESS_IDLE                      0
+#endif
+#ifndef configMAX_PRIORITIES
+    #define configMAX_PRIORITIES                         16
+#endif
+#ifndef configUSE_EDF_SCHEDULING
+    #define configUSE_EDF_SCHEDULING                     0
+#endif
+#ifndef configEDF_PRIORITY
+    #define configEDF_PRIORITY                           ( configMAX_PRIORITIES / 2 )
+#endif
+#ifndef configMINIMAL_STACK_SIZE
+    #define configMINIMAL_STACK_SIZE                     256
+#endif
+#ifndef configMAX_TASK_NAME_LEN
+    #define configMAX_TASK_NAME_LEN                      16
+#endif
+#ifndef configTICK_TYPE_WIDTH_IN_BITS
+    #define configTICK_TYPE_WIDTH_IN_BITS                TICK_TYPE_WIDTH_32_BITS
+#endif
+#ifndef configUSE_DELAYED_TASK_WHEEL
+    #define configUSE_DELAYED_TASK_WHEEL                 0
+#endif
+#ifndef configDELAYED_TASK_WHEEL_LEVELS
+    #define configDELAYED_TASK_WHEEL_LEVELS              2
+#endif
+#ifndef configIDLE_SHOULD_YIELD
+    #define configIDLE_SHOULD_YIELD                      1
+#endif
+#ifndef configTASK_NOTIFICATION_ARRAY_ENTRIES
+    #define configTASK_NOTIFICATION_ARRAY_ENTRIES        1
+#endif
+#ifndef configUSE_TASK_MAILBOX
+    #define configUSE_TASK_MAILBOX                       0
+#endif
+#ifndef configTASK_MAILBOX_SIZE
+    #define configTASK_MAILBOX_SIZE                      16
+#endif
+#ifndef configQUEUE_REGISTRY_SIZE
+    #define configQUEUE_REGISTRY_SIZE                    0
+#endif
+#ifndef configENABLE_BACKWARD_COMPATIBILITY
+    #define configENABLE_BACKWARD_COMPATIBILITY          0
+#endif
+#ifndef configNUM_THREAD_LOCAL_STORAGE_POINTERS
+    #define configNUM_THREAD_LOCAL_STORAGE_POINTERS      0
+#endif
+#ifndef configUSE_MINI_LIST_ITEM
+    #define configUSE_MINI_LIST_ITEM                     1
+#endif
+#ifndef configSTACK_DEPTH_TYPE
+    #define configSTACK_DEPTH_TYPE                       size_t
+#endif
+#ifndef configMESSAGE_BUFFER_LENGTH_TYPE
+    #define configMESSAGE_BUFFER_LENGTH_TYPE             size_t
+#endif
+#ifndef configUSE_NEWLIB_REENTRANT
+    #define configUSE_NEWLIB_REENTRANT                   0
+#endif
+
+/* Timers, deferred work and the task pool. */
+#ifndef configUSE_TIMERS
+    #define configUSE_TIMERS                             0
+#endif
+#ifndef configTIMER_TASK_PRIORITY
+    #define configTIMER_TASK_PRIORITY                    ( configMAX_PRIORITIES - 1 )
+#endif
+#ifndef configTIMER_TASK_STACK_DEPTH
+    #define configTIMER_TASK_STACK_DEPTH                 configMINIMAL_STACK_SIZE
+#endif
+#ifndef configTIMER_QUEUE_LENGTH
+    #define configTIMER_QUEUE_LENGTH                     10
+#endif
+#ifndef configUSE_TIMER_HEAP
+    #define configUSE_TIMER_HEAP                         0
+#endif
+#ifndef configUSE_TICK_TIMERS
+    #define configUSE_TICK_TIMERS                        0
+#endif
+#ifndef configUSE_TIMER_COMMAND_BATCH
+    #define configUSE_TIMER_COMMAND_BATCH                0
+#endif
+#ifndef configUSE_DEFERRED_WORK
+    #define configUSE_DEFERRED_WORK                      0
+#endif
+#ifndef configDEFERRED_WORK_LANES
+    #define configDEFERRED_WORK_LANES                    2
+#endif
+#ifndef configDEFERRED_WORK_QUEUE_LENGTH
+    #define configDEFERRED_WORK_QUEUE_LENGTH             16
+#endif
+#ifndef configDEFERRED_WORK_TASK_PRIORITY
+    #define configDEFERRED_WORK_TASK_PRIORITY            ( configMAX_PRIORITIES - 1 )
+#endif
+#ifndef configDEFERRED_WORK_TASK_STACK_DEPTH
+    #define configDEFERRED_WORK_TASK_STACK_DEPTH         configMINIMAL_STACK_SIZE
+#endif
+#ifndef configUSE_TASK_POOL
+    #define configUSE_TASK_POOL                          0
+#endif
+#ifndef configTASK_POOL_SIZE
+    #define configTASK_POOL_SIZE                         4
+#endif
+#ifndef configTASK_POOL_STACK_DEPTH
+    #define configTASK_POOL_STACK_DEPTH                  configMINIMAL_STACK_SIZE
+#endif
+#ifndef configTASK_POOL_TASK_PRIORITY
+    #define configTASK_POOL_TASK_PRIORITY                ( configMAX_PRIORITIES - 1 )
+#endif
+
+/* Memory allocation. */
+#ifndef configSUPPORT_STATIC_ALLOCATION
+    #define configSUPPORT_STATIC_ALLOCATION              0
+#endif
+#ifndef configSUPPORT_DYNAMIC_ALLOCATION
+    #define configSUPPORT_DYNAMIC_ALLOCATION             1
+#endif
+#ifndef configSTACK_ALLOCATION_FROM_SEPARATE_HEAP
+    #define configSTACK_ALLOCATION_FROM_SEPARATE_HEAP    0
+#endif
+#ifndef configRECORD_STACK_HIGH_ADDRESS
+    #define configRECORD_STACK_HIGH_ADDRESS              1
+#endif
+
+/* Hooks and stack checking. */
+#ifndef configUSE_IDLE_HOOK
+    #define configUSE_IDLE_HOOK                          0
+#endif
+#ifndef configUSE_TICK_HOOK
+    #define configUSE_TICK_HOOK                          0
+#endif
+#ifndef configUSE_MALLOC_FAILED_HOOK
+    #define configUSE_MALLOC_FAILED_HOOK                 0
+#endif
+#ifndef configUSE_DAEMON_TASK_STARTUP_HOOK
+    #define configUSE_DAEMON_TASK_STARTUP_HOOK           0
+#endif
+#ifndef configUSE_SB_COMPLETED_CALLBACK
+    #define configUSE_SB_COMPLETED_CALLBACK              0
+#endif
+#ifndef configCHECK_FOR_STACK_OVERFLOW
+    #define configCHECK_FOR_STACK_OVERFLOW               0
+#endif
+#ifndef configUSE_PARTIAL_STACK_PAINTING
+    #define configUSE_PARTIAL_STACK_PAINTING             0
+#endif
+#ifndef configSTACK_PAINT_DEPTH
+    #define configSTACK_PAINT_DEPTH                      64
+#endif
+#ifndef configUSE_IDLE_STACK_SCAN
+    #define configUSE_IDLE_STACK_SCAN                    0
+#endif
+#ifndef configIDLE_STACK_SCAN_WORDS
+    #define configIDLE_STACK_SCAN_WORDS                  64
+#endif
+
+/* Run time and job statistics. */
+#ifndef configGENERATE_RUN_TIME_STATS
+    #define configGENERATE_RUN_TIME_STATS                0
+#endif
+#ifndef configRUN_TIME_COUNTER_WIDTH_IN_BITS
+    #define configRUN_TIME_COUNTER_WIDTH_IN_BITS         32
+#endif
+#ifndef configUSE_TASK_BUDGETS
+    #define configUSE_TASK_BUDGETS                       0
+#endif
+#ifndef configTASK_BUDGET_BACKGROUND_PRIORITY
+    #define configTASK_BUDGET_BACKGROUND_PRIORITY        tskIDLE_PRIORITY
+#endif
+#ifndef configUSE_TASK_JOB_STATS
+    #define configUSE_TASK_JOB_STATS                     0
+#endif
+#ifndef configTASK_JOB_STATS_HISTOGRAM_BINS
+    #define configTASK_JOB_STATS_HISTOGRAM_BINS          16
+#endif
+#ifndef configTASK_JOB_STATS_HISTOGRAM_SHIFT
+    #define configTASK_JOB_STATS_HISTOGRAM_SHIFT         8
+#endif
+#ifndef configUSE_TASK_OVERRUN_STATS
+    #define configUSE_TASK_OVERRUN_STATS                 0
+#endif
+#ifndef configUSE_TASK_OVERRUN_HOOK
+    #define configUSE_TASK_OVERRUN_HOOK                  0
+#endif
+#ifndef configUSE_TRACE_FACILITY
+    #define configUSE_TRACE_FACILITY                     1
+#endif
+#ifndef configUSE_STATS_FORMATTING_FUNCTIONS
+    #define configUSE_STATS_FORMATTING_FUNCTIONS         0
+#endif
+
+/* Optional features. */
+#ifndef configUSE_CO_ROUTINES
+    #define configUSE_CO_ROUTINES                        0
+#endif
+#ifndef configMAX_CO_ROUTINE_PRIORITIES
+    #define configMAX_CO_ROUTINE_PRIORITIES              1
+#endif
+#ifndef configUSE_TASK_NOTIFICATIONS
+    #define configUSE_TASK_NOTIFICATIONS                 1
+#endif
+#ifndef configUSE_MUTEXES
+    #define configUSE_MUTEXES                            1
+#endif
+#ifndef configUSE_RECURSIVE_MUTEXES
+    #define configUSE_RECURSIVE_MUTEXES                  1
+#endif
+#ifndef configUSE_COUNTING_SEMAPHORES
+    #define configUSE_COUNTING_SEMAPHORES                1
+#endif
+#ifndef configUSE_QUEUE_SETS
+    #define configUSE_QUEUE_SETS                         0
+#endif
+#ifndef configUSE_APPLICATION_TASK_TAG
+    #define configUSE_APPLICATION_TASK_TAG               0
+#endif
+
+/* API functions included. */
+#ifndef INCLUDE_vTaskPrioritySet
+    #define INCLUDE_vTaskPrioritySet                     1
+#endif
+#ifndef INCLUDE_uxTaskPriorityGet
+    #define INCLUDE_uxTaskPriorityGet                    1
+#endif
+#ifndef INCLUDE_vTaskDelete
+    #define INCLUDE_vTaskDelete                          1
+#endif
+#ifndef INCLUDE_vTaskSuspend
+    #define INCLUDE_vTaskSuspend                         1
+#endif
+#ifndef INCLUDE_xResumeFromISR
+    #define INCLUDE_xResumeFromISR                       1
+#endif
+#ifndef INCLUDE_vTaskDelayUntil
+    #define INCLUDE_vTaskDelayUntil                      1
+#endif
+#ifndef INCLUDE_vTaskDelay
+    #define INCLUDE_vTaskDelay                           1
+#endif
+#ifndef INCLUDE_xTaskGetSchedulerState
+    #define INCLUDE_xTaskGetSchedulerState               1
+#endif
+#ifndef INCLUDE_xTaskGetCurrentTaskHandle
+    #define INCLUDE_xTaskGetCurrentTaskHandle            1
+#endif
+#ifndef INCLUDE_uxTaskGetStackHighWaterMark
+    #define INCLUDE_uxTaskGetStackHighWaterMark          1
+#endif
+#ifndef INCLUDE_xTaskGetIdleTaskHandle
+    #define INCLUDE_xTaskGetIdleTaskHandle               1
+#endif
+#ifndef INCLUDE_eTaskGetState
+    #define INCLUDE_eTaskGetState                        1
+#endif
+#ifndef INCLUDE_xEventGroupSetBitFromISR
+    #define INCLUDE_xEventGroupSetBitFromISR             1
+#endif
+#ifndef INCLUDE_xTimerPendFunctionCall
+    #define INCLUDE_xTimerPendFunctionCall               configUSE_TIMERS
+#endif
+#ifndef INCLUDE_xTaskAbortDelay
+    #define INCLUDE_xTaskAbortDelay                      0
+#endif
+#ifndef INCLUDE_xTaskGetHandle
+    #define INCLUDE_xTaskGetHandle                       1
+#endif
+#ifndef INCLUDE_xTaskResumeFromISR
+    #define INCLUDE_xTaskResumeFromISR                   1
+#endif
+
+#endif /* FREERTOS_CONFIG_H */
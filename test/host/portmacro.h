@@ -0,0 +1,93 @@
+/*_____________________________________________________________________________
+ │                                                                            |
+ │ COPYRIGHT (C) 2026 Mihai Baneu                                             |
+ │                                                                            |
+ | Permission is hereby  granted,  free of charge,  to any person obtaining a |
+ | copy of this software and associated documentation files (the "Software"), |
+ | to deal in the Software without restriction,  including without limitation |
+ | the rights to  use, copy, modify, merge, publish, distribute,  sublicense, |
+ | and/or sell copies  of  the Software, and to permit  persons to  whom  the |
+ | Software is furnished to do so, subject to the following conditions:       |
+ |                                                                            |
+ | The above  copyright notice  and this permission notice  shall be included |
+ | in all copies or substantial portions of the Software.                     |
+ |                                                                            |
+ | THE SOFTWARE IS PROVIDED  "AS IS",  WITHOUT WARRANTY OF ANY KIND,  EXPRESS |
+ | OR   IMPLIED,   INCLUDING   BUT   NOT   LIMITED   TO   THE  WARRANTIES  OF |
+ | MERCHANTABILITY,  FITNESS FOR  A  PARTICULAR  PURPOSE AND NONINFRINGEMENT. |
+ | IN NO  EVENT SHALL  THE AUTHORS  OR  COPYRIGHT  HOLDERS  BE LIABLE FOR ANY |
+ | CLAIM, DAMAGES OR OTHER LIABILITY,  WHETHER IN AN ACTION OF CONTRACT, TORT |
+ | OR OTHERWISE, ARISING FROM,  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR  |
+ | THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                 |
+ |____________________________________________________________________________|
+ |                                                                            |
+ |  Author: Mihai Baneu                           Last modified: 17.Oct.2026  |
+ |                                                                            |
+ |___________________________________________________________________________*/
+
+/* The port of the host tests. The kernel runs single threaded: either the test
+ * drives it step by step (sim.h), or every task gets its own ucontext and a
+ * yield switches at the end of the outermost critical section, like a pended
+ * PendSV (sim_context.h, built with SIM_CONTEXTS). Interrupts are simulated by
+ * calling the FromISR functions from the running task. */
+
+#ifndef PORTMACRO_H
+#define PORTMACRO_H
+
+#include <stdint.h>
+#include <assert.h>
+
+typedef uintptr_t StackType_t;
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define portMAX_DELAY                       ( TickType_t ) 0xffffffffUL
+#define portTICK_TYPE_IS_ATOMIC             1
+#define portPOINTER_SIZE_TYPE               uintptr_t
+#define portSTACK_GROWTH                    ( -1 )
+#define portTICK_PERIOD_MS                  ( ( TickType_t ) 1000 / configTICK_RATE_HZ )
+#define portBYTE_ALIGNMENT                  8
+#define portFORCE_INLINE                    inline __attribute__( ( always_inline ) )
+
+extern volatile int iSimYieldPending;
+extern uint32_t ulSimRunTime;
+
+#ifdef SIM_CONTEXTS
+    extern void vSimYield( void );
+    extern void vSimEnterCritical( void );
+    extern void vSimExitCritical( void );
+    extern void vSimDeleteContext( StackType_t * pxTopOfStack );
+    #define portYIELD()                     vSimYield()
+    #define portCLEAN_UP_TCB( pxTCB )       vSimDeleteContext( ( StackType_t * ) ( pxTCB )->pxTopOfStack )
+    #define portENTER_CRITICAL()            vSimEnterCritical()
+    #define portEXIT_CRITICAL()             vSimExitCritical()
+#else
+    #define portYIELD()                     ( iSimYieldPending = 1 )
+    #define portENTER_CRITICAL()            ( ( void ) 0 )
+    #define portEXIT_CRITICAL()             ( ( void ) 0 )
+#endif
+
+#define portYIELD_FROM_ISR()                portYIELD()
+#define portEND_SWITCHING_ISR( x )          do { if( ( x ) != pdFALSE ) { portYIELD(); } } while( 0 )
+#define portSET_INTERRUPT_MASK_FROM_ISR()   0
+#define portCLEAR_INTERRUPT_MASK_FROM_ISR( x )    ( void ) ( x )
+#define portDISABLE_INTERRUPTS()            ( ( void ) 0 )
+#define portENABLE_INTERRUPTS()             ( ( void ) 0 )
+
+#define portTASK_FUNCTION_PROTO( vFunction, pvParameters )    void vFunction( void * pvParameters )
+#define portTASK_FUNCTION( vFunction, pvParameters )          void vFunction( void * pvParameters )
+
+#define configASSERT( x )                   assert( x )
+
+/* the run time counter is advanced by the tests */
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()
+#define portGET_RUN_TIME_COUNTER_VALUE()    ulSimRunTime
+
+#if configUSE_PORT_OPTIMISED_TASK_SELECTION == 1
+    #define portRECORD_READY_PRIORITY( uxPriority, uxReadyPriorities )      ( uxReadyPriorities ) |= ( 1UL << ( uxPriority ) )
+    #define portRESET_READY_PRIORITY( uxPriority, uxReadyPriorities )       ( uxReadyPriorities ) &= ~( 1UL << ( uxPriority ) )
+    #define portGET_HIGHEST_PRIORITY( uxTopPriority, uxReadyPriorities )    uxTopPriority = ( 63UL - ( UBaseType_t ) __builtin_clzl( ( uxReadyPriorities ) ) )
+#endif
+
+#endif /* PORTMACRO_H */
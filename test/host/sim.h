@@ -0,0 +1,109 @@
+/*_____________________________________________________________________________
+ │                                                                            |
+ │ COPYRIGHT (C) 2026 Mihai Baneu                                             |
+ │                                                                            |
+ | Permission is hereby  granted,  free of charge,  to any person obtaining a |
+ | copy of this software and associated documentation files (the "Software"), |
+ | to deal in the Software without restriction,  including without limitation |
+ | the rights to  use, copy, modify, merge, publish, distribute,  sublicense, |
+ | and/or sell copies  of  the Software, and to permit  persons to  whom  the |
+ | Software is furnished to do so, subject to the following conditions:       |
+ |                                                                            |
+ | The above  copyright notice  and this permission notice  shall be included |
+ | in all copies or substantial portions of the Software.                     |
+ |                                                                            |
+ | THE SOFTWARE IS PROVIDED  "AS IS",  WITHOUT WARRANTY OF ANY KIND,  EXPRESS |
+ | OR   IMPLIED,   INCLUDING   BUT   NOT   LIMITED   TO   THE  WARRANTIES  OF |
+ | MERCHANTABILITY,  FITNESS FOR  A  PARTICULAR  PURPOSE AND NONINFRINGEMENT. |
+ | IN NO  EVENT SHALL  THE AUTHORS  OR  COPYRIGHT  HOLDERS  BE LIABLE FOR ANY |
+ | CLAIM, DAMAGES OR OTHER LIABILITY,  WHETHER IN AN ACTION OF CONTRACT, TORT |
+ | OR OTHERWISE, ARISING FROM,  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR  |
+ | THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                 |
+ |____________________________________________________________________________|
+ |                                                                            |
+ |  Author: Mihai Baneu                           Last modified: 17.Oct.2026  |
+ |                                                                            |
+ |___________________________________________________________________________*/
+
+/* Host simulation driven step by step, included after tasks.c. The test is the
+ * running task: it calls the kernel API, vSimSwitch() performs the context
+ * switch a yield requested and xSimTick() is the tick interrupt. */
+
+#ifndef SIM_H
+#define SIM_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+volatile int iSimYieldPending;
+uint32_t ulSimRunTime;
+static int iSimFailures;
+
+BaseType_t xPortStartScheduler( void )
+{
+    return pdFALSE;
+}
+
+void vPortEndScheduler( void )
+{
+}
+
+StackType_t * pxPortInitialiseStack( StackType_t * pxTopOfStack,
+                                     TaskFunction_t pxCode,
+                                     void * pvParameters )
+{
+    ( void ) pxCode;
+    ( void ) pvParameters;
+    return pxTopOfStack;
+}
+
+/* the tasks never run, the test acts for the one selected */
+void vTaskDummy( void * pvParameters )
+{
+    ( void ) pvParameters;
+}
+
+/* PendSV: perform a requested context switch */
+static void vSimSwitch( void )
+{
+    if( iSimYieldPending != 0 )
+    {
+        iSimYieldPending = 0;
+        vTaskSwitchContext();
+    }
+}
+
+/* SysTick */
+static BaseType_t xSimTick( void )
+{
+    BaseType_t xSwitchRequired = xTaskIncrementTick();
+
+    if( xSwitchRequired != pdFALSE )
+    {
+        iSimYieldPending = 1;
+    }
+
+    vSimSwitch();
+    return xSwitchRequired;
+}
+
+static double dSimNow( void )
+{
+    struct timespec xTime;
+
+    clock_gettime( CLOCK_MONOTONIC, &xTime );
+    return xTime.tv_sec * 1e9 + xTime.tv_nsec;
+}
+
+#define CHECK( c )                                                                                      \
+    do {                                                                                                \
+        if( !( c ) )                                                                                    \
+        {                                                                                               \
+            printf( "FAIL %s:%d: %s (tick %lu, running %s)\n", __FILE__, __LINE__, #c,                  \
+                    ( unsigned long ) xTickCount, pxCurrentTCB->pcTaskName );                           \
+            iSimFailures++;                                                                             \
+        }                                                                                               \
+    } while( 0 )
+
+#endif /* SIM_H */
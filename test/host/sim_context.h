@@ -0,0 +1,201 @@
+/*_____________________________________________________________________________
+ │                                                                            |
+ │ COPYRIGHT (C) 2026 Mihai Baneu                                             |
+ │                                                                            |
+ | Permission is hereby  granted,  free of charge,  to any person obtaining a |
+ | copy of this software and associated documentation files (the "Software"), |
+ | to deal in the Software without restriction,  including without limitation |
+ | the rights to  use, copy, modify, merge, publish, distribute,  sublicense, |
+ | and/or sell copies  of  the Software, and to permit  persons to  whom  the |
+ | Software is furnished to do so, subject to the following conditions:       |
+ |                                                                            |
+ | The above  copyright notice  and this permission notice  shall be included |
+ | in all copies or substantial portions of the Software.                     |
+ |                                                                            |
+ | THE SOFTWARE IS PROVIDED  "AS IS",  WITHOUT WARRANTY OF ANY KIND,  EXPRESS |
+ | OR   IMPLIED,   INCLUDING   BUT   NOT   LIMITED   TO   THE  WARRANTIES  OF |
+ | MERCHANTABILITY,  FITNESS FOR  A  PARTICULAR  PURPOSE AND NONINFRINGEMENT. |
+ | IN NO  EVENT SHALL  THE AUTHORS  OR  COPYRIGHT  HOLDERS  BE LIABLE FOR ANY |
+ | CLAIM, DAMAGES OR OTHER LIABILITY,  WHETHER IN AN ACTION OF CONTRACT, TORT |
+ | OR OTHERWISE, ARISING FROM,  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR  |
+ | THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                 |
+ |____________________________________________________________________________|
+ |                                                                            |
+ |  Author: Mihai Baneu                           Last modified: 17.Oct.2026  |
+ |                                                                            |
+ |___________________________________________________________________________*/
+
+/* Host simulation with real task contexts, included after tasks.c and built
+ * with SIM_CONTEXTS. Every task runs on its own ucontext, a yield switches at
+ * the end of the outermost critical section. The time the host spends in
+ * swapcontext() itself is accumulated in dSimSwapNs, so the benchmarks can
+ * report the kernel time without it. */
+
+#ifndef SIM_CONTEXT_H
+#define SIM_CONTEXT_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <ucontext.h>
+
+#define simSTACK_SIZE    ( 256 * 1024 )
+
+typedef struct SimTask
+{
+    ucontext_t xContext;
+    TaskFunction_t pxCode;
+    void * pvParameters;
+    struct SimTask * pxNextFree;
+} SimTask_t;
+
+volatile int iSimYieldPending;
+uint32_t ulSimRunTime;
+static int iSimFailures;
+static int iSimCritical;
+static ucontext_t xSimMain;
+static double dSimSwapNs;
+static unsigned long ulSimSwaps;
+static double dSimSwapStart;
+static double dSimInitNs;
+static SimTask_t * pxSimFreeTasks;
+
+static double dSimNow( void )
+{
+    struct timespec xTime;
+
+    clock_gettime( CLOCK_MONOTONIC, &xTime );
+    return xTime.tv_sec * 1e9 + xTime.tv_nsec;
+}
+
+static void vSimSwitch( void )
+{
+    TCB_t * pxPrevious = pxCurrentTCB;
+
+    iSimYieldPending = 0;
+    vTaskSwitchContext();
+
+    if( pxPrevious != pxCurrentTCB )
+    {
+        ulSimSwaps++;
+        dSimSwapStart = dSimNow();
+        swapcontext( &( ( SimTask_t * ) pxPrevious->pxTopOfStack )->xContext, &( ( SimTask_t * ) pxCurrentTCB->pxTopOfStack )->xContext );
+
+        /* back in this task, dSimSwapStart was set by the task that switched
+         * to it */
+        dSimSwapNs += dSimNow() - dSimSwapStart;
+    }
+}
+
+void vSimYield( void )
+{
+    iSimYieldPending = 1;
+
+    if( iSimCritical == 0 )
+    {
+        vSimSwitch();
+    }
+}
+
+void vSimEnterCritical( void )
+{
+    iSimCritical++;
+}
+
+void vSimExitCritical( void )
+{
+    if( ( --iSimCritical == 0 ) && ( iSimYieldPending != 0 ) )
+    {
+        vSimSwitch();
+    }
+}
+
+static void vSimTrampoline( void )
+{
+    SimTask_t * pxTask = ( SimTask_t * ) pxCurrentTCB->pxTopOfStack;
+
+    /* the first switch to the task, which does not return in vSimSwitch() */
+    dSimSwapNs += dSimNow() - dSimSwapStart;
+    pxTask->pxCode( pxTask->pvParameters );
+}
+
+/* The stack of the TCB is not used, the context lives in a SimTask_t. The
+ * contexts of deleted tasks are reused, and the time spent setting up a context
+ * on the host is accumulated in dSimInitNs. */
+StackType_t * pxPortInitialiseStack( StackType_t * pxTopOfStack,
+                                     TaskFunction_t pxCode,
+                                     void * pvParameters )
+{
+    double dStart = dSimNow();
+    SimTask_t * pxTask = pxSimFreeTasks;
+    void * pvStack;
+
+    ( void ) pxTopOfStack;
+
+    if( pxTask != NULL )
+    {
+        pxSimFreeTasks = pxTask->pxNextFree;
+        pvStack = pxTask->xContext.uc_stack.ss_sp;
+    }
+    else
+    {
+        pxTask = calloc( 1, sizeof( SimTask_t ) );
+        pvStack = malloc( simSTACK_SIZE );
+    }
+
+    getcontext( &pxTask->xContext );
+    pxTask->xContext.uc_stack.ss_sp = pvStack;
+    pxTask->xContext.uc_stack.ss_size = simSTACK_SIZE;
+    pxTask->xContext.uc_link = &xSimMain;
+    pxTask->pxCode = pxCode;
+    pxTask->pvParameters = pvParameters;
+    makecontext( &pxTask->xContext, vSimTrampoline, 0 );
+    dSimInitNs += dSimNow() - dStart;
+    return ( StackType_t * ) pxTask;
+}
+
+/* portCLEAN_UP_TCB(), the task is not running */
+void vSimDeleteContext( StackType_t * pxTopOfStack )
+{
+    SimTask_t * pxTask = ( SimTask_t * ) pxTopOfStack;
+
+    pxTask->pxNextFree = pxSimFreeTasks;
+    pxSimFreeTasks = pxTask;
+}
+
+BaseType_t xPortStartScheduler( void )
+{
+    dSimSwapStart = dSimNow();
+    swapcontext( &xSimMain, &( ( SimTask_t * ) pxCurrentTCB->pxTopOfStack )->xContext );
+    return pdFALSE;
+}
+
+void vPortEndScheduler( void )
+{
+    setcontext( &xSimMain );
+}
+
+/* a tick interrupt arriving at this point of the running task */
+static void vSimTick( void )
+{
+    vSimEnterCritical();
+
+    if( xTaskIncrementTick() != pdFALSE )
+    {
+        iSimYieldPending = 1;
+    }
+
+    vSimExitCritical();
+}
+
+#define CHECK( c )                                                                                      \
+    do {                                                                                                \
+        if( !( c ) )                                                                                    \
+        {                                                                                               \
+            printf( "FAIL %s:%d: %s (tick %lu, running %s)\n", __FILE__, __LINE__, #c,                  \
+                    ( unsigned long ) xTickCount, pxCurrentTCB->pcTaskName );                           \
+            iSimFailures++;                                                                             \
+        }                                                                                               \
+    } while( 0 )
+
+#endif /* SIM_CONTEXT_H */
@@ -0,0 +1,119 @@
+/*_____________________________________________________________________________
+ │                                                                            |
+ │ COPYRIGHT (C) 2026 Mihai Baneu                                             |
+ │                                                                            |
+ | Permission is hereby  granted,  free of charge,  to any person obtaining a |
+ | copy of this software and associated documentation files (the "Software"), |
+ | to deal in the Software without restriction,  including without limitation |
+ | the rights to  use, copy, modify, merge, publish, distribute,  sublicense, |
+ | and/or sell copies  of  the Software, and to permit  persons to  whom  the |
+ | Software is furnished to do so, subject to the following conditions:       |
+ |                                                                            |
+ | The above  copyright notice  and this permission notice  shall be included |
+ | in all copies or substantial portions of the Software.                     |
+ |                                                                            |
+ | THE SOFTWARE IS PROVIDED  "AS IS",  WITHOUT WARRANTY OF ANY KIND,  EXPRESS |
+ | OR   IMPLIED,   INCLUDING   BUT   NOT   LIMITED   TO   THE  WARRANTIES  OF |
+ | MERCHANTABILITY,  FITNESS FOR  A  PARTICULAR  PURPOSE AND NONINFRINGEMENT. |
+ | IN NO  EVENT SHALL  THE AUTHORS  OR  COPYRIGHT  HOLDERS  BE LIABLE FOR ANY |
+ | CLAIM, DAMAGES OR OTHER LIABILITY,  WHETHER IN AN ACTION OF CONTRACT, TORT |
+ | OR OTHERWISE, ARISING FROM,  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR  |
+ | THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                 |
+ |____________________________________________________________________________|
+ |                                                                            |
+ |  Author: Mihai Baneu                           Last modified: 17.Oct.2026  |
+ |                                                                            |
+ |___________________________________________________________________________*/
+
+/* Task creation latency by stack size, with the whole stack painted and with
+ * only configSTACK_PAINT_DEPTH words at its limit painted
+ * (configUSE_PARTIAL_STACK_PAINTING). The task is deleted again untimed. The
+ * best of five runs is reported, for xTaskCreate() and for
+ * xTaskCreateStatic(), which leaves the heap out. A new task has used none of
+ * its stack: its high water mark must be the whole stack, or with partial
+ * painting the painted band. */
+
+#include "tasks.c"
+#include "sim.h"
+
+#define BENCH_CREATES       100000L
+#define BENCH_RUNS          5
+#define BENCH_MAX_BYTES     16384
+
+static StaticTask_t xIdleTCB;
+static StackType_t uxIdleStack[ configMINIMAL_STACK_SIZE ];
+static StaticTask_t xTCB;
+static StackType_t uxStack[ BENCH_MAX_BYTES / sizeof( StackType_t ) ];
+
+void vApplicationGetIdleTaskMemory( StaticTask_t ** ppxIdleTaskTCBBuffer,
+                                    StackType_t ** ppxIdleTaskStackBuffer,
+                                    uint32_t * pulIdleTaskStackSize )
+{
+    *ppxIdleTaskTCBBuffer = &xIdleTCB;
+    *ppxIdleTaskStackBuffer = uxIdleStack;
+    *pulIdleTaskStackSize = configMINIMAL_STACK_SIZE;
+}
+
+static double dCreate( configSTACK_DEPTH_TYPE uxDepth,
+                       BaseType_t xStatic )
+{
+    TaskHandle_t xTask;
+    double dStart, dTotal, dBest = 1e18;
+    long i;
+    int iRun;
+
+    for( iRun = 0; iRun < BENCH_RUNS; iRun++ )
+    {
+        dTotal = 0;
+
+        for( i = 0; i < BENCH_CREATES; i++ )
+        {
+            dStart = dSimNow();
+
+            if( xStatic != pdFALSE )
+            {
+                xTask = xTaskCreateStatic( vTaskDummy, "T", uxDepth, NULL, 1, uxStack, &xTCB );
+            }
+            else
+            {
+                ( void ) xTaskCreate( vTaskDummy, "T", uxDepth, NULL, 1, &xTask );
+            }
+
+            dTotal += dSimNow() - dStart;
+
+            if( i == 0 )
+            {
+                #if ( configUSE_PARTIAL_STACK_PAINTING == 1 )
+                    CHECK( uxTaskGetStackHighWaterMark( xTask ) == configSTACK_PAINT_DEPTH );
+                #else
+                    CHECK( uxTaskGetStackHighWaterMark( xTask ) == uxDepth );
+                #endif
+            }
+
+            vTaskDelete( xTask );
+        }
+
+        if( dTotal < dBest )
+        {
+            dBest = dTotal;
+        }
+    }
+
+    return dBest / BENCH_CREATES;
+}
+
+int main( void )
+{
+    uint32_t ulBytes;
+
+    vTaskStartScheduler();
+    printf( "%s painting\n", configUSE_PARTIAL_STACK_PAINTING ? "partial" : "full" );
+
+    for( ulBytes = 1024; ulBytes <= BENCH_MAX_BYTES; ulBytes *= 2 )
+    {
+        printf( "%2lu KB stack: xTaskCreate() %6.0f ns, xTaskCreateStatic() %6.0f ns\n", ( unsigned long ) ulBytes / 1024,
+                dCreate( ulBytes / sizeof( StackType_t ), pdFALSE ), dCreate( ulBytes / sizeof( StackType_t ), pdTRUE ) );
+    }
+
+    return iSimFailures != 0;
+}
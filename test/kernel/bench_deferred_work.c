@@ -0,0 +1,126 @@
+/*_____________________________________________________________________________
+ │                                                                            |
+ │ COPYRIGHT (C) 2026 Mihai Baneu                                             |
+ │                                                                            |
+ | Permission is hereby  granted,  free of charge,  to any person obtaining a |
+ | copy of this software and associated documentation files (the "Software"), |
+ | to deal in the Software without restriction,  including without limitation |
+ | the rights to  use, copy, modify, merge, publish, distribute,  sublicense, |
+ | and/or sell copies  of  the Software, and to permit  persons to  whom  the |
+ | Software is furnished to do so, subject to the following conditions:       |
+ |                                                                            |
+ | The above  copyright notice  and this permission notice  shall be included |
+ | in all copies or substantial portions of the Software.                     |
+ |                                                                            |
+ | THE SOFTWARE IS PROVIDED  "AS IS",  WITHOUT WARRANTY OF ANY KIND,  EXPRESS |
+ | OR   IMPLIED,   INCLUDING   BUT   NOT   LIMITED   TO   THE  WARRANTIES  OF |
+ | MERCHANTABILITY,  FITNESS FOR  A  PARTICULAR  PURPOSE AND NONINFRINGEMENT. |
+ | IN NO  EVENT SHALL  THE AUTHORS  OR  COPYRIGHT  HOLDERS  BE LIABLE FOR ANY |
+ | CLAIM, DAMAGES OR OTHER LIABILITY,  WHETHER IN AN ACTION OF CONTRACT, TORT |
+ | OR OTHERWISE, ARISING FROM,  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR  |
+ | THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                 |
+ |____________________________________________________________________________|
+ |                                                                            |
+ |  Author: Mihai Baneu                           Last modified: 17.Oct.2026  |
+ |                                                                            |
+ |___________________________________________________________________________*/
+
+/* Latency from an interrupt handing work to a task until the work runs:
+ * xDeferredWorkPostFromISR() against xTimerPendFunctionCallFromISR(). The
+ * interrupt is simulated by a low priority task calling the FromISR function
+ * and then yielding, the worker and the timer task run at the top priority.
+ * Reported per post: the time spent in the interrupt, the time until the
+ * function runs without the host context switch, and for a burst of 8 posts
+ * the time until the last function ran. */
+
+#include "tasks.c"
+#include "timers.h"
+#include "deferred_work.h"
+#include "sim_context.h"
+
+#define BENCH_ROUNDS    200000L
+#define BENCH_BURST     8
+
+static volatile double dHandlerAt, dHandlerSwapNs;
+static volatile uint32_t ulHandled;
+
+static void vHandler( void * pvParameter1,
+                      uint32_t ulParameter2 )
+{
+    ( void ) pvParameter1;
+    ( void ) ulParameter2;
+    dHandlerAt = dSimNow();
+    dHandlerSwapNs = dSimSwapNs;
+    ulHandled++;
+}
+
+static BaseType_t xPost( int iTimer,
+                         BaseType_t * pxHigherPriorityTaskWoken )
+{
+    if( iTimer != 0 )
+    {
+        return xTimerPendFunctionCallFromISR( vHandler, NULL, 0, pxHigherPriorityTaskWoken );
+    }
+
+    return xDeferredWorkPostFromISR( 0, vHandler, NULL, 0, pxHigherPriorityTaskWoken );
+}
+
+static void vMeasure( int iTimer )
+{
+    double dIsr = 0, dLatency = 0, dBurst = 0;
+    unsigned long ulSwaps = 0;
+    long i;
+    int b;
+
+    for( i = 0; i < BENCH_ROUNDS; i++ )
+    {
+        BaseType_t xWoken = pdFALSE;
+        double dStart, dPosted, dSwapStart;
+        unsigned long ulSwapsStart = ulSimSwaps;
+
+        /* a single post */
+        dSwapStart = dSimSwapNs;
+        dStart = dSimNow();
+        CHECK( xPost( iTimer, &xWoken ) == pdPASS );
+        dPosted = dSimNow();
+        portEND_SWITCHING_ISR( xWoken );
+        dIsr += dPosted - dStart;
+        dLatency += ( dHandlerAt - dStart ) - ( dHandlerSwapNs - dSwapStart );
+        ulSwaps += ulSimSwaps - ulSwapsStart;
+
+        /* a burst from the same interrupt */
+        xWoken = pdFALSE;
+        dSwapStart = dSimSwapNs;
+        dStart = dSimNow();
+
+        for( b = 0; b < BENCH_BURST; b++ )
+        {
+            CHECK( xPost( iTimer, &xWoken ) == pdPASS );
+        }
+
+        portEND_SWITCHING_ISR( xWoken );
+        dBurst += ( dHandlerAt - dStart ) - ( dHandlerSwapNs - dSwapStart );
+    }
+
+    CHECK( ulHandled == ( uint32_t ) ( BENCH_ROUNDS * ( BENCH_BURST + 1 ) ) );
+    printf( "%-32s %6.0f ns in the interrupt  %6.0f ns to the function  %6.0f ns to the last of %d  (%.1f switches)\n",
+            iTimer ? "xTimerPendFunctionCallFromISR" : "xDeferredWorkPostFromISR",
+            dIsr / BENCH_ROUNDS, dLatency / BENCH_ROUNDS, dBurst / BENCH_ROUNDS, BENCH_BURST, ( double ) ulSwaps / BENCH_ROUNDS );
+    ulHandled = 0;
+}
+
+static void vInterrupt( void * pvParameters )
+{
+    ( void ) pvParameters;
+
+    vMeasure( 0 );
+    vMeasure( 1 );
+    exit( iSimFailures != 0 );
+}
+
+int main( void )
+{
+    xTaskCreate( vInterrupt, "ISR", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY + 1, NULL );
+    vTaskStartScheduler();
+    return 1;
+}
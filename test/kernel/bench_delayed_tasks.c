@@ -0,0 +1,136 @@
+/*_____________________________________________________________________________
+ │                                                                            |
+ │ COPYRIGHT (C) 2026 Mihai Baneu                                             |
+ │                                                                            |
+ | Permission is hereby  granted,  free of charge,  to any person obtaining a |
+ | copy of this software and associated documentation files (the "Software"), |
+ | to deal in the Software without restriction,  including without limitation |
+ | the rights to  use, copy, modify, merge, publish, distribute,  sublicense, |
+ | and/or sell copies  of  the Software, and to permit  persons to  whom  the |
+ | Software is furnished to do so, subject to the following conditions:       |
+ |                                                                            |
+ | The above  copyright notice  and this permission notice  shall be included |
+ | in all copies or substantial portions of the Software.                     |
+ |                                                                            |
+ | THE SOFTWARE IS PROVIDED  "AS IS",  WITHOUT WARRANTY OF ANY KIND,  EXPRESS |
+ | OR   IMPLIED,   INCLUDING   BUT   NOT   LIMITED   TO   THE  WARRANTIES  OF |
+ | MERCHANTABILITY,  FITNESS FOR  A  PARTICULAR  PURPOSE AND NONINFRINGEMENT. |
+ | IN NO  EVENT SHALL  THE AUTHORS  OR  COPYRIGHT  HOLDERS  BE LIABLE FOR ANY |
+ | CLAIM, DAMAGES OR OTHER LIABILITY,  WHETHER IN AN ACTION OF CONTRACT, TORT |
+ | OR OTHERWISE, ARISING FROM,  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR  |
+ | THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                 |
+ |____________________________________________________________________________|
+ |                                                                            |
+ |  Author: Mihai Baneu                           Last modified: 17.Oct.2026  |
+ |                                                                            |
+ |___________________________________________________________________________*/
+
+/* Cost of blocking and of the tick with many blocked tasks: the sorted
+ * delayed list against the timing wheel (configUSE_DELAYED_TASK_WHEEL). N
+ * tasks block for random times, most within the first wheel level, the others
+ * within the second, or in a second run 10% beyond the wheel. Every task must wake exactly at its
+ * wake time. Reported are the time of a vTaskDelay() with the switch to the
+ * next task, and the time of a tick with the wakeups it does. */
+
+#include "tasks.c"
+#include "sim.h"
+
+#define BENCH_DELAYS    400000L
+#define BENCH_MAX_TASKS 1000
+
+static TaskHandle_t xTasks[ BENCH_MAX_TASKS ];
+static TickType_t xWakeTime[ BENCH_MAX_TASKS ];
+static uint32_t ulSeed = 1;
+
+static uint32_t ulRandom( uint32_t ulMax )
+{
+    ulSeed = ulSeed * 1103515245UL + 12345UL;
+    return ( ( ulSeed >> 8 ) % ulMax ) + 1U;
+}
+
+/* 60% within the first wheel level, the rest within the second or, for the
+ * given percentage, up to 5000 ticks */
+static TickType_t xRandomDelay( uint32_t ulBeyond )
+{
+    uint32_t ulKind = ulRandom( 100 );
+
+    if( ulKind <= 60 )
+    {
+        return ulRandom( 31 );
+    }
+    else if( ulKind <= 100 - ulBeyond )
+    {
+        return ulRandom( 1000 );
+    }
+
+    return ulRandom( 5000 );
+}
+
+static void vMeasure( int iTasks,
+                      uint32_t ulBeyond,
+                      TaskHandle_t xLow )
+{
+    double dDelay = 0, dTick = 0, dStart;
+    unsigned long ulTicks = 0;
+    long lDelays = 0;
+    int i;
+
+    for( i = 0; i < iTasks; i++ )
+    {
+        xTaskCreate( vTaskDummy, "T", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY + 2, &xTasks[ i ] );
+        vTaskSetTaskNumber( xTasks[ i ], ( UBaseType_t ) i );
+        xWakeTime[ i ] = 0;
+    }
+
+    iSimYieldPending = 1;
+    vSimSwitch();
+
+    while( lDelays < BENCH_DELAYS )
+    {
+        /* every task that runs blocks again */
+        while( pxCurrentTCB != ( TCB_t * ) xLow )
+        {
+            TickType_t xDelay = xRandomDelay( ulBeyond );
+
+            CHECK( ( xWakeTime[ pxCurrentTCB->uxTaskNumber ] == 0 ) || ( xWakeTime[ pxCurrentTCB->uxTaskNumber ] == xTickCount ) );
+            xWakeTime[ pxCurrentTCB->uxTaskNumber ] = xTickCount + xDelay;
+
+            dStart = dSimNow();
+            vTaskDelay( xDelay );
+            vSimSwitch();
+            dDelay += dSimNow() - dStart;
+            lDelays++;
+        }
+
+        dStart = dSimNow();
+        xSimTick();
+        dTick += dSimNow() - dStart;
+        ulTicks++;
+    }
+
+    printf( "%s %4d tasks, %2lu%% beyond 1000 ticks: %6.1f ns per vTaskDelay()  %6.1f ns per tick\n",
+            configUSE_DELAYED_TASK_WHEEL ? "wheel" : "list ", iTasks, ( unsigned long ) ulBeyond, dDelay / lDelays, dTick / ulTicks );
+
+    for( i = 0; i < iTasks; i++ )
+    {
+        vTaskDelete( xTasks[ i ] );
+    }
+}
+
+int main( void )
+{
+    TaskHandle_t xLow;
+
+    xTaskCreate( vTaskDummy, "L", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY + 1, &xLow );
+    vTaskStartScheduler();
+    vSimSwitch();
+
+    vMeasure( 10, 0, xLow );
+    vMeasure( 100, 0, xLow );
+    vMeasure( 1000, 0, xLow );
+    vMeasure( 10, 10, xLow );
+    vMeasure( 100, 10, xLow );
+    vMeasure( 1000, 10, xLow );
+
+    return iSimFailures != 0;
+}
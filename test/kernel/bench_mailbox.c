@@ -0,0 +1,127 @@
+/*_____________________________________________________________________________
+ │                                                                            |
+ │ COPYRIGHT (C) 2026 Mihai Baneu                                             |
+ │                                                                            |
+ | Permission is hereby  granted,  free of charge,  to any person obtaining a |
+ | copy of this software and associated documentation files (the "Software"), |
+ | to deal in the Software without restriction,  including without limitation |
+ | the rights to  use, copy, modify, merge, publish, distribute,  sublicense, |
+ | and/or sell copies  of  the Software, and to permit  persons to  whom  the |
+ | Software is furnished to do so, subject to the following conditions:       |
+ |                                                                            |
+ | The above  copyright notice  and this permission notice  shall be included |
+ | in all copies or substantial portions of the Software.                     |
+ |                                                                            |
+ | THE SOFTWARE IS PROVIDED  "AS IS",  WITHOUT WARRANTY OF ANY KIND,  EXPRESS |
+ | OR   IMPLIED,   INCLUDING   BUT   NOT   LIMITED   TO   THE  WARRANTIES  OF |
+ | MERCHANTABILITY,  FITNESS FOR  A  PARTICULAR  PURPOSE AND NONINFRINGEMENT. |
+ | IN NO  EVENT SHALL  THE AUTHORS  OR  COPYRIGHT  HOLDERS  BE LIABLE FOR ANY |
+ | CLAIM, DAMAGES OR OTHER LIABILITY,  WHETHER IN AN ACTION OF CONTRACT, TORT |
+ | OR OTHERWISE, ARISING FROM,  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR  |
+ | THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                 |
+ |____________________________________________________________________________|
+ |                                                                            |
+ |  Author: Mihai Baneu                           Last modified: 17.Oct.2026  |
+ |                                                                            |
+ |___________________________________________________________________________*/
+
+/* Request/response round trips of a 16 byte message between two tasks,
+ * through the task mailboxes against through two length 1 queues. The client
+ * at priority 2 sends a request to a server at priority 3, which increments
+ * the first byte and sends it back. Reported per round trip, with and without
+ * the host context switches. */
+
+#include "tasks.c"
+#include "queue.h"
+#include "sim_context.h"
+
+#define BENCH_ROUNDS        500000L
+#define BENCH_PRIORITY      2
+#define BENCH_MESSAGE_SIZE  16
+
+static TaskHandle_t xMailboxServer, xClient;
+static QueueHandle_t xRequests, xResponses;
+
+static void vMailboxServer( void * pvParameters )
+{
+    uint8_t ucMessage[ BENCH_MESSAGE_SIZE ];
+
+    ( void ) pvParameters;
+
+    for( ; ; )
+    {
+        CHECK( xTaskMailboxReceive( ucMessage, portMAX_DELAY ) == BENCH_MESSAGE_SIZE );
+        ucMessage[ 0 ]++;
+        CHECK( xTaskMailboxSend( xClient, ucMessage, BENCH_MESSAGE_SIZE ) == pdPASS );
+    }
+}
+
+static void vQueueServer( void * pvParameters )
+{
+    uint8_t ucMessage[ BENCH_MESSAGE_SIZE ];
+
+    ( void ) pvParameters;
+
+    for( ; ; )
+    {
+        CHECK( xQueueReceive( xRequests, ucMessage, portMAX_DELAY ) == pdPASS );
+        ucMessage[ 0 ]++;
+        CHECK( xQueueSend( xResponses, ucMessage, portMAX_DELAY ) == pdPASS );
+    }
+}
+
+static void vBench( BaseType_t xMailbox )
+{
+    uint8_t ucMessage[ BENCH_MESSAGE_SIZE ] = { 0 };
+    double dStart, dSwapStart;
+    unsigned long ulSwapsStart;
+    uint8_t ucExpected = 0;
+    long i;
+
+    dSwapStart = dSimSwapNs;
+    ulSwapsStart = ulSimSwaps;
+    dStart = dSimNow();
+
+    for( i = 0; i < BENCH_ROUNDS; i++ )
+    {
+        if( xMailbox != pdFALSE )
+        {
+            CHECK( xTaskMailboxSend( xMailboxServer, ucMessage, BENCH_MESSAGE_SIZE ) == pdPASS );
+            CHECK( xTaskMailboxReceive( ucMessage, portMAX_DELAY ) == BENCH_MESSAGE_SIZE );
+        }
+        else
+        {
+            CHECK( xQueueSend( xRequests, ucMessage, portMAX_DELAY ) == pdPASS );
+            CHECK( xQueueReceive( xResponses, ucMessage, portMAX_DELAY ) == pdPASS );
+        }
+
+        ucExpected++;
+        CHECK( ucMessage[ 0 ] == ucExpected );
+    }
+
+    printf( "%-15s %5.0f ns per round trip, %5.0f ns without the %.1f host context switches\n",
+            xMailbox ? "task mailboxes" : "length 1 queues",
+            ( dSimNow() - dStart ) / BENCH_ROUNDS,
+            ( ( dSimNow() - dStart ) - ( dSimSwapNs - dSwapStart ) ) / BENCH_ROUNDS,
+            ( double ) ( ulSimSwaps - ulSwapsStart ) / BENCH_ROUNDS );
+}
+
+static void vClient( void * pvParameters )
+{
+    ( void ) pvParameters;
+
+    vBench( pdTRUE );
+    vBench( pdFALSE );
+    exit( iSimFailures != 0 );
+}
+
+int main( void )
+{
+    xRequests = xQueueCreate( 1, BENCH_MESSAGE_SIZE );
+    xResponses = xQueueCreate( 1, BENCH_MESSAGE_SIZE );
+    xTaskCreate( vMailboxServer, "MboxSrv", configMINIMAL_STACK_SIZE, NULL, BENCH_PRIORITY + 1, &xMailboxServer );
+    xTaskCreate( vQueueServer, "QueueSrv", configMINIMAL_STACK_SIZE, NULL, BENCH_PRIORITY + 1, NULL );
+    xTaskCreate( vClient, "Client", configMINIMAL_STACK_SIZE, NULL, BENCH_PRIORITY, &xClient );
+    vTaskStartScheduler();
+    return 1;
+}
@@ -0,0 +1,133 @@
+/*_____________________________________________________________________________
+ │                                                                            |
+ │ COPYRIGHT (C) 2026 Mihai Baneu                                             |
+ │                                                                            |
+ | Permission is hereby  granted,  free of charge,  to any person obtaining a |
+ | copy of this software and associated documentation files (the "Software"), |
+ | to deal in the Software without restriction,  including without limitation |
+ | the rights to  use, copy, modify, merge, publish, distribute,  sublicense, |
+ | and/or sell copies  of  the Software, and to permit  persons to  whom  the |
+ | Software is furnished to do so, subject to the following conditions:       |
+ |                                                                            |
+ | The above  copyright notice  and this permission notice  shall be included |
+ | in all copies or substantial portions of the Software.                     |
+ |                                                                            |
+ | THE SOFTWARE IS PROVIDED  "AS IS",  WITHOUT WARRANTY OF ANY KIND,  EXPRESS |
+ | OR   IMPLIED,   INCLUDING   BUT   NOT   LIMITED   TO   THE  WARRANTIES  OF |
+ | MERCHANTABILITY,  FITNESS FOR  A  PARTICULAR  PURPOSE AND NONINFRINGEMENT. |
+ | IN NO  EVENT SHALL  THE AUTHORS  OR  COPYRIGHT  HOLDERS  BE LIABLE FOR ANY |
+ | CLAIM, DAMAGES OR OTHER LIABILITY,  WHETHER IN AN ACTION OF CONTRACT, TORT |
+ | OR OTHERWISE, ARISING FROM,  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR  |
+ | THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                 |
+ |____________________________________________________________________________|
+ |                                                                            |
+ |  Author: Mihai Baneu                           Last modified: 17.Oct.2026  |
+ |                                                                            |
+ |___________________________________________________________________________*/
+
+/* Cost of selecting the next task with many priorities: the generic linear
+ * scan against the port optimised selection, which above 32 priorities uses
+ * the two level bitmap. A task at the highest priority blocks for a tick with
+ * only a task at priority 1 ready, so the generic scan walks every priority in
+ * between. Before that, tasks at random priorities are suspended and resumed
+ * at random, and after each change the task selected must be one of the
+ * highest ready priority. */
+
+#include "tasks.c"
+#include "sim.h"
+
+#define BENCH_SWITCHES      2000000L
+#define BENCH_CHANGES       200000L
+#define BENCH_TASKS         64
+
+static uint32_t ulSeed = 1;
+
+static uint32_t ulRandom( uint32_t ulMax )
+{
+    ulSeed = ulSeed * 1103515245UL + 12345UL;
+    return ( ( ulSeed >> 8 ) % ulMax ) + 1U;
+}
+
+static UBaseType_t uxHighestReadyPriority( void )
+{
+    UBaseType_t uxPriority = configMAX_PRIORITIES - 1;
+
+    while( listLIST_IS_EMPTY( &( pxReadyTasksLists[ uxPriority ] ) ) != pdFALSE )
+    {
+        uxPriority--;
+    }
+
+    return uxPriority;
+}
+
+int main( void )
+{
+    static TaskHandle_t xTasks[ BENCH_TASKS ];
+    static BaseType_t xSuspended[ BENCH_TASKS ];
+    TaskHandle_t xHigh, xLow;
+    double dStart, dSwitch = 0;
+    long i;
+    uint32_t x;
+
+    xTaskCreate( vTaskDummy, "H", configMINIMAL_STACK_SIZE, NULL, configMAX_PRIORITIES - 1, &xHigh );
+    xTaskCreate( vTaskDummy, "L", configMINIMAL_STACK_SIZE, NULL, 1, &xLow );
+
+    for( x = 0; x < BENCH_TASKS; x++ )
+    {
+        xTaskCreate( vTaskDummy, "R", configMINIMAL_STACK_SIZE, NULL, ulRandom( configMAX_PRIORITIES - 1 ) - 1, &xTasks[ x ] );
+    }
+
+    vTaskStartScheduler();
+    vTaskSuspend( xHigh );
+    vSimSwitch();
+
+    for( i = 0; i < BENCH_CHANGES; i++ )
+    {
+        x = ulRandom( BENCH_TASKS ) - 1;
+
+        if( xSuspended[ x ] != pdFALSE )
+        {
+            vTaskResume( xTasks[ x ] );
+        }
+        else
+        {
+            vTaskSuspend( xTasks[ x ] );
+        }
+
+        xSuspended[ x ] = !xSuspended[ x ];
+        iSimYieldPending = 1;
+        vSimSwitch();
+        CHECK( pxCurrentTCB->uxPriority == uxHighestReadyPriority() );
+    }
+
+    for( x = 0; x < BENCH_TASKS; x++ )
+    {
+        if( xSuspended[ x ] == pdFALSE )
+        {
+            vTaskSuspend( xTasks[ x ] );
+        }
+    }
+
+    vTaskResume( xHigh );
+    iSimYieldPending = 1;
+    vSimSwitch();
+    CHECK( pxCurrentTCB == ( TCB_t * ) xHigh );
+
+    for( i = 0; i < BENCH_SWITCHES; i++ )
+    {
+        vTaskDelay( 1 );
+
+        /* the high task is blocked, select the low one */
+        dStart = dSimNow();
+        vSimSwitch();
+        dSwitch += dSimNow() - dStart;
+        CHECK( pxCurrentTCB == ( TCB_t * ) xLow );
+
+        /* the high task is ready again */
+        xSimTick();
+    }
+
+    printf( "%4d priorities, %s selection: %5.1f ns per switch to the low task\n", configMAX_PRIORITIES,
+            configUSE_PORT_OPTIMISED_TASK_SELECTION ? "port optimised" : "generic", dSwitch / BENCH_SWITCHES );
+    return iSimFailures != 0;
+}
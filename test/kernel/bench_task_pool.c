@@ -0,0 +1,119 @@
+/*_____________________________________________________________________________
+ │                                                                            |
+ │ COPYRIGHT (C) 2026 Mihai Baneu                                             |
+ │                                                                            |
+ | Permission is hereby  granted,  free of charge,  to any person obtaining a |
+ | copy of this software and associated documentation files (the "Software"), |
+ | to deal in the Software without restriction,  including without limitation |
+ | the rights to  use, copy, modify, merge, publish, distribute,  sublicense, |
+ | and/or sell copies  of  the Software, and to permit  persons to  whom  the |
+ | Software is furnished to do so, subject to the following conditions:       |
+ |                                                                            |
+ | The above  copyright notice  and this permission notice  shall be included |
+ | in all copies or substantial portions of the Software.                     |
+ |                                                                            |
+ | THE SOFTWARE IS PROVIDED  "AS IS",  WITHOUT WARRANTY OF ANY KIND,  EXPRESS |
+ | OR   IMPLIED,   INCLUDING   BUT   NOT   LIMITED   TO   THE  WARRANTIES  OF |
+ | MERCHANTABILITY,  FITNESS FOR  A  PARTICULAR  PURPOSE AND NONINFRINGEMENT. |
+ | IN NO  EVENT SHALL  THE AUTHORS  OR  COPYRIGHT  HOLDERS  BE LIABLE FOR ANY |
+ | CLAIM, DAMAGES OR OTHER LIABILITY,  WHETHER IN AN ACTION OF CONTRACT, TORT |
+ | OR OTHERWISE, ARISING FROM,  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR  |
+ | THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                 |
+ |____________________________________________________________________________|
+ |                                                                            |
+ |  Author: Mihai Baneu                           Last modified: 17.Oct.2026  |
+ |                                                                            |
+ |___________________________________________________________________________*/
+
+/* Spawning short lived work in a pooled task against creating and deleting a
+ * task for it. A task spawns a function at a higher priority, which records
+ * when it starts and returns, or deletes its task. Reported per spawn, without
+ * the host context switches and the host set up of a task context: the time
+ * until the function runs, the time until the spawning task runs again, and the
+ * time the spawning task then takes to block for a tick while the idle task
+ * runs, which for the created tasks includes freeing them. */
+
+#include "tasks.c"
+#include "task_pool.h"
+#include "sim_context.h"
+
+#define BENCH_ROUNDS        200000L
+#define BENCH_PRIORITY      2
+
+static volatile double dRunAt, dRunSwapNs;
+static volatile uint32_t ulRuns;
+
+static void vJob( void * pvParameters )
+{
+    ( void ) pvParameters;
+    dRunAt = dSimNow();
+    dRunSwapNs = dSimSwapNs;
+    ulRuns++;
+}
+
+static void vCreatedJob( void * pvParameters )
+{
+    vJob( pvParameters );
+    vTaskDelete( NULL );
+}
+
+void vApplicationIdleHook( void )
+{
+    vSimTick();
+}
+
+static void vBench( BaseType_t xPool )
+{
+    double dStart, dSwapStart, dInitStart, dToRun = 0, dToReturn = 0, dIdle = 0;
+    UBaseType_t uxTasks = uxCurrentNumberOfTasks;
+    long i;
+
+    ulRuns = 0;
+
+    for( i = 0; i < BENCH_ROUNDS; i++ )
+    {
+        dSwapStart = dSimSwapNs;
+        dInitStart = dSimInitNs;
+        dStart = dSimNow();
+
+        if( xPool != pdFALSE )
+        {
+            CHECK( xTaskPoolSpawn( vJob, NULL, BENCH_PRIORITY + 1, NULL ) == pdPASS );
+        }
+        else
+        {
+            CHECK( xTaskCreate( vCreatedJob, "Job", configTASK_POOL_STACK_DEPTH, NULL, BENCH_PRIORITY + 1, NULL ) == pdPASS );
+        }
+
+        dToReturn += ( dSimNow() - dStart ) - ( dSimSwapNs - dSwapStart ) - ( dSimInitNs - dInitStart );
+        dToRun += ( dRunAt - dStart ) - ( dRunSwapNs - dSwapStart ) - ( dSimInitNs - dInitStart );
+
+        dSwapStart = dSimSwapNs;
+        dStart = dSimNow();
+        vTaskDelay( 1 );
+        dIdle += ( dSimNow() - dStart ) - ( dSimSwapNs - dSwapStart );
+    }
+
+    CHECK( ulRuns == BENCH_ROUNDS );
+    CHECK( uxCurrentNumberOfTasks == uxTasks );
+    CHECK( uxTaskPoolGetFreeTaskCount() == configTASK_POOL_SIZE );
+
+    printf( "%-14s %5.0f ns to run, %5.0f ns to return, %5.0f ns blocking for a tick\n", xPool ? "xTaskPoolSpawn" : "xTaskCreate",
+            dToRun / BENCH_ROUNDS, dToReturn / BENCH_ROUNDS, dIdle / BENCH_ROUNDS );
+}
+
+static void vSpawner( void * pvParameters )
+{
+    ( void ) pvParameters;
+
+    vBench( pdTRUE );
+    vBench( pdFALSE );
+    exit( iSimFailures != 0 );
+}
+
+int main( void )
+{
+    xTaskCreate( vSpawner, "Spawn", configMINIMAL_STACK_SIZE, NULL, BENCH_PRIORITY, NULL );
+    vTaskStartScheduler();
+    return 1;
+}
@@ -0,0 +1,177 @@
+/*_____________________________________________________________________________
+ │                                                                            |
+ │ COPYRIGHT (C) 2026 Mihai Baneu                                             |
+ │                                                                            |
+ | Permission is hereby  granted,  free of charge,  to any person obtaining a |
+ | copy of this software and associated documentation files (the "Software"), |
+ | to deal in the Software without restriction,  including without limitation |
+ | the rights to  use, copy, modify, merge, publish, distribute,  sublicense, |
+ | and/or sell copies  of  the Software, and to permit  persons to  whom  the |
+ | Software is furnished to do so, subject to the following conditions:       |
+ |                                                                            |
+ | The above  copyright notice  and this permission notice  shall be included |
+ | in all copies or substantial portions of the Software.                     |
+ |                                                                            |
+ | THE SOFTWARE IS PROVIDED  "AS IS",  WITHOUT WARRANTY OF ANY KIND,  EXPRESS |
+ | OR   IMPLIED,   INCLUDING   BUT   NOT   LIMITED   TO   THE  WARRANTIES  OF |
+ | MERCHANTABILITY,  FITNESS FOR  A  PARTICULAR  PURPOSE AND NONINFRINGEMENT. |
+ | IN NO  EVENT SHALL  THE AUTHORS  OR  COPYRIGHT  HOLDERS  BE LIABLE FOR ANY |
+ | CLAIM, DAMAGES OR OTHER LIABILITY,  WHETHER IN AN ACTION OF CONTRACT, TORT |
+ | OR OTHERWISE, ARISING FROM,  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR  |
+ | THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                 |
+ |____________________________________________________________________________|
+ |                                                                            |
+ |  Author: Mihai Baneu                           Last modified: 17.Oct.2026  |
+ |                                                                            |
+ |___________________________________________________________________________*/
+
+/* Lateness of the tick context timers against the timer task timers. Both
+ * timers reload every 7 ticks. A task at the timer task priority either keeps
+ * the CPU for a few ticks, suspends the scheduler for a few ticks or blocks,
+ * the idle task ticks while every task is blocked. Each callback records how
+ * many ticks after its expiry it ran and whether it ran in the tick
+ * interrupt. The tick context callbacks must be on time unless the scheduler
+ * was suspended, and then not later than the suspension. */
+
+#include "tasks.c"
+#include "timers.h"
+#include "sim_context.h"
+
+#define BENCH_TICKS         200000UL
+#define BENCH_PERIOD        7
+#define BENCH_MAX_HOLD      5
+
+typedef struct
+{
+    unsigned long ulCalls;
+    unsigned long ulFromTask;
+    unsigned long ulLateTicks;
+    unsigned long ulMaxLate;
+} Lateness_t;
+
+static unsigned long ulRealTicks;
+static int iInTick;
+static Lateness_t xTickContext, xDaemon;
+static uint32_t ulSeed = 1;
+
+static uint32_t ulRandom( uint32_t ulMax )
+{
+    ulSeed = ulSeed * 1103515245UL + 12345UL;
+    return ( ( ulSeed >> 8 ) % ulMax ) + 1U;
+}
+
+/* the tick interrupt, also counting the ticks pended while suspended */
+static void vTick( void )
+{
+    vSimEnterCritical();
+    ulRealTicks++;
+    iInTick = 1;
+
+    if( xTaskIncrementTick() != pdFALSE )
+    {
+        iSimYieldPending = 1;
+    }
+
+    iInTick = 0;
+    vSimExitCritical();
+}
+
+static void vRecord( Lateness_t * pxLateness,
+                     TimerHandle_t xTimer )
+{
+    /* the timer is already reloaded with its next expiry */
+    unsigned long ulLate = ulRealTicks - ( unsigned long ) ( xTimerGetExpiryTime( xTimer ) - xTimerGetPeriod( xTimer ) );
+
+    pxLateness->ulCalls++;
+    pxLateness->ulFromTask += ( iInTick == 0 );
+    pxLateness->ulLateTicks += ulLate;
+
+    if( ulLate > pxLateness->ulMaxLate )
+    {
+        pxLateness->ulMaxLate = ulLate;
+    }
+}
+
+static void vTickContextCallback( TimerHandle_t xTimer )
+{
+    vRecord( &xTickContext, xTimer );
+
+    /* the callback always sees its expiry tick */
+    CHECK( xTimerGetExpiryTime( xTimer ) - xTimerGetPeriod( xTimer ) == xTaskGetTickCount() );
+
+    /* only the calls from xTaskResumeAll() can be late */
+    CHECK( ( iInTick == 0 ) || ( ulRealTicks == xTaskGetTickCount() ) );
+}
+
+static void vDaemonCallback( TimerHandle_t xTimer )
+{
+    vRecord( &xDaemon, xTimer );
+}
+
+static void vReport( const char * pcName,
+                     const Lateness_t * pxLateness )
+{
+    printf( "%-13s %6lu calls  %5.1f%% from a task  %5.2f ticks late on average  %2lu at most\n",
+            pcName, pxLateness->ulCalls, 100.0 * pxLateness->ulFromTask / pxLateness->ulCalls,
+            ( double ) pxLateness->ulLateTicks / pxLateness->ulCalls, pxLateness->ulMaxLate );
+}
+
+void vApplicationIdleHook( void )
+{
+    vTick();
+}
+
+static void vWorkload( void * pvParameters )
+{
+    uint32_t i, ulHold;
+
+    ( void ) pvParameters;
+
+    while( ulRealTicks < BENCH_TICKS )
+    {
+        uint32_t ulKind = ulRandom( 100 );
+
+        ulHold = ulRandom( BENCH_MAX_HOLD );
+
+        if( ulKind <= 20 )
+        {
+            vTaskSuspendAll();
+
+            for( i = 0; i < ulHold; i++ )
+            {
+                vTick();
+            }
+
+            ( void ) xTaskResumeAll();
+        }
+        else if( ulKind <= 40 )
+        {
+            for( i = 0; i < ulHold; i++ )
+            {
+                vTick();
+            }
+        }
+        else
+        {
+            vTaskDelay( ulRandom( 2 * BENCH_MAX_HOLD ) );
+        }
+    }
+
+    vReport( "tick context", &xTickContext );
+    vReport( "timer task", &xDaemon );
+    CHECK( xTickContext.ulMaxLate <= BENCH_MAX_HOLD );
+    exit( iSimFailures != 0 );
+}
+
+int main( void )
+{
+    TimerHandle_t xTickTimer, xDaemonTimer;
+
+    xTickTimer = xTimerCreateTickContext( "Tick", BENCH_PERIOD, pdTRUE, NULL, vTickContextCallback );
+    xDaemonTimer = xTimerCreate( "Daemon", BENCH_PERIOD, pdTRUE, NULL, vDaemonCallback );
+    xTimerStart( xTickTimer, 0 );
+    xTimerStart( xDaemonTimer, 0 );
+    xTaskCreate( vWorkload, "W", configMINIMAL_STACK_SIZE, NULL, configTIMER_TASK_PRIORITY, NULL );
+    vTaskStartScheduler();
+    return 1;
+}
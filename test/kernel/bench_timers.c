@@ -0,0 +1,132 @@
+/*_____________________________________________________________________________
+ │                                                                            |
+ │ COPYRIGHT (C) 2026 Mihai Baneu                                             |
+ │                                                                            |
+ | Permission is hereby  granted,  free of charge,  to any person obtaining a |
+ | copy of this software and associated documentation files (the "Software"), |
+ | to deal in the Software without restriction,  including without limitation |
+ | the rights to  use, copy, modify, merge, publish, distribute,  sublicense, |
+ | and/or sell copies  of  the Software, and to permit  persons to  whom  the |
+ | Software is furnished to do so, subject to the following conditions:       |
+ |                                                                            |
+ | The above  copyright notice  and this permission notice  shall be included |
+ | in all copies or substantial portions of the Software.                     |
+ |                                                                            |
+ | THE SOFTWARE IS PROVIDED  "AS IS",  WITHOUT WARRANTY OF ANY KIND,  EXPRESS |
+ | OR   IMPLIED,   INCLUDING   BUT   NOT   LIMITED   TO   THE  WARRANTIES  OF |
+ | MERCHANTABILITY,  FITNESS FOR  A  PARTICULAR  PURPOSE AND NONINFRINGEMENT. |
+ | IN NO  EVENT SHALL  THE AUTHORS  OR  COPYRIGHT  HOLDERS  BE LIABLE FOR ANY |
+ | CLAIM, DAMAGES OR OTHER LIABILITY,  WHETHER IN AN ACTION OF CONTRACT, TORT |
+ | OR OTHERWISE, ARISING FROM,  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR  |
+ | THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                 |
+ |____________________________________________________________________________|
+ |                                                                            |
+ |  Author: Mihai Baneu                           Last modified: 17.Oct.2026  |
+ |                                                                            |
+ |___________________________________________________________________________*/
+
+/* Cost of the software timers with many active timers: the sorted active
+ * lists against the pairing heap (configUSE_TIMER_HEAP). A task below the timer
+ * task starts N auto-reload timers with random periods, resets random ones and
+ * then lets the ticks run. Every callback checks that it runs on its expiry
+ * tick. Reported per operation, including the command queue and the switches
+ * to the timer task but not the host context switch. */
+
+#include "tasks.c"
+#include "timers.h"
+#include "sim_context.h"
+
+#define BENCH_RESETS    100000L
+#define BENCH_TICKS     20000L
+#define BENCH_MAX       10000
+
+static TimerHandle_t xTimers[ BENCH_MAX ];
+static unsigned long ulExpiries;
+static uint32_t ulSeed = 1;
+
+static uint32_t ulRandom( uint32_t ulMax )
+{
+    ulSeed = ulSeed * 1103515245UL + 12345UL;
+    return ( ( ulSeed >> 8 ) % ulMax ) + 1U;
+}
+
+static void vCallback( TimerHandle_t xTimer )
+{
+    /* the timer is already back in the active timers with its next expiry */
+    CHECK( xTimerGetExpiryTime( xTimer ) - xTimerGetPeriod( xTimer ) == xTaskGetTickCount() );
+    ulExpiries++;
+}
+
+static double dElapsed( double dStart,
+                        double dSwapStart )
+{
+    return ( dSimNow() - dStart ) - ( dSimSwapNs - dSwapStart );
+}
+
+static void vMeasure( int iTimers )
+{
+    double dStart, dSwapStart, dStartNs, dResetNs, dTickNs;
+    long i;
+
+    for( i = 0; i < iTimers; i++ )
+    {
+        xTimers[ i ] = xTimerCreate( "T", ulRandom( 2 * iTimers ) + 100, pdTRUE, NULL, vCallback );
+        configASSERT( xTimers[ i ] != NULL );
+    }
+
+    dSwapStart = dSimSwapNs;
+    dStart = dSimNow();
+
+    for( i = 0; i < iTimers; i++ )
+    {
+        xTimerStart( xTimers[ i ], portMAX_DELAY );
+    }
+
+    dStartNs = dElapsed( dStart, dSwapStart ) / iTimers;
+
+    dSwapStart = dSimSwapNs;
+    dStart = dSimNow();
+
+    for( i = 0; i < BENCH_RESETS; i++ )
+    {
+        xTimerReset( xTimers[ ulRandom( iTimers ) - 1 ], portMAX_DELAY );
+    }
+
+    dResetNs = dElapsed( dStart, dSwapStart ) / BENCH_RESETS;
+
+    ulExpiries = 0;
+    dSwapStart = dSimSwapNs;
+    dStart = dSimNow();
+
+    for( i = 0; i < BENCH_TICKS; i++ )
+    {
+        vSimTick();
+    }
+
+    dTickNs = dElapsed( dStart, dSwapStart ) / ulExpiries;
+    CHECK( ulExpiries > BENCH_TICKS / 4 );
+
+    printf( "%s %5d timers: %6.0f ns per start  %6.0f ns per reset  %6.0f ns per expiry (%lu)\n",
+            configUSE_TIMER_HEAP ? "heap" : "list", iTimers, dStartNs, dResetNs, dTickNs, ulExpiries );
+
+    for( i = 0; i < iTimers; i++ )
+    {
+        xTimerDelete( xTimers[ i ], portMAX_DELAY );
+    }
+}
+
+static void vBench( void * pvParameters )
+{
+    ( void ) pvParameters;
+
+    vMeasure( 1000 );
+    vMeasure( 10000 );
+    exit( iSimFailures != 0 );
+}
+
+int main( void )
+{
+    xTaskCreate( vBench, "B", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY + 1, NULL );
+    vTaskStartScheduler();
+    return 1;
+}
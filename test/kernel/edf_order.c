@@ -0,0 +1,111 @@
+/*_____________________________________________________________________________
+ │                                                                            |
+ │ COPYRIGHT (C) 2026 Mihai Baneu                                             |
+ │                                                                            |
+ | Permission is hereby  granted,  free of charge,  to any person obtaining a |
+ | copy of this software and associated documentation files (the "Software"), |
+ | to deal in the Software without restriction,  including without limitation |
+ | the rights to  use, copy, modify, merge, publish, distribute,  sublicense, |
+ | and/or sell copies  of  the Software, and to permit  persons to  whom  the |
+ | Software is furnished to do so, subject to the following conditions:       |
+ |                                                                            |
+ | The above  copyright notice  and this permission notice  shall be included |
+ | in all copies or substantial portions of the Software.                     |
+ |                                                                            |
+ | THE SOFTWARE IS PROVIDED  "AS IS",  WITHOUT WARRANTY OF ANY KIND,  EXPRESS |
+ | OR   IMPLIED,   INCLUDING   BUT   NOT   LIMITED   TO   THE  WARRANTIES  OF |
+ | MERCHANTABILITY,  FITNESS FOR  A  PARTICULAR  PURPOSE AND NONINFRINGEMENT. |
+ | IN NO  EVENT SHALL  THE AUTHORS  OR  COPYRIGHT  HOLDERS  BE LIABLE FOR ANY |
+ | CLAIM, DAMAGES OR OTHER LIABILITY,  WHETHER IN AN ACTION OF CONTRACT, TORT |
+ | OR OTHERWISE, ARISING FROM,  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR  |
+ | THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                 |
+ |____________________________________________________________________________|
+ |                                                                            |
+ |  Author: Mihai Baneu                           Last modified: 17.Oct.2026  |
+ |                                                                            |
+ |___________________________________________________________________________*/
+
+/* Order of the earliest deadline first class: deadline order within
+ * configEDF_PRIORITY, preemption by the release of an earlier deadline, none
+ * by a later one, and the fixed priorities above it always win. Built a second
+ * time from an initial tick count close to the wrap, so that the deadlines
+ * straddle it. */
+
+#include "tasks.c"
+#include "sim.h"
+
+int main( void )
+{
+    TaskHandle_t xA, xB, xC, xH;
+    TickType_t xWakeB, xWakeC, xWakeA, xWakeH;
+    const TickType_t xStart = configINITIAL_TICK_COUNT;
+
+    xTaskCreate( vTaskDummy, "A", 256, NULL, configEDF_PRIORITY, &xA );
+    xTaskCreate( vTaskDummy, "B", 256, NULL, configEDF_PRIORITY, &xB );
+    xTaskCreate( vTaskDummy, "C", 256, NULL, configEDF_PRIORITY, &xC );
+    xTaskCreate( vTaskDummy, "H", 256, NULL, configEDF_PRIORITY + 2, &xH );
+    vTaskSetDeadline( xA, 200 );
+    vTaskSetDeadline( xB, 10 );
+    vTaskSetDeadline( xC, 150 );
+    vTaskStartScheduler();
+
+    /* H runs first, then blocks until xStart + 150 */
+    CHECK( pxCurrentTCB == ( TCB_t * ) xH );
+    xWakeH = xStart;
+    xTaskDelayUntil( &xWakeH, 150 );
+    vSimSwitch();
+
+    /* ordering: B (10), C (150), A (200) */
+    CHECK( pxCurrentTCB == ( TCB_t * ) xB );
+    /* B blocks until 100, its next deadline is xStart + 110 */
+    xWakeB = xStart;
+    xTaskDelayUntil( &xWakeB, 100 );
+    vSimSwitch();
+    CHECK( pxCurrentTCB == ( TCB_t * ) xC );
+    /* C blocks until 90, its next deadline is xStart + 240 */
+    xWakeC = xStart;
+    xTaskDelayUntil( &xWakeC, 90 );
+    vSimSwitch();
+    CHECK( pxCurrentTCB == ( TCB_t * ) xA );
+
+    /* C released at 90 with deadline 240 > 200: A keeps running */
+    while( xTickCount != xStart + 90 )
+    {
+        CHECK( xSimTick() == pdFALSE );
+    }
+    CHECK( pxCurrentTCB == ( TCB_t * ) xA );
+    CHECK( eTaskGetState( xC ) == eReady );
+
+    /* B released at 100 with deadline 110 < 200: preempts A */
+    while( xTickCount != xStart + 99 )
+    {
+        CHECK( xSimTick() == pdFALSE );
+    }
+    CHECK( xSimTick() == pdTRUE );
+    CHECK( pxCurrentTCB == ( TCB_t * ) xB );
+
+    /* B done, A (200) before C (240) */
+    xTaskDelayUntil( &xWakeB, 100 );
+    vSimSwitch();
+    CHECK( pxCurrentTCB == ( TCB_t * ) xA );
+
+    /* H released at 150: higher fixed priority preempts regardless */
+    while( xTickCount != xStart + 149 )
+    {
+        CHECK( xSimTick() == pdFALSE );
+    }
+    CHECK( xSimTick() == pdTRUE );
+    CHECK( pxCurrentTCB == ( TCB_t * ) xH );
+    xTaskDelayUntil( &xWakeH, 1000 );
+    vSimSwitch();
+    CHECK( pxCurrentTCB == ( TCB_t * ) xA );
+
+    /* A done (next deadline 400), only C is ready */
+    xWakeA = xStart;
+    xTaskDelayUntil( &xWakeA, 200 );
+    vSimSwitch();
+    CHECK( pxCurrentTCB == ( TCB_t * ) xC );
+
+    printf( "edf (initial tick 0x%08lx): %s\n", ( unsigned long ) xStart, iSimFailures ? "FAILED" : "passed" );
+    return iSimFailures != 0;
+}
@@ -0,0 +1,263 @@
+/*_____________________________________________________________________________
+ │                                                                            |
+ │ COPYRIGHT (C) 2026 Mihai Baneu                                             |
+ │                                                                            |
+ | Permission is hereby  granted,  free of charge,  to any person obtaining a |
+ | copy of this software and associated documentation files (the "Software"), |
+ | to deal in the Software without restriction,  including without limitation |
+ | the rights to  use, copy, modify, merge, publish, distribute,  sublicense, |
+ | and/or sell copies  of  the Software, and to permit  persons to  whom  the |
+ | Software is furnished to do so, subject to the following conditions:       |
+ |                                                                            |
+ | The above  copyright notice  and this permission notice  shall be included |
+ | in all copies or substantial portions of the Software.                     |
+ |                                                                            |
+ | THE SOFTWARE IS PROVIDED  "AS IS",  WITHOUT WARRANTY OF ANY KIND,  EXPRESS |
+ | OR   IMPLIED,   INCLUDING   BUT   NOT   LIMITED   TO   THE  WARRANTIES  OF |
+ | MERCHANTABILITY,  FITNESS FOR  A  PARTICULAR  PURPOSE AND NONINFRINGEMENT. |
+ | IN NO  EVENT SHALL  THE AUTHORS  OR  COPYRIGHT  HOLDERS  BE LIABLE FOR ANY |
+ | CLAIM, DAMAGES OR OTHER LIABILITY,  WHETHER IN AN ACTION OF CONTRACT, TORT |
+ | OR OTHERWISE, ARISING FROM,  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR  |
+ | THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                 |
+ |____________________________________________________________________________|
+ |                                                                            |
+ |  Author: Mihai Baneu                           Last modified: 17.Oct.2026  |
+ |                                                                            |
+ |___________________________________________________________________________*/
+
+/* Schedulable utilisation of the earliest deadline first class against rate
+ * monotonic priorities. Random sets of periodic tasks (UUniFast utilisations,
+ * periods of 10 to 100 ticks, deadline equal to the period) run once with
+ * every task at configEDF_PRIORITY and once with one priority per task, the
+ * shortest period highest. A job executes one tick per unit of cost and
+ * misses its deadline when it completes later than its next release. Each run
+ * is a child process, the scheduler cannot be started twice. EDF must meet
+ * every deadline up to a utilisation of 1, RM must miss some. */
+
+#include "tasks.c"
+#include "sim_context.h"
+
+#include <math.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#define SIM_TICKS           10000UL
+#define SIM_SETS            100
+#define SIM_MAX_TASKS       5
+#define SIM_LEVELS          7
+
+typedef struct
+{
+    TickType_t xPeriod;
+    TickType_t xCost;
+} SimJob_t;
+
+typedef struct
+{
+    UBaseType_t uxTasks;
+    SimJob_t xJobs[ SIM_MAX_TASKS ];
+} SimTaskSet_t;
+
+typedef struct
+{
+    unsigned long ulJobs;
+    unsigned long ulMisses;
+} SimResult_t;
+
+static SimResult_t * pxResult;
+static unsigned long ulRealTicks;
+static uint32_t ulSeed = 1;
+
+static uint32_t ulRandom( uint32_t ulMax )
+{
+    ulSeed = ulSeed * 1103515245UL + 12345UL;
+    return ( ( ulSeed >> 8 ) % ulMax ) + 1U;
+}
+
+static double dRandom( void )
+{
+    return ( ulRandom( 1U << 20 ) - 1U ) / ( double ) ( 1U << 20 );
+}
+
+/* one unit of execution of the running task, the child ends after SIM_TICKS */
+static void vTick( void )
+{
+    if( ++ulRealTicks > SIM_TICKS )
+    {
+        _exit( 0 );
+    }
+
+    vSimTick();
+}
+
+void vApplicationIdleHook( void )
+{
+    vTick();
+}
+
+static void vPeriodic( void * pvParameters )
+{
+    const SimJob_t * pxJob = ( const SimJob_t * ) pvParameters;
+    TickType_t xRelease = xTaskGetTickCount();
+    TickType_t i;
+
+    for( ; ; )
+    {
+        for( i = 0; i < pxJob->xCost; i++ )
+        {
+            vTick();
+        }
+
+        pxResult->ulJobs++;
+
+        if( ( xTaskGetTickCount() - xRelease ) > pxJob->xPeriod )
+        {
+            pxResult->ulMisses++;
+        }
+
+        xTaskDelayUntil( &xRelease, pxJob->xPeriod );
+    }
+}
+
+static double dUtilisation( const SimTaskSet_t * pxSet )
+{
+    double dUtilisation = 0;
+    UBaseType_t x;
+
+    for( x = 0; x < pxSet->uxTasks; x++ )
+    {
+        dUtilisation += ( double ) pxSet->xJobs[ x ].xCost / pxSet->xJobs[ x ].xPeriod;
+    }
+
+    return dUtilisation;
+}
+
+/* UUniFast, then rounded to whole ticks, until the rounded utilisation is
+ * within 0.025 of the target and not above 1 */
+static void vRandomSet( SimTaskSet_t * pxSet,
+                        double dTarget )
+{
+    double dLeft, dNext, dTotal;
+    UBaseType_t x;
+
+    do
+    {
+        pxSet->uxTasks = 1 + ulRandom( SIM_MAX_TASKS - 1 );
+        dLeft = dTarget;
+
+        for( x = 0; x < pxSet->uxTasks; x++ )
+        {
+            if( x + 1 < pxSet->uxTasks )
+            {
+                dNext = dLeft * pow( dRandom(), 1.0 / ( pxSet->uxTasks - 1 - x ) );
+            }
+            else
+            {
+                dNext = 0;
+            }
+
+            pxSet->xJobs[ x ].xPeriod = 9 + ulRandom( 91 );
+            pxSet->xJobs[ x ].xCost = ( TickType_t ) lround( ( dLeft - dNext ) * pxSet->xJobs[ x ].xPeriod );
+
+            if( pxSet->xJobs[ x ].xCost == 0 )
+            {
+                pxSet->xJobs[ x ].xCost = 1;
+            }
+
+            dLeft = dNext;
+        }
+
+        dTotal = dUtilisation( pxSet );
+    } while( ( fabs( dTotal - dTarget ) > 0.025 ) || ( dTotal > 1.0 ) );
+}
+
+/* the jobs that missed their deadline in SIM_TICKS */
+static unsigned long ulRun( const SimTaskSet_t * pxSet,
+                            BaseType_t xEDF )
+{
+    UBaseType_t x, y, uxPriority;
+    int iStatus;
+
+    pxResult->ulJobs = 0;
+    pxResult->ulMisses = 0;
+
+    if( fork() == 0 )
+    {
+        for( x = 0; x < pxSet->uxTasks; x++ )
+        {
+            TaskHandle_t xTask;
+
+            /* RM: above every task of a longer period, ties in set order */
+            uxPriority = 1;
+
+            for( y = 0; y < pxSet->uxTasks; y++ )
+            {
+                if( ( pxSet->xJobs[ y ].xPeriod > pxSet->xJobs[ x ].xPeriod ) ||
+                    ( ( pxSet->xJobs[ y ].xPeriod == pxSet->xJobs[ x ].xPeriod ) && ( y > x ) ) )
+                {
+                    uxPriority++;
+                }
+            }
+
+            xTaskCreate( vPeriodic, "P", configMINIMAL_STACK_SIZE, ( void * ) &pxSet->xJobs[ x ],
+                         xEDF ? configEDF_PRIORITY : uxPriority, &xTask );
+
+            if( xEDF )
+            {
+                vTaskSetDeadline( xTask, pxSet->xJobs[ x ].xPeriod );
+            }
+        }
+
+        vTaskStartScheduler();
+        _exit( 1 );
+    }
+
+    wait( &iStatus );
+    CHECK( WIFEXITED( iStatus ) && ( WEXITSTATUS( iStatus ) == 0 ) );
+    CHECK( pxResult->ulJobs > 0 );
+    return pxResult->ulMisses;
+}
+
+int main( void )
+{
+    /* the textbook set of utilisation 0.971 that RM cannot schedule */
+    static const SimTaskSet_t xTextbook = { 2, { { 5, 2 }, { 7, 4 } } };
+    static SimTaskSet_t xSet;
+    unsigned long ulEDFMissed = 0, ulRMMissed = 0;
+    int iLevel, iSet, iEDFMet, iRMMet;
+
+    pxResult = mmap( NULL, sizeof( SimResult_t ), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0 );
+
+    CHECK( ulRun( &xTextbook, pdTRUE ) == 0 );
+    CHECK( ulRun( &xTextbook, pdFALSE ) > 0 );
+    printf( "U %.3f (C 2, T 5) (C 4, T 7): EDF meets every deadline, RM misses\n", dUtilisation( &xTextbook ) );
+
+    for( iLevel = 0; iLevel < SIM_LEVELS; iLevel++ )
+    {
+        double dTarget = 0.70 + 0.05 * iLevel;
+
+        iEDFMet = 0;
+        iRMMet = 0;
+
+        for( iSet = 0; iSet < SIM_SETS; iSet++ )
+        {
+            unsigned long ulMissed;
+
+            vRandomSet( &xSet, dTarget );
+            ulMissed = ulRun( &xSet, pdTRUE );
+            iEDFMet += ( ulMissed == 0 );
+            ulEDFMissed += ulMissed;
+            ulMissed = ulRun( &xSet, pdFALSE );
+            iRMMet += ( ulMissed == 0 );
+            ulRMMissed += ulMissed;
+        }
+
+        printf( "U %.2f: EDF schedules %2d of %d sets, RM %2d\n", dTarget, iEDFMet, SIM_SETS, iRMMet );
+    }
+
+    printf( "missed deadlines: EDF %lu, RM %lu\n", ulEDFMissed, ulRMMissed );
+    CHECK( ulEDFMissed == 0 );
+    CHECK( ulRMMissed > 0 );
+    return iSimFailures != 0;
+}
@@ -0,0 +1,302 @@
+/*_____________________________________________________________________________
+ │                                                                            |
+ │ COPYRIGHT (C) 2026 Mihai Baneu                                             |
+ │                                                                            |
+ | Permission is hereby  granted,  free of charge,  to any person obtaining a |
+ | copy of this software and associated documentation files (the "Software"), |
+ | to deal in the Software without restriction,  including without limitation |
+ | the rights to  use, copy, modify, merge, publish, distribute,  sublicense, |
+ | and/or sell copies  of  the Software, and to permit  persons to  whom  the |
+ | Software is furnished to do so, subject to the following conditions:       |
+ |                                                                            |
+ | The above  copyright notice  and this permission notice  shall be included |
+ | in all copies or substantial portions of the Software.                     |
+ |                                                                            |
+ | THE SOFTWARE IS PROVIDED  "AS IS",  WITHOUT WARRANTY OF ANY KIND,  EXPRESS |
+ | OR   IMPLIED,   INCLUDING   BUT   NOT   LIMITED   TO   THE  WARRANTIES  OF |
+ | MERCHANTABILITY,  FITNESS FOR  A  PARTICULAR  PURPOSE AND NONINFRINGEMENT. |
+ | IN NO  EVENT SHALL  THE AUTHORS  OR  COPYRIGHT  HOLDERS  BE LIABLE FOR ANY |
+ | CLAIM, DAMAGES OR OTHER LIABILITY,  WHETHER IN AN ACTION OF CONTRACT, TORT |
+ | OR OTHERWISE, ARISING FROM,  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR  |
+ | THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                 |
+ |____________________________________________________________________________|
+ |                                                                            |
+ |  Author: Mihai Baneu                           Last modified: 17.Oct.2026  |
+ |                                                                            |
+ |___________________________________________________________________________*/
+
+/* Pended tick catch-up in xTaskResumeAll() against plain ticking. The same
+ * random workload of delays runs twice, each time in a child process: once
+ * ticking normally, once pending every window of ticks with the scheduler
+ * suspended and catching them up in xTaskResumeAll(). The state of the
+ * scheduler after each window must be the same in both runs. The tick count
+ * starts close to the wrap, so the runs cross it.
+ *
+ * Then the cost of the catch up is measured: xTaskResumeAll() after 10, 100
+ * and 1000 pended ticks, against one xTaskIncrementTick() per tick, which is
+ * what the catch up did before. */
+
+#include <stdint.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+static unsigned long ulIncrementCalls;
+static uint32_t ulReadyHash;
+
+/* Every move to the Ready state with its tick, a task woken a tick late or in
+ * a different order changes the hash. The tasks with a budget are left out:
+ * ticking normally they are switched in, and throttled, on the tick they
+ * wake, which does not happen while the scheduler is suspended. */
+#if ( configUSE_TASK_BUDGETS == 1 )
+    #define simHASH_MOVE( pxTCB )    ( ( pxTCB )->ulBudget == 0 )
+#else
+    #define simHASH_MOVE( pxTCB )    ( 1 )
+#endif
+
+#define traceTASK_INCREMENT_TICK( xTickCount )    ( ulIncrementCalls++ )
+#define traceMOVED_TASK_TO_READY_STATE( pxTCB )                                                                                    \
+    if( simHASH_MOVE( pxTCB ) )                                                                                                    \
+    {                                                                                                                              \
+        ulReadyHash = ( ulReadyHash ^ ( ( uint32_t ) ( pxTCB )->uxTaskNumber << 24 ) ^ ( uint32_t ) xTickCount ) * 16777619UL; \
+    }
+
+#include "tasks.c"
+#include "sim.h"
+
+#define SIM_TASKS           8
+#define SIM_WINDOWS         400
+#define BENCH_WINDOWS       10000
+
+typedef struct
+{
+    TickType_t xTickCount;
+    TickType_t xNextTaskUnblockTime;
+    TickType_t xNextReplenishTime;
+    uint32_t ulReadyHash;
+    UBaseType_t uxRunning;
+    eTaskState eStates[ SIM_TASKS ];
+} SimWindow_t;
+
+typedef struct
+{
+    SimWindow_t xWindows[ 2 ][ SIM_WINDOWS ];
+    unsigned long ulPended;
+    unsigned long ulIncrementCalls;
+} SimShared_t;
+
+static SimShared_t * pxShared;
+static TaskHandle_t xTasks[ SIM_TASKS ];
+static TaskHandle_t xLow;
+static uint32_t ulSeed = 12345;
+
+static uint32_t ulRandom( uint32_t ulMax )
+{
+    ulSeed = ulSeed * 1103515245UL + 12345UL;
+    return ( ( ulSeed >> 8 ) % ulMax ) + 1U;
+}
+
+/* let every woken task run and block again for a random time */
+static void vDrain( void )
+{
+    while( pxCurrentTCB != ( TCB_t * ) xLow )
+    {
+        uint32_t ulKind = ulRandom( 100 );
+
+        /* the run time only advances here, so both runs charge the same */
+        ulSimRunTime += ulRandom( 400 );
+
+        /* mostly short delays, within the first wheel level, some long ones */
+        if( ulKind <= 50 )
+        {
+            vTaskDelay( ulRandom( 31 ) );
+        }
+        else if( ulKind <= 85 )
+        {
+            vTaskDelay( ulRandom( 1100 ) );
+        }
+        else
+        {
+            vTaskDelay( ulRandom( 6000 ) );
+        }
+
+        vSimSwitch();
+    }
+}
+
+static void vStart( void )
+{
+    UBaseType_t x;
+
+    for( x = 0; x < SIM_TASKS; x++ )
+    {
+        xTaskCreate( vTaskDummy, "T", configMINIMAL_STACK_SIZE, NULL, 2 + x, &xTasks[ x ] );
+        vTaskSetTaskNumber( xTasks[ x ], x );
+    }
+
+    xTaskCreate( vTaskDummy, "L", configMINIMAL_STACK_SIZE, NULL, 1, &xLow );
+    vTaskSetTaskNumber( xLow, SIM_TASKS );
+
+    #if ( configUSE_TASK_BUDGETS == 1 )
+    {
+        vTaskSetBudget( xTasks[ 0 ], 1000, 7, eBudgetDemote );
+        vTaskSetBudget( xTasks[ 1 ], 1000, 50, eBudgetDemote );
+        vTaskSetBudget( xTasks[ 2 ], 1000, 333, eBudgetSuspend );
+        vTaskSetBudget( xTasks[ 3 ], 1000, 2000, eBudgetDemote );
+    }
+    #endif
+
+    vTaskStartScheduler();
+    vSimSwitch();
+    vDrain();
+}
+
+static void vRun( int iCatchUp )
+{
+    SimWindow_t * pxWindow;
+    uint32_t ulTicks;
+    UBaseType_t x;
+    int iWindow;
+
+    vStart();
+
+    for( iWindow = 0; iWindow < SIM_WINDOWS; iWindow++ )
+    {
+        ulTicks = ( ( iWindow % 7 ) == 0 ) ? ulRandom( 4000 ) : ulRandom( 300 );
+
+        if( iCatchUp == 0 )
+        {
+            while( ulTicks-- > 0 )
+            {
+                xSimTick();
+            }
+        }
+        else
+        {
+            vTaskSuspendAll();
+            pxShared->ulPended += ulTicks;
+
+            while( ulTicks-- > 0 )
+            {
+                xTaskIncrementTick();
+            }
+
+            /* the yield requested by xTaskResumeAll() */
+            ( void ) xTaskResumeAll();
+            vSimSwitch();
+        }
+
+        pxWindow = &( pxShared->xWindows[ iCatchUp ][ iWindow ] );
+        pxWindow->xTickCount = xTickCount;
+        pxWindow->xNextTaskUnblockTime = xNextTaskUnblockTime;
+        pxWindow->ulReadyHash = ulReadyHash;
+        pxWindow->uxRunning = uxTaskGetTaskNumber( pxCurrentTCB );
+
+        #if ( configUSE_TASK_BUDGETS == 1 )
+        {
+            pxWindow->xNextReplenishTime = xNextBudgetReplenishTime;
+        }
+        #endif
+
+        for( x = 0; x < SIM_TASKS; x++ )
+        {
+            pxWindow->eStates[ x ] = eTaskGetState( xTasks[ x ] );
+        }
+
+        vDrain();
+    }
+
+    pxShared->ulIncrementCalls = ulIncrementCalls;
+    _exit( 0 );
+}
+
+static void vBench( void )
+{
+    static const uint32_t ulPendedTicks[] = { 10, 100, 1000 };
+    double dStart, dResume, dTicks;
+    uint32_t x, ulTicks;
+    int iWindow;
+
+    vStart();
+
+    for( x = 0; x < sizeof( ulPendedTicks ) / sizeof( ulPendedTicks[ 0 ] ); x++ )
+    {
+        dResume = 0;
+        dTicks = 0;
+
+        for( iWindow = 0; iWindow < BENCH_WINDOWS; iWindow++ )
+        {
+            vTaskSuspendAll();
+
+            for( ulTicks = 0; ulTicks < ulPendedTicks[ x ]; ulTicks++ )
+            {
+                xTaskIncrementTick();
+            }
+
+            dStart = dSimNow();
+            ( void ) xTaskResumeAll();
+            dResume += dSimNow() - dStart;
+            iSimYieldPending = 1;
+            vSimSwitch();
+            vDrain();
+
+            /* the same number of ticks, one xTaskIncrementTick() each */
+            dStart = dSimNow();
+
+            for( ulTicks = 0; ulTicks < ulPendedTicks[ x ]; ulTicks++ )
+            {
+                xTaskIncrementTick();
+            }
+
+            dTicks += dSimNow() - dStart;
+            iSimYieldPending = 1;
+            vSimSwitch();
+            vDrain();
+        }
+
+        printf( "%4lu pended ticks: xTaskResumeAll() %7.0f ns, one xTaskIncrementTick() per tick %7.0f ns\n",
+                ( unsigned long ) ulPendedTicks[ x ], dResume / BENCH_WINDOWS, dTicks / BENCH_WINDOWS );
+    }
+}
+
+int main( void )
+{
+    int iCatchUp, iWindow, iStatus;
+
+    pxShared = mmap( NULL, sizeof( SimShared_t ), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0 );
+
+    for( iCatchUp = 0; iCatchUp < 2; iCatchUp++ )
+    {
+        if( fork() == 0 )
+        {
+            vRun( iCatchUp );
+        }
+
+        wait( &iStatus );
+
+        if( !WIFEXITED( iStatus ) || ( WEXITSTATUS( iStatus ) != 0 ) )
+        {
+            printf( "FAIL: run %d did not complete\n", iCatchUp );
+            return 1;
+        }
+    }
+
+    for( iWindow = 0; iWindow < SIM_WINDOWS; iWindow++ )
+    {
+        if( memcmp( &( pxShared->xWindows[ 0 ][ iWindow ] ), &( pxShared->xWindows[ 1 ][ iWindow ] ), sizeof( SimWindow_t ) ) != 0 )
+        {
+            printf( "FAIL: window %d differs, tick %08lx against %08lx\n", iWindow,
+                    ( unsigned long ) pxShared->xWindows[ 0 ][ iWindow ].xTickCount,
+                    ( unsigned long ) pxShared->xWindows[ 1 ][ iWindow ].xTickCount );
+            return 1;
+        }
+    }
+
+    printf( "%d windows identical, tick %08lx to %08lx, %lu pended ticks, %lu through xTaskIncrementTick()\n",
+            SIM_WINDOWS, ( unsigned long ) configINITIAL_TICK_COUNT,
+            ( unsigned long ) pxShared->xWindows[ 0 ][ SIM_WINDOWS - 1 ].xTickCount, pxShared->ulPended,
+            pxShared->ulIncrementCalls - pxShared->ulPended );
+
+    vBench();
+    return iSimFailures != 0;
+}
@@ -0,0 +1,76 @@
+/*_____________________________________________________________________________
+ │                                                                            |
+ │ COPYRIGHT (C) 2026 Mihai Baneu                                             |
+ │                                                                            |
+ | Permission is hereby  granted,  free of charge,  to any person obtaining a |
+ | copy of this software and associated documentation files (the "Software"), |
+ | to deal in the Software without restriction,  including without limitation |
+ | the rights to  use, copy, modify, merge, publish, distribute,  sublicense, |
+ | and/or sell copies  of  the Software, and to permit  persons to  whom  the |
+ | Software is furnished to do so, subject to the following conditions:       |
+ |                                                                            |
+ | The above  copyright notice  and this permission notice  shall be included |
+ | in all copies or substantial portions of the Software.                     |
+ |                                                                            |
+ | THE SOFTWARE IS PROVIDED  "AS IS",  WITHOUT WARRANTY OF ANY KIND,  EXPRESS |
+ | OR   IMPLIED,   INCLUDING   BUT   NOT   LIMITED   TO   THE  WARRANTIES  OF |
+ | MERCHANTABILITY,  FITNESS FOR  A  PARTICULAR  PURPOSE AND NONINFRINGEMENT. |
+ | IN NO  EVENT SHALL  THE AUTHORS  OR  COPYRIGHT  HOLDERS  BE LIABLE FOR ANY |
+ | CLAIM, DAMAGES OR OTHER LIABILITY,  WHETHER IN AN ACTION OF CONTRACT, TORT |
+ | OR OTHERWISE, ARISING FROM,  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR  |
+ | THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                 |
+ |____________________________________________________________________________|
+ |                                                                            |
+ |  Author: Mihai Baneu                           Last modified: 17.Oct.2026  |
+ |                                                                            |
+ |___________________________________________________________________________*/
+
+/* The highest priority lookup of the port against __builtin_clz(), which the
+other ports use. Every value below 2^24 is checked, and above that every value
+with a single bit set and random values under every highest bit. */
+
+#include <stdio.h>
+#include "portmacro.h"
+
+/* random values checked under every highest bit above 2^24 */
+#define SIM_RANDOM_VALUES       1000000U
+
+static uint32_t ulSeed = 1;
+static uint32_t ulFailures;
+
+static uint32_t ulRandom(void)
+{
+    ulSeed = ulSeed * 1103515245UL + 12345UL;
+    return ulSeed ^ ( ulSeed >> 16 );
+}
+
+static void vCheck(uint32_t ulReadyPriorities)
+{
+    UBaseType_t uxTopPriority;
+
+    portGET_HIGHEST_PRIORITY(uxTopPriority, ulReadyPriorities);
+    if( uxTopPriority != ( UBaseType_t ) ( 31U - __builtin_clz(ulReadyPriorities) ) ) {
+        if( ulFailures++ < 10U ) {
+            printf("FAIL 0x%08lx: %lu\n", (unsigned long) ulReadyPriorities, (unsigned long) uxTopPriority);
+        }
+    }
+}
+
+int main(void)
+{
+    uint32_t ulValue, ulBit, ulIndex;
+
+    for( ulValue = 1; ulValue < ( 1UL << 24 ); ulValue++ ) {
+        vCheck(ulValue);
+    }
+
+    for( ulBit = 24; ulBit < 32; ulBit++ ) {
+        vCheck(1UL << ulBit);
+        for( ulIndex = 0; ulIndex < SIM_RANDOM_VALUES; ulIndex++ ) {
+            vCheck(( 1UL << ulBit ) | ( ulRandom() & ( ( 1UL << ulBit ) - 1U ) ));
+        }
+    }
+
+    printf("highest priority lookup: %lu failures\n", (unsigned long) ulFailures);
+    return ulFailures != 0;
+}
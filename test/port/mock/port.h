@@ -0,0 +1,310 @@
+/*_____________________________________________________________________________
+ │                                                                            |
+ │ COPYRIGHT (C) 2026 Mihai Baneu                                             |
+ │                                                                            |
+ | Permission is hereby  granted,  free of charge,  to any person obtaining a |
+ | copy of this software and associated documentation files (the "Software"), |
+ | to deal in the Software without restriction,  including without limitation |
+ | the rights to  use, copy, modify, merge, publish, distribute,  sublicense, |
+ | and/or sell copies  of  the Software, and to permit  persons to  whom  the |
+ | Software is furnished to do so, subject to the following conditions:       |
+ |                                                                            |
+ | The above  copyright notice  and this permission notice  shall be included |
+ | in all copies or substantial portions of the Software.                     |
+ |                                                                            |
+ | THE SOFTWARE IS PROVIDED  "AS IS",  WITHOUT WARRANTY OF ANY KIND,  EXPRESS |
+ | OR   IMPLIED,   INCLUDING   BUT   NOT   LIMITED   TO   THE  WARRANTIES  OF |
+ | MERCHANTABILITY,  FITNESS FOR  A  PARTICULAR  PURPOSE AND NONINFRINGEMENT. |
+ | IN NO  EVENT SHALL  THE AUTHORS  OR  COPYRIGHT  HOLDERS  BE LIABLE FOR ANY |
+ | CLAIM, DAMAGES OR OTHER LIABILITY,  WHETHER IN AN ACTION OF CONTRACT, TORT |
+ | OR OTHERWISE, ARISING FROM,  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR  |
+ | THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                 |
+ |____________________________________________________________________________|
+ |                                                                            |
+ |  Author: Mihai Baneu                           Last modified: 17.Oct.2026  |
+ |                                                                            |
+ |___________________________________________________________________________*/
+
+/* Stand-in for the port.h of a SysTick port when port_systick.c is built on the
+host. The SysTick, the SCB and the PRIMASK of the core are a cycle model: time
+only passes when the code touches a register, waits for an event or when the
+test runs thread code, so the drift of the tick against the model time is
+exact. */
+
+#pragma once
+
+#include <stdint.h>
+#include <assert.h>
+
+#define SysTick_CTRL_ENABLE_Msk         ( 1UL << 0 )
+#define SysTick_CTRL_TICKINT_Msk        ( 1UL << 1 )
+#define SysTick_CTRL_CLKSOURCE_Msk      ( 1UL << 2 )
+#define SysTick_CTRL_COUNTFLAG_Msk      ( 1UL << 16 )
+#define SysTick_LOAD_RELOAD_Msk         ( 0xFFFFFFUL )
+#define SCB_ICSR_PENDSTSET_Msk          ( 1UL << 26 )
+#define SCB_ICSR_PENDSTCLR_Msk          ( 1UL << 25 )
+#define SCB_ICSR_VECTPENDING_Msk        ( 0x1FFUL << 12 )
+#define SCB_SCR_SEVONPEND_Msk           ( 1UL << 4 )
+
+#define __NVIC_PRIO_BITS                4U
+#define SysTick_IRQn                    ( -1 )
+
+/* cycles taken by an access to a core peripheral register, by a barrier or a
+PRIMASK change and by the wait instructions */
+#define modelBUS_CYCLES                 2U
+#define modelINSTRUCTION_CYCLES         1U
+
+typedef struct {
+    uint64_t ullNow;                    /* cycles since reset */
+    uint32_t ulCtrl;                    /* ENABLE, TICKINT and CLKSOURCE */
+    uint32_t ulLoad;
+    uint32_t ulVal;
+    int iCountFlag;
+    int iTickPending;
+    uint64_t ullExternalAt;             /* the next external interrupt becomes pending */
+    int iExternalPending;
+    int iEvent;                         /* the WFE event register */
+    int iSevOnPend;
+    int iPrimask;
+    int iStarted;
+    uint64_t ullStartedAt;              /* the SysTick was first enabled */
+    uint64_t ullStopped;                /* cycles the SysTick did not count since */
+    uint32_t ulWakeups;                 /* WFE/WFI instructions that did wait */
+} ModelCore_t;
+
+static ModelCore_t xCore;
+
+static void vModelPend(int *piPending)
+{
+    if( *piPending == 0 ) {
+        *piPending = 1;
+        if( xCore.iSevOnPend != 0 ) {
+            xCore.iEvent = 1;
+        }
+    }
+}
+
+/* cycles until the next interrupt becomes pending, 0 if none will */
+static uint64_t ullModelNextPend(void)
+{
+    uint64_t ullNext = 0;
+
+    if( ( xCore.ulCtrl & ( SysTick_CTRL_ENABLE_Msk | SysTick_CTRL_TICKINT_Msk ) ) == ( SysTick_CTRL_ENABLE_Msk | SysTick_CTRL_TICKINT_Msk ) ) {
+        ullNext = ( xCore.ulVal == 0 ) ? ( uint64_t ) xCore.ulLoad + 1U : xCore.ulVal;
+    }
+    if( ( xCore.iExternalPending == 0 ) && ( xCore.ullExternalAt > xCore.ullNow ) ) {
+        uint64_t ullExternal = xCore.ullExternalAt - xCore.ullNow;
+        if( ( ullNext == 0 ) || ( ullExternal < ullNext ) ) {
+            ullNext = ullExternal;
+        }
+    }
+    return ullNext;
+}
+
+/* let the given number of cycles pass: the SysTick counts down to 0, flags and
+requests the interrupt, then reloads on the next clock */
+static void vModelRun(uint64_t ullCycles)
+{
+    uint64_t ullLeft = ullCycles;
+
+    if( ( xCore.ulCtrl & SysTick_CTRL_ENABLE_Msk ) == 0 ) {
+        if( xCore.iStarted != 0 ) {
+            xCore.ullStopped += ullCycles;
+        }
+        ullLeft = 0;
+    }
+    while( ullLeft > 0 ) {
+        if( xCore.ulVal == 0 ) {
+            if( xCore.ulLoad == 0 ) {
+                break;
+            }
+            xCore.ulVal = xCore.ulLoad;
+            ullLeft--;
+        }
+        else if( ullLeft < xCore.ulVal ) {
+            xCore.ulVal -= ( uint32_t ) ullLeft;
+            ullLeft = 0;
+        }
+        else {
+            ullLeft -= xCore.ulVal;
+            xCore.ulVal = 0;
+            xCore.iCountFlag = 1;
+            if( ( xCore.ulCtrl & SysTick_CTRL_TICKINT_Msk ) != 0 ) {
+                vModelPend(&xCore.iTickPending);
+            }
+        }
+    }
+
+    xCore.ullNow += ullCycles;
+    if( ( xCore.iExternalPending == 0 ) && ( xCore.ullExternalAt != 0 ) && ( xCore.ullNow >= xCore.ullExternalAt ) ) {
+        vModelPend(&xCore.iExternalPending);
+    }
+}
+
+/* let time pass until the next interrupt becomes pending */
+static void vModelWaitForPend(void)
+{
+    uint64_t ullNext = ullModelNextPend();
+
+    assert( ullNext != 0 );
+    xCore.ulWakeups++;
+    vModelRun(ullNext);
+}
+
+class ModelCtrl {
+public:
+    operator uint32_t() const {
+        uint32_t ulValue;
+
+        vModelRun(modelBUS_CYCLES);
+        ulValue = xCore.ulCtrl | ( ( xCore.iCountFlag != 0 ) ? SysTick_CTRL_COUNTFLAG_Msk : 0 );
+        xCore.iCountFlag = 0;
+        return ulValue;
+    }
+    ModelCtrl &operator=(uint32_t ulValue) {
+        vModelRun(modelBUS_CYCLES);
+        xCore.ulCtrl = ulValue & ( SysTick_CTRL_ENABLE_Msk | SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_CLKSOURCE_Msk );
+        if( ( xCore.iStarted == 0 ) && ( ( ulValue & SysTick_CTRL_ENABLE_Msk ) != 0 ) ) {
+            xCore.iStarted = 1;
+            xCore.ullStartedAt = xCore.ullNow;
+        }
+        return *this;
+    }
+    ModelCtrl &operator|=(uint32_t ulValue) {
+        return *this = ( ( uint32_t ) *this | ulValue );
+    }
+};
+
+class ModelLoad {
+public:
+    operator uint32_t() const {
+        vModelRun(modelBUS_CYCLES);
+        return xCore.ulLoad;
+    }
+    ModelLoad &operator=(uint32_t ulValue) {
+        vModelRun(modelBUS_CYCLES);
+        xCore.ulLoad = ulValue & SysTick_LOAD_RELOAD_Msk;
+        return *this;
+    }
+};
+
+/* any write clears the counter and the count flag */
+class ModelVal {
+public:
+    operator uint32_t() const {
+        vModelRun(modelBUS_CYCLES);
+        return xCore.ulVal;
+    }
+    ModelVal &operator=(uint32_t ulValue) {
+        (void)ulValue;
+        vModelRun(modelBUS_CYCLES);
+        xCore.ulVal = 0;
+        xCore.iCountFlag = 0;
+        return *this;
+    }
+};
+
+class ModelIcsr {
+public:
+    operator uint32_t() const {
+        uint32_t ulValue = 0;
+
+        vModelRun(modelBUS_CYCLES);
+        if( xCore.iTickPending != 0 ) {
+            ulValue |= SCB_ICSR_PENDSTSET_Msk | ( 15UL << 12 );
+        }
+        else if( xCore.iExternalPending != 0 ) {
+            ulValue |= ( 16UL << 12 );
+        }
+        return ulValue;
+    }
+    ModelIcsr &operator=(uint32_t ulValue) {
+        vModelRun(modelBUS_CYCLES);
+        if( ( ulValue & SCB_ICSR_PENDSTCLR_Msk ) != 0 ) {
+            xCore.iTickPending = 0;
+        }
+        return *this;
+    }
+};
+
+class ModelScr {
+public:
+    ModelScr &operator|=(uint32_t ulValue) {
+        vModelRun(modelBUS_CYCLES);
+        if( ( ulValue & SCB_SCR_SEVONPEND_Msk ) != 0 ) {
+            xCore.iSevOnPend = 1;
+        }
+        return *this;
+    }
+};
+
+typedef struct {
+    ModelCtrl CTRL;
+    ModelLoad LOAD;
+    ModelVal VAL;
+} ModelSysTick_t;
+
+typedef struct {
+    ModelIcsr ICSR;
+    ModelScr SCR;
+} ModelScb_t;
+
+static ModelSysTick_t xModelSysTick;
+static ModelScb_t xModelScb;
+
+#define SysTick     ( &xModelSysTick )
+#define SCB         ( &xModelScb )
+
+static inline void NVIC_SetPriority(int iIRQn, uint32_t ulPriority) { (void)iIRQn; (void)ulPriority; }
+static inline uint32_t NVIC_GetPriorityGrouping(void) { return 0; }
+static inline uint32_t NVIC_EncodePriority(uint32_t ulGroup, uint32_t ulPreempt, uint32_t ulSub) { (void)ulGroup; (void)ulSub; return ulPreempt; }
+
+static inline void __DSB(void) { vModelRun(modelINSTRUCTION_CYCLES); }
+static inline void __ISB(void) { vModelRun(modelINSTRUCTION_CYCLES); }
+static inline void __SEV(void) { vModelRun(modelINSTRUCTION_CYCLES); xCore.iEvent = 1; }
+
+/* the Cortex-M3/M4/M7 ports sleep in the SVC handler, a pending interrupt is
+only taken once the test returns from the service call */
+static inline void __disable_irq(void) { vModelRun(modelINSTRUCTION_CYCLES); xCore.iPrimask = 1; }
+static inline void __enable_irq(void) { vModelRun(modelINSTRUCTION_CYCLES); xCore.iPrimask = 0; }
+
+/* the Cortex-M0+ port sleeps in thread mode, restoring PRIMASK lets the
+pending interrupts execute at once */
+static void vServiceInterrupts(void);
+
+static inline uint32_t ulPortDisableInterrupts(void)
+{
+    uint32_t ulMask = ( uint32_t ) xCore.iPrimask;
+
+    __disable_irq();
+    return ulMask;
+}
+
+static inline void vPortRestoreInterrupts(uint32_t ulMask)
+{
+    vModelRun(modelINSTRUCTION_CYCLES);
+    xCore.iPrimask = ( int ) ulMask;
+    if( ulMask == 0 ) {
+        vServiceInterrupts();
+    }
+}
+
+static inline void __WFE(void)
+{
+    vModelRun(modelINSTRUCTION_CYCLES);
+    if( xCore.iEvent == 0 ) {
+        while( xCore.iEvent == 0 ) {
+            vModelWaitForPend();
+        }
+    }
+    xCore.iEvent = 0;
+}
+
+/* wakes on any pending interrupt, also with PRIMASK set */
+static inline void __WFI(void)
+{
+    vModelRun(modelINSTRUCTION_CYCLES);
+    if( ( xCore.iTickPending == 0 ) && ( xCore.iExternalPending == 0 ) ) {
+        vModelWaitForPend();
+    }
+}
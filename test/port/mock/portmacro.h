@@ -0,0 +1,54 @@
+/*_____________________________________________________________________________
+ │                                                                            |
+ │ COPYRIGHT (C) 2026 Mihai Baneu                                             |
+ │                                                                            |
+ | Permission is hereby  granted,  free of charge,  to any person obtaining a |
+ | copy of this software and associated documentation files (the "Software"), |
+ | to deal in the Software without restriction,  including without limitation |
+ | the rights to  use, copy, modify, merge, publish, distribute,  sublicense, |
+ | and/or sell copies  of  the Software, and to permit  persons to  whom  the |
+ | Software is furnished to do so, subject to the following conditions:       |
+ |                                                                            |
+ | The above  copyright notice  and this permission notice  shall be included |
+ | in all copies or substantial portions of the Software.                     |
+ |                                                                            |
+ | THE SOFTWARE IS PROVIDED  "AS IS",  WITHOUT WARRANTY OF ANY KIND,  EXPRESS |
+ | OR   IMPLIED,   INCLUDING   BUT   NOT   LIMITED   TO   THE  WARRANTIES  OF |
+ | MERCHANTABILITY,  FITNESS FOR  A  PARTICULAR  PURPOSE AND NONINFRINGEMENT. |
+ | IN NO  EVENT SHALL  THE AUTHORS  OR  COPYRIGHT  HOLDERS  BE LIABLE FOR ANY |
+ | CLAIM, DAMAGES OR OTHER LIABILITY,  WHETHER IN AN ACTION OF CONTRACT, TORT |
+ | OR OTHERWISE, ARISING FROM,  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR  |
+ | THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                 |
+ |____________________________________________________________________________|
+ |                                                                            |
+ |  Author: Mihai Baneu                           Last modified: 17.Oct.2026  |
+ |                                                                            |
+ |___________________________________________________________________________*/
+
+/* Stand-in for the portmacro.h and the FreeRTOSConfig.h settings used by
+port_systick.c when it is built on the host. */
+
+#pragma once
+
+#include <stdint.h>
+
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define configCPU_CLOCK_HZ                  system_cpu_f()
+#define configTICK_RATE_HZ                  1000
+#define configUSE_TICKLESS_IDLE             1
+#define configKERNEL_INTERRUPT_PRIORITY     0b11110000
+#define configSysTick_INTERRUPT_PRIORITY    3
+#define configGENERATE_RUN_TIME_STATS       0
+
+/* the SysTick handler is called by the test with the interrupts masked */
+#define portDISABLE_INTERRUPTS()
+#define portENABLE_INTERRUPTS()
+
+extern uint32_t ulSleepEntries;
+#define configPRE_SLEEP_PROCESSING( x )     ( ulSleepEntries++ )
+#define configPOST_SLEEP_PROCESSING( x )
+
+static inline void vPortYieldFromISR(void) { }
@@ -0,0 +1,229 @@
+/*_____________________________________________________________________________
+ │                                                                            |
+ │ COPYRIGHT (C) 2026 Mihai Baneu                                             |
+ │                                                                            |
+ | Permission is hereby  granted,  free of charge,  to any person obtaining a |
+ | copy of this software and associated documentation files (the "Software"), |
+ | to deal in the Software without restriction,  including without limitation |
+ | the rights to  use, copy, modify, merge, publish, distribute,  sublicense, |
+ | and/or sell copies  of  the Software, and to permit  persons to  whom  the |
+ | Software is furnished to do so, subject to the following conditions:       |
+ |                                                                            |
+ | The above  copyright notice  and this permission notice  shall be included |
+ | in all copies or substantial portions of the Software.                     |
+ |                                                                            |
+ | THE SOFTWARE IS PROVIDED  "AS IS",  WITHOUT WARRANTY OF ANY KIND,  EXPRESS |
+ | OR   IMPLIED,   INCLUDING   BUT   NOT   LIMITED   TO   THE  WARRANTIES  OF |
+ | MERCHANTABILITY,  FITNESS FOR  A  PARTICULAR  PURPOSE AND NONINFRINGEMENT. |
+ | IN NO  EVENT SHALL  THE AUTHORS  OR  COPYRIGHT  HOLDERS  BE LIABLE FOR ANY |
+ | CLAIM, DAMAGES OR OTHER LIABILITY,  WHETHER IN AN ACTION OF CONTRACT, TORT |
+ | OR OTHERWISE, ARISING FROM,  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR  |
+ | THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                 |
+ |____________________________________________________________________________|
+ |                                                                            |
+ |  Author: Mihai Baneu                           Last modified: 17.Oct.2026  |
+ |                                                                            |
+ |___________________________________________________________________________*/
+
+/* Tick drift and wakeups of the tickless idle of a SysTick port.
+
+The port_systick.c of the port under test is built against the cycle model in
+mock/port.h. A task wakes after a random number of ticks, runs for a while and
+blocks again, external interrupts arrive at random and end the sleeps early.
+The same workload runs once with the tick interrupt kept running and once with
+the ticks suppressed, and the test reports the CPU wakeups per second and the
+drift of the tick count against the model time.
+
+The SysTick does not count while it is stopped to be reloaded, the port adds
+portMISSED_COUNTS_FACTOR counts back on every sleep. The difference between
+the two depends on the core and the flash wait states, the model only charges
+the register accesses, so the drift in ppm reported here is mostly that
+difference. Whatever the algorithm loses beyond it is the error the test
+checks for. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "port_systick.c"
+
+#ifndef SIM_SECONDS
+#define SIM_SECONDS             120U
+#endif
+
+/* the longest a task blocks, beyond the SysTick range to split the sleeps */
+#ifndef SIM_MAX_BLOCK_TICKS
+#define SIM_MAX_BLOCK_TICKS     1500U
+#endif
+
+/* the sleep function of the port */
+#ifndef SIM_SLEEP
+#define SIM_SLEEP               vPortTicklessSleep
+#endif
+
+/* mean time between two external interrupts in ms */
+#define SIM_EXTERNAL_MEAN_MS    40U
+
+/* error allowed on top of the stopped time over the whole run */
+#define SIM_RESIDUAL_CYCLES     64
+
+/* cycles the idle task runs between two sleeps */
+#define SIM_IDLE_CYCLES         60U
+
+uint32_t ulSleepEntries;
+
+static TickType_t xTickCount;
+static TickType_t xNextWakeTime;
+static uint32_t ulExternalInterrupts;
+static uint32_t ulSeed = 1;
+
+unsigned int system_cpu_f()
+{
+    return SIM_CPU_HZ;
+}
+
+BaseType_t xTaskIncrementTick(void)
+{
+    xTickCount++;
+    return pdFALSE;
+}
+
+eSleepModeStatus eTaskConfirmSleepModeStatus(void)
+{
+    return ( xTickCount == xNextWakeTime ) ? eAbortSleep : eStandardSleep;
+}
+
+void vTaskStepTick(TickType_t xTicksToJump)
+{
+    /* the kernel asserts the same: a sleep must never step over the wake time */
+    assert( ( xTickCount + xTicksToJump ) <= xNextWakeTime );
+    xTickCount += xTicksToJump;
+}
+
+static uint32_t ulRandom(uint32_t ulMax)
+{
+    ulSeed = ulSeed * 1103515245UL + 12345UL;
+    return ( ( ulSeed >> 8 ) % ulMax ) + 1U;
+}
+
+static void vScheduleExternal(void)
+{
+    /* roughly exponential arrival times */
+    uint64_t ullMean = ( uint64_t ) SIM_CPU_HZ / 1000U * SIM_EXTERNAL_MEAN_MS;
+    uint64_t ullGap = ullMean * ( ulRandom(1000) + ulRandom(1000) ) / 1000U;
+    xCore.ullExternalAt = xCore.ullNow + ullGap;
+    xCore.iExternalPending = 0;
+}
+
+/* the handlers of the interrupts that are pending */
+static void vServiceInterrupts(void)
+{
+    if( xCore.iTickPending != 0 ) {
+        xCore.iTickPending = 0;
+        SysTick_Handler();
+    }
+    if( xCore.iExternalPending != 0 ) {
+        ulExternalInterrupts++;
+        vScheduleExternal();
+    }
+}
+
+/* run thread code for a number of cycles, the interrupts are served as they
+become pending */
+static void vRunThread(uint64_t ullCycles)
+{
+    while( ullCycles > 0 ) {
+        uint64_t ullStep = ullModelNextPend();
+        if( ( ullStep == 0 ) || ( ullStep > ullCycles ) ) {
+            ullStep = ullCycles;
+        }
+        vModelRun(ullStep);
+        ullCycles -= ullStep;
+        vServiceInterrupts();
+    }
+}
+
+/* the blocked task wakes up exactly at its wake time, runs and blocks again */
+static void vRunTask(void)
+{
+    assert( xTickCount == xNextWakeTime );
+    vRunThread(ulRandom(SIM_CPU_HZ / configTICK_RATE_HZ * 3U));
+    xNextWakeTime = xTickCount + ulRandom(SIM_MAX_BLOCK_TICKS);
+}
+
+static int iRun(int iTickless)
+{
+    const uint64_t ullEnd = ( uint64_t ) SIM_CPU_HZ * SIM_SECONDS;
+    const uint32_t ulCountsForOneTick = SIM_CPU_HZ / configTICK_RATE_HZ;
+    int64_t llDrift, llExpected, llResidual;
+    double dSeconds;
+
+    memset(&xCore, 0, sizeof(xCore));
+    xTickCount = 0;
+    ulSleepEntries = 0;
+    ulExternalInterrupts = 0;
+    ulSeed = 1;
+    xNextWakeTime = ulRandom(SIM_MAX_BLOCK_TICKS);
+
+    vPortConfigureSysTick();
+    vScheduleExternal();
+
+    while( xCore.ullNow < ullEnd ) {
+        if( xTickCount == xNextWakeTime ) {
+            vRunTask();
+            continue;
+        }
+
+        /* the idle task runs, a tick in this time can only make the task ready */
+        vRunThread(SIM_IDLE_CYCLES);
+        if( xTickCount == xNextWakeTime ) {
+            continue;
+        }
+
+        if( ( iTickless != 0 ) && ( ( xNextWakeTime - xTickCount ) >= 2U ) ) {
+            SIM_SLEEP(xNextWakeTime - xTickCount);
+        }
+        else {
+            __WFI();
+        }
+        vServiceInterrupts();
+    }
+
+    /* let the tick run for a while to read the counter in a standard period */
+    vRunThread(3U * ulCountsForOneTick);
+    while( xCore.ulVal == 0 ) {
+        vRunThread(1);
+    }
+
+    /* kernel time against model time: tick n ends at n tick periods after the
+    SysTick was started */
+    dSeconds = ( double ) ( xCore.ullNow - xCore.ullStartedAt ) / SIM_CPU_HZ;
+    llDrift = ( int64_t ) ( ( uint64_t ) xTickCount * ulCountsForOneTick + ( ulCountsForOneTick - xCore.ulVal ) ) - ( int64_t ) ( xCore.ullNow - xCore.ullStartedAt );
+    llExpected = ( int64_t ) ulSleepEntries * portMISSED_COUNTS_FACTOR - ( int64_t ) xCore.ullStopped;
+
+    /* the SysTick also spends a clock on each of the two reloads from 0 of
+    every sleep. Over the whole run the rest is exact to a few cycles, a tick
+    period lost or gained on a single sleep is far beyond it */
+    llResidual = llDrift - llExpected + ( int64_t ) ulSleepEntries * 2;
+
+    printf("%-9s %8.1f wakeups/s  %6lu sleeps  %6lu external  tick error %+.3f ticks (%+.2f ppm)  stopped %llu  compensated %llu  residual %+lld cycles\n",
+           iTickless ? "tickless" : "ticking",
+           xCore.ulWakeups / dSeconds, ( unsigned long ) ulSleepEntries, ( unsigned long ) ulExternalInterrupts,
+           ( double ) llDrift / ulCountsForOneTick, llDrift * 1e6 / ( double ) ( xCore.ullNow - xCore.ullStartedAt ),
+           ( unsigned long long ) xCore.ullStopped, ( unsigned long long ) ulSleepEntries * portMISSED_COUNTS_FACTOR,
+           ( long long ) llResidual);
+
+    if( llabs(llResidual) > SIM_RESIDUAL_CYCLES ) {
+        printf("FAIL: the tick drifts beyond the stopped time\n");
+        return 1;
+    }
+    return 0;
+}
+
+int main(void)
+{
+    int iFailures = 0;
+
+    iFailures += iRun(0);
+    iFailures += iRun(1);
+    return iFailures;
+}
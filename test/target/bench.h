@@ -0,0 +1,56 @@
+/*_____________________________________________________________________________
+ │                                                                            |
+ │ COPYRIGHT (C) 2026 Mihai Baneu                                             |
+ │                                                                            |
+ | Permission is hereby  granted,  free of charge,  to any person obtaining a |
+ | copy of this software and associated documentation files (the "Software"), |
+ | to deal in the Software without restriction,  including without limitation |
+ | the rights to  use, copy, modify, merge, publish, distribute,  sublicense, |
+ | and/or sell copies  of  the Software, and to permit  persons to  whom  the |
+ | Software is furnished to do so, subject to the following conditions:       |
+ |                                                                            |
+ | The above  copyright notice  and this permission notice  shall be included |
+ | in all copies or substantial portions of the Software.                     |
+ |                                                                            |
+ | THE SOFTWARE IS PROVIDED  "AS IS",  WITHOUT WARRANTY OF ANY KIND,  EXPRESS |
+ | OR   IMPLIED,   INCLUDING   BUT   NOT   LIMITED   TO   THE  WARRANTIES  OF |
+ | MERCHANTABILITY,  FITNESS FOR  A  PARTICULAR  PURPOSE AND NONINFRINGEMENT. |
+ | IN NO  EVENT SHALL  THE AUTHORS  OR  COPYRIGHT  HOLDERS  BE LIABLE FOR ANY |
+ | CLAIM, DAMAGES OR OTHER LIABILITY,  WHETHER IN AN ACTION OF CONTRACT, TORT |
+ | OR OTHERWISE, ARISING FROM,  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR  |
+ | THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                 |
+ |____________________________________________________________________________|
+ |                                                                            |
+ |  Author: Mihai Baneu                           Last modified: 17.Oct.2026  |
+ |                                                                            |
+ |___________________________________________________________________________*/
+
+#pragma once
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#if configGENERATE_RUN_TIME_STATS != 1
+#error The benchmarks read the cycle counter of the run time stats, set configGENERATE_RUN_TIME_STATS to 1.
+#endif
+
+/* iterations of every measured loop */
+#define BENCH_ROUNDS                10000UL
+
+/* priority of the benchmark task */
+#define BENCH_PRIORITY              (tskIDLE_PRIORITY + 2)
+
+/* the CPU cycle counter (DWT or SysTick based), from the unprivileged tasks of
+the DWT ports this is a service call */
+#define BENCH_CYCLES()              ((uint32_t) portGET_RUN_TIME_COUNTER_VALUE())
+
+/* cycles of an empty measurement, taken out of every result */
+extern uint32_t ulBenchOverhead;
+
+/* print one result per iteration */
+extern void vBenchReport(const char *pcName, uint32_t ulCycles, uint32_t ulIterations);
+
+/* the benchmarks - run one after the other from the benchmark task */
+extern void vBenchYield(void);
+extern void vBenchCritical(void);
+extern void vBenchSelect(void);
@@ -0,0 +1,65 @@
+/*_____________________________________________________________________________
+ │                                                                            |
+ │ COPYRIGHT (C) 2026 Mihai Baneu                                             |
+ │                                                                            |
+ | Permission is hereby  granted,  free of charge,  to any person obtaining a |
+ | copy of this software and associated documentation files (the "Software"), |
+ | to deal in the Software without restriction,  including without limitation |
+ | the rights to  use, copy, modify, merge, publish, distribute,  sublicense, |
+ | and/or sell copies  of  the Software, and to permit  persons to  whom  the |
+ | Software is furnished to do so, subject to the following conditions:       |
+ |                                                                            |
+ | The above  copyright notice  and this permission notice  shall be included |
+ | in all copies or substantial portions of the Software.                     |
+ |                                                                            |
+ | THE SOFTWARE IS PROVIDED  "AS IS",  WITHOUT WARRANTY OF ANY KIND,  EXPRESS |
+ | OR   IMPLIED,   INCLUDING   BUT   NOT   LIMITED   TO   THE  WARRANTIES  OF |
+ | MERCHANTABILITY,  FITNESS FOR  A  PARTICULAR  PURPOSE AND NONINFRINGEMENT. |
+ | IN NO  EVENT SHALL  THE AUTHORS  OR  COPYRIGHT  HOLDERS  BE LIABLE FOR ANY |
+ | CLAIM, DAMAGES OR OTHER LIABILITY,  WHETHER IN AN ACTION OF CONTRACT, TORT |
+ | OR OTHERWISE, ARISING FROM,  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR  |
+ | THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                 |
+ |____________________________________________________________________________|
+ |                                                                            |
+ |  Author: Mihai Baneu                           Last modified: 17.Oct.2026  |
+ |                                                                            |
+ |___________________________________________________________________________*/
+
+#include "bench.h"
+
+/*
+ * Critical section round trip from a task: the taskENTER_CRITICAL() and
+ * taskEXIT_CRITICAL() pair and the inlined pair used by the kernel hot paths
+ * (the same pair on the ports without an inlined one). On the DWT ports the
+ * tasks are unprivileged, so both go through svc 3 and svc 4. The empty loop
+ * is the cost of the loop itself.
+ */
+
+static volatile uint32_t ulBenchCriticalCounter;
+
+void vBenchCritical(void)
+{
+    uint32_t ulStart, ulIndex;
+
+    ulStart = BENCH_CYCLES();
+    for (ulIndex = 0; ulIndex < BENCH_ROUNDS; ulIndex++) {
+        ulBenchCriticalCounter++;
+    }
+    vBenchReport("empty loop", BENCH_CYCLES() - ulStart, BENCH_ROUNDS);
+
+    ulStart = BENCH_CYCLES();
+    for (ulIndex = 0; ulIndex < BENCH_ROUNDS; ulIndex++) {
+        taskENTER_CRITICAL();
+        ulBenchCriticalCounter++;
+        taskEXIT_CRITICAL();
+    }
+    vBenchReport("critical section", BENCH_CYCLES() - ulStart, BENCH_ROUNDS);
+
+    ulStart = BENCH_CYCLES();
+    for (ulIndex = 0; ulIndex < BENCH_ROUNDS; ulIndex++) {
+        UBaseType_t uxMask = taskENTER_CRITICAL_INLINE();
+        ulBenchCriticalCounter++;
+        taskEXIT_CRITICAL_INLINE(uxMask);
+    }
+    vBenchReport("inlined critical section", BENCH_CYCLES() - ulStart, BENCH_ROUNDS);
+}
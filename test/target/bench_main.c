@@ -0,0 +1,71 @@
+/*_____________________________________________________________________________
+ │                                                                            |
+ │ COPYRIGHT (C) 2026 Mihai Baneu                                             |
+ │                                                                            |
+ | Permission is hereby  granted,  free of charge,  to any person obtaining a |
+ | copy of this software and associated documentation files (the "Software"), |
+ | to deal in the Software without restriction,  including without limitation |
+ | the rights to  use, copy, modify, merge, publish, distribute,  sublicense, |
+ | and/or sell copies  of  the Software, and to permit  persons to  whom  the |
+ | Software is furnished to do so, subject to the following conditions:       |
+ |                                                                            |
+ | The above  copyright notice  and this permission notice  shall be included |
+ | in all copies or substantial portions of the Software.                     |
+ |                                                                            |
+ | THE SOFTWARE IS PROVIDED  "AS IS",  WITHOUT WARRANTY OF ANY KIND,  EXPRESS |
+ | OR   IMPLIED,   INCLUDING   BUT   NOT   LIMITED   TO   THE  WARRANTIES  OF |
+ | MERCHANTABILITY,  FITNESS FOR  A  PARTICULAR  PURPOSE AND NONINFRINGEMENT. |
+ | IN NO  EVENT SHALL  THE AUTHORS  OR  COPYRIGHT  HOLDERS  BE LIABLE FOR ANY |
+ | CLAIM, DAMAGES OR OTHER LIABILITY,  WHETHER IN AN ACTION OF CONTRACT, TORT |
+ | OR OTHERWISE, ARISING FROM,  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR  |
+ | THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                 |
+ |____________________________________________________________________________|
+ |                                                                            |
+ |  Author: Mihai Baneu                           Last modified: 17.Oct.2026  |
+ |                                                                            |
+ |___________________________________________________________________________*/
+
+#include <stdio.h>
+#include "bench.h"
+
+uint32_t ulBenchOverhead;
+
+/**
+ * @brief Print the cycles of one iteration of a benchmark.
+ *
+ * @param pcName name of the measurement
+ * @param ulCycles cycles of the whole measurement, with the overhead still in
+ * @param ulIterations number of iterations measured
+ */
+void vBenchReport(const char *pcName, uint32_t ulCycles, uint32_t ulIterations)
+{
+    ulCycles -= ulBenchOverhead;
+    printf("%-32s %6lu.%02lu cycles\n", pcName, (unsigned long) (ulCycles / ulIterations), (unsigned long) (((ulCycles % ulIterations) * 100UL) / ulIterations));
+}
+
+static void vBenchTask(void *pvParameters)
+{
+    uint32_t ulStart;
+
+    (void) pvParameters;
+
+    /* two back to back reads of the cycle counter */
+    ulStart = BENCH_CYCLES();
+    ulBenchOverhead = BENCH_CYCLES() - ulStart;
+    printf("cycle counter read overhead: %lu cycles\n", (unsigned long) ulBenchOverhead);
+
+    vBenchYield();
+    vBenchCritical();
+    vBenchSelect();
+
+    printf("done\n");
+    vTaskDelete(NULL);
+}
+
+int main(void)
+{
+    xTaskCreate(vBenchTask, "bench", 4 * configMINIMAL_STACK_SIZE, NULL, BENCH_PRIORITY, NULL);
+    vTaskStartScheduler();
+
+    return 0;
+}
@@ -0,0 +1,79 @@
+/*_____________________________________________________________________________
+ │                                                                            |
+ │ COPYRIGHT (C) 2026 Mihai Baneu                                             |
+ │                                                                            |
+ | Permission is hereby  granted,  free of charge,  to any person obtaining a |
+ | copy of this software and associated documentation files (the "Software"), |
+ | to deal in the Software without restriction,  including without limitation |
+ | the rights to  use, copy, modify, merge, publish, distribute,  sublicense, |
+ | and/or sell copies  of  the Software, and to permit  persons to  whom  the |
+ | Software is furnished to do so, subject to the following conditions:       |
+ |                                                                            |
+ | The above  copyright notice  and this permission notice  shall be included |
+ | in all copies or substantial portions of the Software.                     |
+ |                                                                            |
+ | THE SOFTWARE IS PROVIDED  "AS IS",  WITHOUT WARRANTY OF ANY KIND,  EXPRESS |
+ | OR   IMPLIED,   INCLUDING   BUT   NOT   LIMITED   TO   THE  WARRANTIES  OF |
+ | MERCHANTABILITY,  FITNESS FOR  A  PARTICULAR  PURPOSE AND NONINFRINGEMENT. |
+ | IN NO  EVENT SHALL  THE AUTHORS  OR  COPYRIGHT  HOLDERS  BE LIABLE FOR ANY |
+ | CLAIM, DAMAGES OR OTHER LIABILITY,  WHETHER IN AN ACTION OF CONTRACT, TORT |
+ | OR OTHERWISE, ARISING FROM,  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR  |
+ | THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                 |
+ |____________________________________________________________________________|
+ |                                                                            |
+ |  Author: Mihai Baneu                           Last modified: 17.Oct.2026  |
+ |                                                                            |
+ |___________________________________________________________________________*/
+
+#include "bench.h"
+
+/*
+ * Highest ready priority lookup of vTaskSwitchContext(): the port macro against
+ * 31 - __builtin_clz(), which on the Cortex-M0+ of the G0 is a call to the
+ * software __clzsi2() and on the other cores the CLZ instruction. The bit maps
+ * have their highest bit at every position in turn. The loop reading the bit
+ * maps is measured on its own and taken out of both.
+ */
+
+#if configUSE_PORT_OPTIMISED_TASK_SELECTION == 1
+
+static volatile uint32_t ulBenchSelectSink;
+static uint32_t ulBenchSelectMaps[32];
+
+void vBenchSelect(void)
+{
+    uint32_t ulStart, ulLoop, ulIndex;
+    UBaseType_t uxTopPriority;
+
+    for (ulIndex = 0; ulIndex < 32; ulIndex++) {
+        ulBenchSelectMaps[ulIndex] = (1UL << ulIndex) | (0x55555555UL & ((1UL << ulIndex) - 1U));
+    }
+
+    ulStart = BENCH_CYCLES();
+    for (ulIndex = 0; ulIndex < BENCH_ROUNDS; ulIndex++) {
+        ulBenchSelectSink = ulBenchSelectMaps[ulIndex & 31U];
+    }
+    ulLoop = BENCH_CYCLES() - ulStart;
+
+    ulStart = BENCH_CYCLES();
+    for (ulIndex = 0; ulIndex < BENCH_ROUNDS; ulIndex++) {
+        portGET_HIGHEST_PRIORITY(uxTopPriority, ulBenchSelectMaps[ulIndex & 31U]);
+        ulBenchSelectSink = uxTopPriority;
+    }
+    vBenchReport("highest priority, port macro", BENCH_CYCLES() - ulStart - ulLoop + ulBenchOverhead, BENCH_ROUNDS);
+
+    ulStart = BENCH_CYCLES();
+    for (ulIndex = 0; ulIndex < BENCH_ROUNDS; ulIndex++) {
+        uxTopPriority = 31U - (UBaseType_t) __builtin_clz(ulBenchSelectMaps[ulIndex & 31U]);
+        ulBenchSelectSink = uxTopPriority;
+    }
+    vBenchReport("highest priority, __builtin_clz", BENCH_CYCLES() - ulStart - ulLoop + ulBenchOverhead, BENCH_ROUNDS);
+}
+
+#else
+
+void vBenchSelect(void)
+{
+}
+
+#endif /* configUSE_PORT_OPTIMISED_TASK_SELECTION */
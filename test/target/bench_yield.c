@@ -0,0 +1,67 @@
+/*_____________________________________________________________________________
+ │                                                                            |
+ │ COPYRIGHT (C) 2026 Mihai Baneu                                             |
+ │                                                                            |
+ | Permission is hereby  granted,  free of charge,  to any person obtaining a |
+ | copy of this software and associated documentation files (the "Software"), |
+ | to deal in the Software without restriction,  including without limitation |
+ | the rights to  use, copy, modify, merge, publish, distribute,  sublicense, |
+ | and/or sell copies  of  the Software, and to permit  persons to  whom  the |
+ | Software is furnished to do so, subject to the following conditions:       |
+ |                                                                            |
+ | The above  copyright notice  and this permission notice  shall be included |
+ | in all copies or substantial portions of the Software.                     |
+ |                                                                            |
+ | THE SOFTWARE IS PROVIDED  "AS IS",  WITHOUT WARRANTY OF ANY KIND,  EXPRESS |
+ | OR   IMPLIED,   INCLUDING   BUT   NOT   LIMITED   TO   THE  WARRANTIES  OF |
+ | MERCHANTABILITY,  FITNESS FOR  A  PARTICULAR  PURPOSE AND NONINFRINGEMENT. |
+ | IN NO  EVENT SHALL  THE AUTHORS  OR  COPYRIGHT  HOLDERS  BE LIABLE FOR ANY |
+ | CLAIM, DAMAGES OR OTHER LIABILITY,  WHETHER IN AN ACTION OF CONTRACT, TORT |
+ | OR OTHERWISE, ARISING FROM,  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR  |
+ | THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                 |
+ |____________________________________________________________________________|
+ |                                                                            |
+ |  Author: Mihai Baneu                           Last modified: 17.Oct.2026  |
+ |                                                                            |
+ |___________________________________________________________________________*/
+
+#include "bench.h"
+
+/*
+ * Yield round trip. The benchmark task and a partner of the same priority
+ * yield to each other, so every taskYIELD() is one svc 1 dispatched from the
+ * table of the SVC_Handler, one PendSV and one vTaskSwitchContext(). Without
+ * the partner the same yield switches back to the calling task.
+ */
+
+static void vBenchYieldPartner(void *pvParameters)
+{
+    (void) pvParameters;
+
+    for (;;) {
+        taskYIELD();
+    }
+}
+
+void vBenchYield(void)
+{
+    TaskHandle_t xPartner;
+    uint32_t ulStart, ulIndex;
+
+    ulStart = BENCH_CYCLES();
+    for (ulIndex = 0; ulIndex < BENCH_ROUNDS; ulIndex++) {
+        taskYIELD();
+    }
+    vBenchReport("yield, no other task ready", BENCH_CYCLES() - ulStart, BENCH_ROUNDS);
+
+    xTaskCreate(vBenchYieldPartner, "yield", configMINIMAL_STACK_SIZE, NULL, BENCH_PRIORITY, &xPartner);
+
+    /* every round is two switches: to the partner and back */
+    ulStart = BENCH_CYCLES();
+    for (ulIndex = 0; ulIndex < BENCH_ROUNDS; ulIndex++) {
+        taskYIELD();
+    }
+    vBenchReport("yield, switch to another task", BENCH_CYCLES() - ulStart, 2 * BENCH_ROUNDS);
+
+    vTaskDelete(xPartner);
+}